@@ -0,0 +1,302 @@
+/*******************************************************************************************
+*
+*   raylib [others] example - Image draw benchmark
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Benchmark of CPU image sprites compositing: ImageDraw() and ImageDrawEx() (blending by rows,
+*   scaled sources resampled while drawing) against previous ImageDraw() implementation
+*   (GetPixelColor()/ColorAlphaBlend()/SetPixelColor() per pixel, scaled sources resized
+*   into an intermediate copy with ImageFromImage() and ImageResize())
+*
+*   NOTE: Maximum channel difference between both results is also reported, scaled sources
+*   in formats not supported by the resizer (16-bit packed, float) are no longer quantized
+*   back to source format before drawing, so results differ on those cases
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <string.h>         // Required for: memcpy()
+
+#define SPRITE_DRAWS        1000        // Sprites drawn per case and method
+#define BENCHMARK_CASES        6        // Cases benchmarked
+
+#define CANVAS_WIDTH        1280        // Destination image width
+#define CANVAS_HEIGHT        720        // Destination image height
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static void ImageDrawPrevious(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, int blendMode); // Previous ImageDraw() implementation, for reference
+static int GetImagesMaxDifference(Image a, Image b);    // Get maximum channel difference between two images of same size and format
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [others] example - image draw benchmark");
+
+    const char *caseNames[BENCHMARK_CASES] = {
+        "RGBA8 over RGBA8",
+        "RGBA8 over RGBA8, scaled",
+        "RGBA8 over GRAYSCALE",
+        "R5G6B5 over R5G6B5, tinted",
+        "R5G5B5A1 over RGBA8, scaled",
+        "RGBA8 over RGBA8, premultiplied"
+    };
+    const int dstFormats[BENCHMARK_CASES] = {
+        PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
+        PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+    const int srcFormats[BENCHMARK_CASES] = {
+        PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+    const Vector2 drawSizes[BENCHMARK_CASES] = { { 64, 64 }, { 96, 80 }, { 64, 64 }, { 64, 64 }, { 96, 80 }, { 64, 64 } };
+    const Color tints[BENCHMARK_CASES] = { WHITE, WHITE, WHITE, (Color){ 255, 255, 255, 160 }, WHITE, (Color){ 255, 220, 180, 255 } };
+    const int blendModes[BENCHMARK_CASES] = { BLEND_ALPHA, BLEND_ALPHA, BLEND_ALPHA, BLEND_ALPHA, BLEND_ALPHA, BLEND_ALPHA_PREMULTIPLY };
+
+    // Opaque canvas background and 64x64 sprite with alpha gradient
+    Image background = GenImageGradientLinear(CANVAS_WIDTH, CANVAS_HEIGHT, 45, DARKBLUE, SKYBLUE);
+    Image sprite = GenImageGradientRadial(64, 64, 0.3f, ORANGE, BLANK);
+
+    double times[BENCHMARK_CASES][2] = { 0 };
+    int differences[BENCHMARK_CASES] = { 0 };
+    bool run = true;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) run = true;
+
+        if (run)
+        {
+            for (int c = 0; c < BENCHMARK_CASES; c++)
+            {
+                Image source = ImageCopy(sprite);
+                ImageFormat(&source, srcFormats[c]);
+                if (blendModes[c] == BLEND_ALPHA_PREMULTIPLY) ImageAlphaPremultiply(&source);
+
+                Image canvas[2] = { ImageCopy(background), ImageCopy(background) };
+                Rectangle srcRec = { 0, 0, (float)source.width, (float)source.height };
+
+                for (int m = 0; m < 2; m++)
+                {
+                    ImageFormat(&canvas[m], dstFormats[c]);
+
+                    double startTime = GetTime();
+
+                    for (int i = 0; i < SPRITE_DRAWS; i++)
+                    {
+                        // Sprites spread over canvas, some of them partially out of bounds
+                        Rectangle dstRec = { (float)((i*97)%(CANVAS_WIDTH - 32) - 16), (float)((i*53)%(CANVAS_HEIGHT - 32) - 16), drawSizes[c].x, drawSizes[c].y };
+
+                        if (m == 0) ImageDrawPrevious(&canvas[m], source, srcRec, dstRec, tints[c], blendModes[c]);
+                        else ImageDrawEx(&canvas[m], source, srcRec, dstRec, tints[c], blendModes[c]);
+                    }
+
+                    times[c][m] = (GetTime() - startTime)*1000.0;
+                }
+
+                differences[c] = GetImagesMaxDifference(canvas[0], canvas[1]);
+
+                TraceLog(LOG_INFO, "BENCHMARK: %-32s previous: %8.2f ms | ImageDraw(): %8.2f ms | max difference: %3i", caseNames[c], times[c][0], times[c][1], differences[c]);
+
+                UnloadImage(canvas[0]);
+                UnloadImage(canvas[1]);
+                UnloadImage(source);
+            }
+
+            run = false;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("%i sprites per case and method (ms), press SPACE to run again", SPRITE_DRAWS), 20, 20, 20, DARKGRAY);
+
+            DrawText("case", 20, 70, 20, GRAY);
+            DrawText("previous", 330, 70, 10, GRAY);
+            DrawText("ImageDraw()", 480, 70, 10, GRAY);
+            DrawText("max diff", 640, 70, 10, GRAY);
+
+            for (int c = 0; c < BENCHMARK_CASES; c++)
+            {
+                DrawText(caseNames[c], 20, 110 + c*40, 10, DARKGRAY);
+                DrawText(TextFormat("%.2f", times[c][0]), 330, 105 + c*40, 20, MAROON);
+                DrawText(TextFormat("%.2f", times[c][1]), 480, 105 + c*40, 20, DARKGREEN);
+                DrawText(TextFormat("%i", differences[c]), 640, 105 + c*40, 20, (differences[c] == 0)? GRAY : ORANGE);
+
+                if (times[c][1] > 0.0) DrawText(TextFormat("x%.1f", times[c][0]/times[c][1]), 720, 105 + c*40, 20, DARKBLUE);
+            }
+
+            DrawText("Scaled R5G5B5A1 source is no longer quantized to 1-bit alpha after resize", 20, 410, 10, LIGHTGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadImage(sprite);
+    UnloadImage(background);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Previous ImageDraw() implementation, for reference
+// NOTE: Premultiplied blending computed per pixel, out = src + dst*(255 - src.a)/255
+static void ImageDrawPrevious(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, int blendMode)
+{
+    Image srcMod = { 0 };       // Source copy (in case it was required)
+    Image *srcPtr = &src;       // Pointer to source image
+    bool useSrcMod = false;     // Track source copy required
+
+    // Source rectangle out-of-bounds security checks
+    if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
+    if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
+    if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
+    if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
+
+    // Check if source rectangle needs to be resized to destination rectangle
+    if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
+    {
+        srcMod = ImageFromImage(src, srcRec);
+        ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);
+        srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+
+        srcPtr = &srcMod;
+        useSrcMod = true;
+    }
+
+    // Destination rectangle out-of-bounds security checks
+    if (dstRec.x < 0)
+    {
+        srcRec.x -= dstRec.x;
+        srcRec.width += dstRec.x;
+        dstRec.x = 0;
+    }
+    else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
+
+    if (dstRec.y < 0)
+    {
+        srcRec.y -= dstRec.y;
+        srcRec.height += dstRec.y;
+        dstRec.y = 0;
+    }
+    else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
+
+    if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
+    if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+
+    // Fast path: Avoid blend if source has no alpha to blend
+    bool blendRequired = true;
+    if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
+
+    int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
+    int bytesPerPixelDst = strideDst/(dst->width);
+
+    int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
+    int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+
+    unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
+    unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+
+    for (int y = 0; y < (int)srcRec.height; y++)
+    {
+        unsigned char *pSrc = pSrcBase;
+        unsigned char *pDst = pDstBase;
+
+        // Fast path: Avoid moving pixel by pixel if no blend required and same format
+        if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+        else
+        {
+            for (int x = 0; x < (int)srcRec.width; x++)
+            {
+                Color colSrc = GetPixelColor(pSrc, srcPtr->format);
+                Color colDst = GetPixelColor(pDst, dst->format);
+                Color blend = colSrc;
+
+                if (blendRequired)
+                {
+                    if (blendMode == BLEND_ALPHA_PREMULTIPLY)
+                    {
+                        unsigned char srcChannels[4] = { colSrc.r, colSrc.g, colSrc.b, colSrc.a };
+                        unsigned char dstChannels[4] = { colDst.r, colDst.g, colDst.b, colDst.a };
+                        unsigned char tintChannels[4] = { tint.r, tint.g, tint.b, tint.a };
+                        unsigned char out[4] = { 0 };
+                        int alpha = (colSrc.a*(tint.a + 1)) >> 8;
+
+                        for (int k = 0; k < 4; k++)
+                        {
+                            int value = ((srcChannels[k]*(tintChannels[k] + 1)) >> 8) + (dstChannels[k]*(255 - alpha) + 127)/255;
+                            out[k] = (value > 255)? 255 : (unsigned char)value;
+                        }
+
+                        blend = (Color){ out[0], out[1], out[2], out[3] };
+                    }
+                    else blend = ColorAlphaBlend(colDst, colSrc, tint);
+                }
+
+                SetPixelColor(pDst, blend, dst->format);
+
+                pDst += bytesPerPixelDst;
+                pSrc += bytesPerPixelSrc;
+            }
+        }
+
+        pSrcBase += strideSrc;
+        pDstBase += strideDst;
+    }
+
+    if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+}
+
+// Get maximum channel difference between two images of same size and format
+static int GetImagesMaxDifference(Image a, Image b)
+{
+    int bytesPerPixel = GetPixelDataSize(1, 1, a.format);
+    int maxDifference = 0;
+
+    for (int i = 0; i < a.width*a.height; i++)
+    {
+        Color colA = GetPixelColor((unsigned char *)a.data + i*bytesPerPixel, a.format);
+        Color colB = GetPixelColor((unsigned char *)b.data + i*bytesPerPixel, b.format);
+        int channels[4] = { colA.r - colB.r, colA.g - colB.g, colA.b - colB.b, colA.a - colB.a };
+
+        for (int k = 0; k < 4; k++)
+        {
+            int difference = (channels[k] < 0)? -channels[k] : channels[k];
+            if (difference > maxDifference) maxDifference = difference;
+        }
+    }
+
+    return maxDifference;
+}
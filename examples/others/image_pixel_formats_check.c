@@ -0,0 +1,80 @@
+/*******************************************************************************************
+*
+*   raylib [others] example - Image pixel formats check
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Regression check for 16-bit packed pixel formats (R5G6B5, R5G5B5A1, R4G4B4A4):
+*   every possible pixel value is decoded with GetPixelColor() and checked against
+*   image processing and format conversion paths, no window required
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: printf()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int formats[3] = { PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4 };
+    const char *formatNames[3] = { "R5G6B5", "R5G5B5A1", "R4G4B4A4" };
+
+    int failed = 0;
+
+    SetTraceLogLevel(LOG_WARNING);
+    //--------------------------------------------------------------------------------------
+
+    // Checks
+    //--------------------------------------------------------------------------------------
+    for (int f = 0; f < 3; f++)
+    {
+        // Image containing every 16-bit pixel value (256x256)
+        Image image = GenImageColor(256, 256, BLANK);
+        ImageFormat(&image, formats[f]);
+
+        unsigned short *pixels = (unsigned short *)image.data;
+        for (int i = 0; i < 256*256; i++) pixels[i] = (unsigned short)i;
+
+        // Check 1: Tint by WHITE is an identity, pixels are decoded and encoded back unchanged
+        Image tinted = ImageCopy(image);
+        ImageColorTint(&tinted, WHITE);
+
+        int tintErrors = 0;
+        for (int i = 0; i < 256*256; i++) if (((unsigned short *)tinted.data)[i] != pixels[i]) tintErrors++;
+
+        // Check 2: Conversion to R8G8B8A8 matches GetPixelColor() for every pixel value
+        Image converted = ImageCopy(image);
+        ImageFormat(&converted, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+        int colorErrors = 0;
+        for (int i = 0; i < 256*256; i++)
+        {
+            Color expected = GetPixelColor(&pixels[i], formats[f]);
+            Color result = ((Color *)converted.data)[i];
+
+            if ((expected.r != result.r) || (expected.g != result.g) || (expected.b != result.b) || (expected.a != result.a)) colorErrors++;
+        }
+
+        printf("%-9s tint identity errors: %5i | GetPixelColor() mismatches: %5i\n", formatNames[f], tintErrors, colorErrors);
+        if ((tintErrors > 0) || (colorErrors > 0)) failed++;
+
+        UnloadImage(converted);
+        UnloadImage(tinted);
+        UnloadImage(image);
+    }
+
+    printf("%s\n", (failed == 0)? "PASSED" : "FAILED");
+    //--------------------------------------------------------------------------------------
+
+    return (failed == 0)? 0 : 1;
+}
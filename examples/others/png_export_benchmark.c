@@ -0,0 +1,178 @@
+/*******************************************************************************************
+*
+*   raylib [others] example - PNG export benchmark
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Benchmark of PNG encoding: ExportImageToMemory() (sdefl compression of row blocks in parallel,
+*   level selected with SetPngCompressionLevel()) against previous PNG writer (stb_image_write,
+*   stbi_write_png_to_mem()), encoding time and file size compared
+*
+*   NOTE: Row blocks are compressed by job system workers, initialized by InitWindow(),
+*   level 8 encoding takes some seconds per image on single core machines
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: free()
+
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "external/stb_image_write.h"   // Required for: stbi_write_png_to_mem()
+
+#define BENCHMARK_RUNS          2       // Encoding runs per image and method, best time kept
+#define BENCHMARK_IMAGES        3       // Images benchmarked
+#define BENCHMARK_METHODS       5       // Methods benchmarked: previous writer and 4 compression levels
+
+#define IMAGE_WIDTH          1280       // Benchmark images width
+#define IMAGE_HEIGHT          720       // Benchmark images height
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static Image GenImageSynthetic(int width, int height);          // Generate synthetic image: flat colors, gradients and patterns (screenshot-like)
+static unsigned char *ExportImagePrevious(Image image, int *fileSize); // Previous PNG writer, for reference
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [others] example - png export benchmark");
+
+    const char *imageNames[BENCHMARK_IMAGES] = { "perlin noise", "synthetic", "white noise" };
+    const char *methodNames[BENCHMARK_METHODS] = { "previous", "level 0", "level 1", "level 5", "level 8" };
+    const int levels[BENCHMARK_METHODS] = { -1, 0, 1, 5, 8 };
+
+    Image images[BENCHMARK_IMAGES] = {
+        GenImagePerlinNoise(IMAGE_WIDTH, IMAGE_HEIGHT, 0, 0, 4.0f),
+        GenImageSynthetic(IMAGE_WIDTH, IMAGE_HEIGHT),
+        GenImageWhiteNoise(IMAGE_WIDTH, IMAGE_HEIGHT, 0.5f)
+    };
+
+    double times[BENCHMARK_IMAGES][BENCHMARK_METHODS] = { 0 };
+    int sizes[BENCHMARK_IMAGES][BENCHMARK_METHODS] = { 0 };
+    bool run = true;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) run = true;
+
+        if (run)
+        {
+            for (int i = 0; i < BENCHMARK_IMAGES; i++)
+            {
+                for (int m = 0; m < BENCHMARK_METHODS; m++)
+                {
+                    times[i][m] = 0.0;
+
+                    if (levels[m] >= 0) SetPngCompressionLevel(levels[m]);
+
+                    for (int r = 0; r < BENCHMARK_RUNS; r++)
+                    {
+                        double startTime = GetTime();
+
+                        if (levels[m] < 0)
+                        {
+                            unsigned char *fileData = ExportImagePrevious(images[i], &sizes[i][m]);
+                            free(fileData);
+                        }
+                        else
+                        {
+                            unsigned char *fileData = ExportImageToMemory(images[i], ".png", &sizes[i][m]);
+                            MemFree(fileData);
+                        }
+
+                        double time = (GetTime() - startTime)*1000.0;
+                        if ((r == 0) || (time < times[i][m])) times[i][m] = time;
+                    }
+
+                    TraceLog(LOG_INFO, "BENCHMARK: %-12s %-8s %8.2f ms %10i bytes", imageNames[i], methodNames[m], times[i][m], sizes[i][m]);
+                }
+            }
+
+            SetPngCompressionLevel(1);      // Restore default compression level
+            run = false;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("%ix%i RGBA images, best of %i runs, press SPACE to run again", IMAGE_WIDTH, IMAGE_HEIGHT, BENCHMARK_RUNS), 20, 20, 20, DARKGRAY);
+
+            DrawText("image", 20, 70, 20, GRAY);
+            for (int m = 0; m < BENCHMARK_METHODS; m++) DrawText(methodNames[m], 170 + m*125, 70, 10, GRAY);
+
+            for (int i = 0; i < BENCHMARK_IMAGES; i++)
+            {
+                DrawText(imageNames[i], 20, 110 + i*80, 10, DARKGRAY);
+
+                for (int m = 0; m < BENCHMARK_METHODS; m++)
+                {
+                    DrawText(TextFormat("%.1f ms", times[i][m]), 170 + m*125, 105 + i*80, 20, (m == 0)? MAROON : DARKGREEN);
+                    DrawText(TextFormat("%i KB", sizes[i][m]/1024), 170 + m*125, 130 + i*80, 10, DARKBLUE);
+                }
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < BENCHMARK_IMAGES; i++) UnloadImage(images[i]);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Generate synthetic image: flat colors, gradients and patterns (screenshot-like)
+static Image GenImageSynthetic(int width, int height)
+{
+    Image image = GenImageGradientRadial(width, height, 0.2f, SKYBLUE, DARKBLUE);
+    Image checked = GenImageChecked(512, 512, 16, 16, RAYWHITE, DARKGRAY);
+
+    ImageDraw(&image, checked, (Rectangle){ 0, 0, 512, 512 }, (Rectangle){ 100, 120, 480, 480 }, WHITE);
+    ImageDrawRectangle(&image, 0, 0, width, 48, LIGHTGRAY);
+    ImageDrawRectangle(&image, 660, 120, 520, 400, RAYWHITE);
+
+    for (int i = 0; i < 16; i++) ImageDrawRectangle(&image, 680, 140 + i*22, 100 + (i*137)%380, 12, (i%2 == 0)? GRAY : MAROON);
+
+    UnloadImage(checked);
+
+    return image;
+}
+
+// Previous PNG writer, for reference
+// NOTE: stb_image_write zlib compression, default stbi_write_png_compression_level (8)
+static unsigned char *ExportImagePrevious(Image image, int *fileSize)
+{
+    // NOTE: Benchmark images are R8G8B8A8
+    return stbi_write_png_to_mem((const unsigned char *)image.data, image.width*4, image.width, image.height, 4, fileSize);
+}
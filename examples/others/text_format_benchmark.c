@@ -0,0 +1,189 @@
+/*******************************************************************************************
+*
+*   raylib [others] example - Text format benchmark
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Microbenchmark of text formatting: TextFormat() and TextFormatBuffer() (internal formatter,
+*   vsnprintf() only used as fallback) against previous TextFormat() implementation
+*   (static buffers ring cleared with memset() and formatted with vsnprintf())
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: vsnprintf(), sprintf()
+#include <stdarg.h>         // Required for: va_list, va_start(), va_end()
+#include <string.h>         // Required for: memset()
+
+#define FORMAT_ITERATIONS       200000      // Formatting calls per format and method
+#define FORMAT_CASES                 4      // Formats benchmarked
+
+#define PREVIOUS_BUFFERS             4      // Previous TextFormat() static buffers
+#define PREVIOUS_BUFFER_LENGTH    1024      // Previous TextFormat() buffer length (MAX_TEXT_BUFFER_LENGTH)
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static const char *TextFormatPrevious(const char *text, ...);   // Previous TextFormat() implementation, for reference
+static int FormatCase(int method, int formatCase, int i);       // Format benchmark case, returns formatted text length
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [others] example - text format benchmark");
+
+    const char *caseNames[FORMAT_CASES] = { "\"Score: %i  FPS: %.2f  Name: %s\"", "\"Frame %05d of %d\"", "\"%8.3f, %8.3f, %8.3f\"", "\"Item: %-12s|%4i\"" };
+    const char *methodNames[3] = { "previous", "TextFormat()", "TextFormatBuffer()" };
+
+    double times[FORMAT_CASES][3] = { 0 };
+    int checksum = 0;               // Formatted lengths sum, to keep results used
+    bool run = true;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) run = true;
+
+        if (run)
+        {
+            checksum = 0;
+
+            for (int c = 0; c < FORMAT_CASES; c++)
+            {
+                for (int m = 0; m < 3; m++)
+                {
+                    double startTime = GetTime();
+                    for (int i = 0; i < FORMAT_ITERATIONS; i++) checksum += FormatCase(m, c, i);
+                    times[c][m] = (GetTime() - startTime)*1000.0;
+
+                    TraceLog(LOG_INFO, "BENCHMARK: %-34s %-20s %8.2f ms", caseNames[c], methodNames[m], times[c][m]);
+                }
+            }
+
+            run = false;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("%i calls per format and method (ms), press SPACE to run again", FORMAT_ITERATIONS), 20, 20, 20, DARKGRAY);
+
+            DrawText("format", 20, 70, 20, GRAY);
+            for (int m = 0; m < 3; m++) DrawText(methodNames[m], 330 + m*150, 70, 10, GRAY);
+
+            for (int c = 0; c < FORMAT_CASES; c++)
+            {
+                DrawText(caseNames[c], 20, 110 + c*40, 10, DARKGRAY);
+
+                for (int m = 0; m < 3; m++)
+                {
+                    DrawText(TextFormat("%.2f", times[c][m]), 330 + m*150, 105 + c*40, 20, (m == 0)? MAROON : DARKGREEN);
+                }
+
+                if (times[c][1] > 0.0) DrawText(TextFormat("x%.1f", times[c][0]/times[c][1]), 740, 105 + c*40, 20, DARKBLUE);
+            }
+
+            DrawText(TextFormat("checksum: %i", checksum), 20, 410, 10, LIGHTGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Previous TextFormat() implementation, for reference
+static const char *TextFormatPrevious(const char *text, ...)
+{
+    static char buffers[PREVIOUS_BUFFERS][PREVIOUS_BUFFER_LENGTH] = { 0 };
+    static int index = 0;
+
+    char *currentBuffer = buffers[index];
+    memset(currentBuffer, 0, PREVIOUS_BUFFER_LENGTH);   // Clear buffer before using
+
+    va_list args;
+    va_start(args, text);
+    int requiredByteCount = vsnprintf(currentBuffer, PREVIOUS_BUFFER_LENGTH, text, args);
+    va_end(args);
+
+    // Inserting "..." at the end of the string to mark as truncated
+    if (requiredByteCount >= PREVIOUS_BUFFER_LENGTH) sprintf(buffers[index] + PREVIOUS_BUFFER_LENGTH - 4, "...");
+
+    index += 1;
+    if (index >= PREVIOUS_BUFFERS) index = 0;
+
+    return currentBuffer;
+}
+
+// Format benchmark case, returns formatted text length
+// NOTE: Method: 0-previous TextFormat(), 1-TextFormat(), 2-TextFormatBuffer()
+static int FormatCase(int method, int formatCase, int i)
+{
+    char buffer[128] = { 0 };
+    const char *text = NULL;
+    int length = 0;
+    float value = (float)i*0.37f;
+
+    switch (formatCase)
+    {
+        case 0:
+        {
+            if (method == 0) text = TextFormatPrevious("Score: %i  FPS: %.2f  Name: %s", i, value, "player");
+            else if (method == 1) text = TextFormat("Score: %i  FPS: %.2f  Name: %s", i, value, "player");
+            else length = TextFormatBuffer(buffer, 128, "Score: %i  FPS: %.2f  Name: %s", i, value, "player");
+        } break;
+        case 1:
+        {
+            if (method == 0) text = TextFormatPrevious("Frame %05d of %d", i, FORMAT_ITERATIONS);
+            else if (method == 1) text = TextFormat("Frame %05d of %d", i, FORMAT_ITERATIONS);
+            else length = TextFormatBuffer(buffer, 128, "Frame %05d of %d", i, FORMAT_ITERATIONS);
+        } break;
+        case 2:
+        {
+            if (method == 0) text = TextFormatPrevious("%8.3f, %8.3f, %8.3f", value, -value, value*0.5f);
+            else if (method == 1) text = TextFormat("%8.3f, %8.3f, %8.3f", value, -value, value*0.5f);
+            else length = TextFormatBuffer(buffer, 128, "%8.3f, %8.3f, %8.3f", value, -value, value*0.5f);
+        } break;
+        case 3:
+        {
+            if (method == 0) text = TextFormatPrevious("Item: %-12s|%4i", "sword", i%1000);
+            else if (method == 1) text = TextFormat("Item: %-12s|%4i", "sword", i%1000);
+            else length = TextFormatBuffer(buffer, 128, "Item: %-12s|%4i", "sword", i%1000);
+        } break;
+        default: break;
+    }
+
+    if (text != NULL) length = TextLength(text);
+
+    return length;
+}
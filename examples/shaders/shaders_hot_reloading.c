@@ -5,7 +5,7 @@
 *   NOTE: This example requires raylib OpenGL 3.3 for shaders support and only #version 330
 *         is currently supported. OpenGL ES 2.0 platforms are not supported at the moment.
 *
-*   Example originally created with raylib 3.0, last time updated with raylib 3.5
+*   Example originally created with raylib 3.0, last time updated with raylib 5.5
 *
 *   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
 *   BSD-like license that allows static linking with closed source software
@@ -40,6 +40,10 @@ int main(void)
     const char *fragShaderFileName = "resources/shaders/glsl%i/reload.fs";
     time_t fragShaderFileModTime = GetFileModTime(TextFormat(fragShaderFileName, GLSL_VERSION));
 
+    // Watch shader file for changes, no need to check file modification time every frame
+    WatchFile(TextFormat(fragShaderFileName, GLSL_VERSION));
+    bool fragShaderFileChanged = false;
+
     // Load raymarching shader
     // NOTE: Defining 0 (NULL) for vertex shader forces usage of internal default vertex shader
     Shader shader = LoadShader(0, TextFormat(fragShaderFileName, GLSL_VERSION));
@@ -71,33 +75,31 @@ int main(void)
         SetShaderValue(shader, timeLoc, &totalTime, SHADER_UNIFORM_FLOAT);
         SetShaderValue(shader, mouseLoc, mousePos, SHADER_UNIFORM_VEC2);
 
+        // Check for shader file changes
+        if (PollFileChanges().count > 0) fragShaderFileChanged = true;
+
         // Hot shader reloading
-        if (shaderAutoReloading || (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)))
+        if (fragShaderFileChanged && (shaderAutoReloading || (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))))
         {
-            long currentFragShaderModTime = GetFileModTime(TextFormat(fragShaderFileName, GLSL_VERSION));
+            // Try reloading updated shader
+            Shader updatedShader = LoadShader(0, TextFormat(fragShaderFileName, GLSL_VERSION));
 
-            // Check if shader file has been modified
-            if (currentFragShaderModTime != fragShaderFileModTime)
+            if (updatedShader.id != rlGetShaderIdDefault())      // It was correctly loaded
             {
-                // Try reloading updated shader
-                Shader updatedShader = LoadShader(0, TextFormat(fragShaderFileName, GLSL_VERSION));
-
-                if (updatedShader.id != rlGetShaderIdDefault())      // It was correctly loaded
-                {
-                    UnloadShader(shader);
-                    shader = updatedShader;
+                UnloadShader(shader);
+                shader = updatedShader;
 
-                    // Get shader locations for required uniforms
-                    resolutionLoc = GetShaderLocation(shader, "resolution");
-                    mouseLoc = GetShaderLocation(shader, "mouse");
-                    timeLoc = GetShaderLocation(shader, "time");
+                // Get shader locations for required uniforms
+                resolutionLoc = GetShaderLocation(shader, "resolution");
+                mouseLoc = GetShaderLocation(shader, "mouse");
+                timeLoc = GetShaderLocation(shader, "time");
 
-                    // Reset required uniforms
-                    SetShaderValue(shader, resolutionLoc, resolution, SHADER_UNIFORM_VEC2);
-                }
-
-                fragShaderFileModTime = currentFragShaderModTime;
+                // Reset required uniforms
+                SetShaderValue(shader, resolutionLoc, resolution, SHADER_UNIFORM_VEC2);
             }
+
+            fragShaderFileModTime = GetFileModTime(TextFormat(fragShaderFileName, GLSL_VERSION));
+            fragShaderFileChanged = false;
         }
 
         if (IsKeyPressed(KEY_A)) shaderAutoReloading = !shaderAutoReloading;
@@ -127,6 +129,7 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadShader(shader);           // Unload shader
+    UnwatchFiles();                 // Stop watching shader file
 
     CloseWindow();                  // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -2,7 +2,7 @@
 *
 *   raylib [textures] example - gif playing
 *
-*   Example originally created with raylib 4.2, last time updated with raylib 4.2
+*   Example originally created with raylib 4.2, last time updated with raylib 5.5
 *
 *   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
 *   BSD-like license that allows static linking with closed source software
@@ -28,22 +28,17 @@ int main(void)
 
     InitWindow(screenWidth, screenHeight, "raylib [textures] example - gif playing");
 
-    int animFrames = 0;
+    // Load GIF animation stream, frames are decoded on demand into a single frame image
+    // NOTE: GIF frames are always decoded as RGBA (32bit)
+    // NOTE: Memory used does not depend on animation frames count
+    ImageAnimStream scarfyAnim = LoadImageAnimStream("resources/scarfy_run.gif");
 
-    // Load all GIF animation frames into a single Image
-    // NOTE: GIF data is always loaded as RGBA (32bit) by default
-    // NOTE: Frames are just appended one after another in image.data memory
-    Image imScarfyAnim = LoadImageAnim("resources/scarfy_run.gif", &animFrames);
-
-    // Load texture from image
+    // Load texture from current frame image
     // NOTE: We will update this texture when required with next frame data
     // WARNING: It's not recommended to use this technique for sprites animation,
     // use spritesheets instead, like illustrated in textures_sprite_anim example
-    Texture2D texScarfyAnim = LoadTextureFromImage(imScarfyAnim);
-
-    unsigned int nextFrameDataOffset = 0;  // Current byte offset to next frame in image.data
+    Texture2D texScarfyAnim = LoadTextureFromImage(scarfyAnim.frame);
 
-    int currentAnimFrame = 0;       // Current animation frame to load and draw
     int frameDelay = 8;             // Frame delay to switch between animation frames
     int frameCounter = 0;           // General frames counter
 
@@ -58,17 +53,13 @@ int main(void)
         frameCounter++;
         if (frameCounter >= frameDelay)
         {
-            // Move to next frame
+            // Move to next frame, decoded into stream frame image
             // NOTE: If final frame is reached we return to first frame
-            currentAnimFrame++;
-            if (currentAnimFrame >= animFrames) currentAnimFrame = 0;
-
-            // Get memory offset position for next frame data in image.data
-            nextFrameDataOffset = imScarfyAnim.width*imScarfyAnim.height*4*currentAnimFrame;
+            UpdateImageAnimStream(&scarfyAnim);
 
             // Update GPU texture data with next frame image data
             // WARNING: Data size (frame size) and pixel format must match already created texture
-            UpdateTexture(texScarfyAnim, ((unsigned char *)imScarfyAnim.data) + nextFrameDataOffset);
+            UpdateTexture(texScarfyAnim, scarfyAnim.frame.data);
 
             frameCounter = 0;
         }
@@ -87,9 +78,9 @@ int main(void)
 
             ClearBackground(RAYWHITE);
 
-            DrawText(TextFormat("TOTAL GIF FRAMES:  %02i", animFrames), 50, 30, 20, LIGHTGRAY);
-            DrawText(TextFormat("CURRENT FRAME: %02i", currentAnimFrame), 50, 60, 20, GRAY);
-            DrawText(TextFormat("CURRENT FRAME IMAGE.DATA OFFSET: %02i", nextFrameDataOffset), 50, 90, 20, GRAY);
+            DrawText(TextFormat("TOTAL GIF FRAMES:  %02i", scarfyAnim.frameCount), 50, 30, 20, LIGHTGRAY);
+            DrawText(TextFormat("CURRENT FRAME: %02i", scarfyAnim.currentFrame), 50, 60, 20, GRAY);
+            DrawText(TextFormat("CURRENT FRAME GIF DELAY: %i ms", (int)(scarfyAnim.frameDelay*1000.0f)), 50, 90, 20, GRAY);
 
             DrawText("FRAMES DELAY: ", 100, 305, 10, DARKGRAY);
             DrawText(TextFormat("%02i frames", frameDelay), 620, 305, 10, DARKGRAY);
@@ -112,7 +103,7 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadTexture(texScarfyAnim);   // Unload texture
-    UnloadImage(imScarfyAnim);      // Unload image (contains all frames)
+    UnloadImageAnimStream(scarfyAnim);  // Unload animation stream
 
     CloseWindow();                  // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -66,6 +66,12 @@
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Support job system: worker threads, jobs submission, completion counters and parallel-for
+// NOTE: Also used internally to split CPU-heavy work, it requires InitJobSystem(), jobs run synchronously otherwise
+#define SUPPORT_JOB_SYSTEM              1
+// Support resources registry: live textures, render textures, buffers, shaders and audio buffers are counted
+// and their memory estimated per type, resources not unloaded are reported on CloseWindow()
+//#define SUPPORT_RESOURCE_TRACKING       1
 // Support custom frame control, only for advanced users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -73,7 +79,7 @@
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_FILEPATH_CAPACITY        8192       // Maximum file paths capacity
+#define MAX_FILEPATH_CAPACITY        8192       // Initial file paths capacity (grown on demand)
 #define MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths (Linux PATH_MAX default value)
 
 #define MAX_KEYBOARD_KEYS             512       // Maximum number of keyboard keys supported
@@ -85,11 +91,17 @@
 #define MAX_TOUCH_POINTS                8       // Maximum number of touch points supported
 #define MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
+#define MAX_INPUT_EVENTS              512       // Maximum number of timestamped input events queued, power of two (EnableInputEvents())
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
 
+#define MAX_FILE_WATCH_POLL_COUNT      64       // Maximum number of watched paths checked per PollFileChanges() call (polling mode)
+
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_JOB_WORKERS                64       // Maximum number of job system worker threads
+#define ASYNC_UPLOAD_BUDGET          2.0f       // Default async assets GPU upload time budget per frame in milliseconds
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -177,6 +189,7 @@
 //#define SUPPORT_FILEFORMAT_HDR      1
 //#define SUPPORT_FILEFORMAT_PIC          1
 //#define SUPPORT_FILEFORMAT_KTX      1
+#define SUPPORT_FILEFORMAT_KTX2     1
 //#define SUPPORT_FILEFORMAT_ASTC     1
 //#define SUPPORT_FILEFORMAT_PKM      1
 //#define SUPPORT_FILEFORMAT_PVR      1
@@ -213,7 +226,7 @@
 
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
+#define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers (per-thread) used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
 
@@ -275,5 +288,10 @@
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_TRACELOG_ASYNC_RECORDS    256       // Max trace-log messages queued for async output, SetTraceLogAsync() (power of two)
+#define TRACELOG_MIN_LEVEL        LOG_ALL       // Minimum TRACELOG() level compiled in (TraceLogLevel), lower level messages are removed
+#define TEMP_MEMORY_BLOCK_SIZE     262144       // Temporary memory arena block size in bytes (RL_TEMP_ALLOC())
+#define MAX_TEMP_MEMORY_SCOPES         16       // Maximum nested temporary memory scopes per thread
+#define TEMP_MEMORY_SHRINK_FRAMES     120       // Frames below default block size usage before frame temporary memory shrinks back
 
 #endif // CONFIG_H
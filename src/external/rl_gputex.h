@@ -7,6 +7,8 @@
 *     Load GPU compressed image data from image files provided as memory data arrays,
 *     data is loaded compressed, ready to be loaded into GPU.
 *
+*     Save image data (including mipmaps) as DDS and KTX 2.0 files data, ready to be loaded into GPU.
+*
 *     Note that some file formats (DDS, PVR, KTX) also support uncompressed data storage.
 *     In those cases data is loaded uncompressed and format is returned.
 *
@@ -19,6 +21,7 @@
 *   #define RL_GPUTEX_SUPPORT_DDS
 *   #define RL_GPUTEX_SUPPORT_PKM
 *   #define RL_GPUTEX_SUPPORT_KTX
+*   #define RL_GPUTEX_SUPPORT_KTX2
 *   #define RL_GPUTEX_SUPPORT_PVR
 *   #define RL_GPUTEX_SUPPORT_ASTC
 *       Define desired file formats to be supported
@@ -65,8 +68,15 @@ RLAPI void *rl_load_pkm_from_memory(const unsigned char *file_data, unsigned int
 RLAPI void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_pvr_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
+RLAPI void *rl_load_ktx2_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
+
+// Get image data from memory data files, pointing to file data (no data copy), NULL if data requires reordering
+RLAPI const void *rl_get_dds_data_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
+RLAPI const void *rl_get_ktx2_data_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 
 RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
+RLAPI unsigned char *rl_save_dds_to_memory(const void *data, int width, int height, int format, int mipmaps, int *file_size);   // Save image data as DDS file data
+RLAPI unsigned char *rl_save_ktx2_to_memory(const void *data, int width, int height, int format, int mipmaps, int *file_size);  // Save image data as KTX 2.0 file data
 
 #if defined(__cplusplus)
 }
@@ -102,193 +112,441 @@ static int get_pixel_data_size(int width, int height, int format);
 // Module Functions Definition
 //----------------------------------------------------------------------------------
 #if defined(RL_GPUTEX_SUPPORT_DDS)
-// Loading DDS from memory image data (compressed or uncompressed)
-void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
+// Required extension:
+// GL_EXT_texture_compression_s3tc
+
+// Supported tokens (defined by extensions)
+// GL_COMPRESSED_RGB_S3TC_DXT1_EXT      0x83F0
+// GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
+// GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
+// GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
+
+#define FOURCC_DXT1 0x31545844      // Equivalent to "DXT1" in ASCII
+#define FOURCC_DXT3 0x33545844      // Equivalent to "DXT3" in ASCII
+#define FOURCC_DXT5 0x35545844      // Equivalent to "DXT5" in ASCII
+#define FOURCC_DX10 0x30315844      // Equivalent to "DX10" in ASCII, DX10 header extension available
+#define FOURCC_R16F             111 // D3DFMT_R16F
+#define FOURCC_A16B16G16R16F    113 // D3DFMT_A16B16G16R16F
+#define FOURCC_R32F             114 // D3DFMT_R32F
+#define FOURCC_A32B32G32R32F    116 // D3DFMT_A32B32G32R32F
+
+// DDS header flags
+#define DDSD_CAPS               0x1
+#define DDSD_HEIGHT             0x2
+#define DDSD_WIDTH              0x4
+#define DDSD_PITCH              0x8
+#define DDSD_PIXELFORMAT        0x1000
+#define DDSD_MIPMAPCOUNT        0x20000
+#define DDSD_LINEARSIZE         0x80000
+
+// DDS pixel format flags
+#define DDPF_ALPHAPIXELS        0x1
+#define DDPF_FOURCC             0x4
+#define DDPF_RGB                0x40
+#define DDPF_LUMINANCE          0x20000
+
+// DDS caps flags
+#define DDSCAPS_COMPLEX         0x8
+#define DDSCAPS_TEXTURE         0x1000
+#define DDSCAPS_MIPMAP          0x400000
+
+// DDS pixel data conversion required to match raylib pixel formats
+#define DDS_CONVERSION_NONE         0
+#define DDS_CONVERSION_BGR          1   // B8G8R8 <-> R8G8B8
+#define DDS_CONVERSION_BGRA         2   // B8G8R8A8 <-> R8G8B8A8
+#define DDS_CONVERSION_A1R5G5B5     3   // A1R5G5B5 <-> R5G5B5A1
+#define DDS_CONVERSION_A4R4G4B4     4   // A4R4G4B4 <-> R4G4B4A4
+
+// DDS Pixel Format
+typedef struct {
+    unsigned int size;
+    unsigned int flags;
+    unsigned int fourcc;
+    unsigned int rgb_bit_count;
+    unsigned int r_bit_mask;
+    unsigned int g_bit_mask;
+    unsigned int b_bit_mask;
+    unsigned int a_bit_mask;
+} dds_pixel_format;
+
+// DDS Header (124 bytes)
+typedef struct {
+    unsigned int size;
+    unsigned int flags;
+    unsigned int height;
+    unsigned int width;
+    unsigned int pitch_or_linear_size;
+    unsigned int depth;
+    unsigned int mipmap_count;
+    unsigned int reserved1[11];
+    dds_pixel_format ddspf;
+    unsigned int caps;
+    unsigned int caps2;
+    unsigned int caps3;
+    unsigned int caps4;
+    unsigned int reserved2;
+} dds_header;
+
+// DDS DX10 Header extension (20 bytes)
+typedef struct {
+    unsigned int dxgi_format;
+    unsigned int resource_dimension;    // 3 for 2D textures
+    unsigned int misc_flag;
+    unsigned int array_size;
+    unsigned int misc_flags2;
+} dds_header_dx10;
+
+// Get DDS image data from memory file data (no data copy)
+// NOTE: Data size includes all mipmaps available, conversion is set if pixel data must be reordered to match format
+static const unsigned char *get_dds_data(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips, int *data_size, int *conversion)
 {
-    void *image_data = NULL;        // Image data pointer
-    int image_pixel_size = 0;       // Image pixel size
+    const unsigned char *image_data = NULL;     // Image data pointer (file data)
 
-    unsigned char *file_data_ptr = (unsigned char *)file_data;
-
-    // Required extension:
-    // GL_EXT_texture_compression_s3tc
+    *format = 0;
+    *data_size = 0;
+    *conversion = DDS_CONVERSION_NONE;
 
-    // Supported tokens (defined by extensions)
-    // GL_COMPRESSED_RGB_S3TC_DXT1_EXT      0x83F0
-    // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
-    // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
-    // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
+    // Verify the type of file
+    if ((file_data == NULL) || (file_size < (4 + sizeof(dds_header))) ||
+        (file_data[0] != 'D') || (file_data[1] != 'D') || (file_data[2] != 'S') || (file_data[3] != ' '))
+    {
+        LOG("WARNING: IMAGE: DDS file data not valid");
+    }
+    else
+    {
+        const dds_header *header = (const dds_header *)(file_data + 4);
+        unsigned int header_size = 4 + sizeof(dds_header);
 
-    #define FOURCC_DXT1 0x31545844  // Equivalent to "DXT1" in ASCII
-    #define FOURCC_DXT3 0x33545844  // Equivalent to "DXT3" in ASCII
-    #define FOURCC_DXT5 0x35545844  // Equivalent to "DXT5" in ASCII
+        *width = header->width;
+        *height = header->height;
 
-    // DDS Pixel Format
-    typedef struct {
-        unsigned int size;
-        unsigned int flags;
-        unsigned int fourcc;
-        unsigned int rgb_bit_count;
-        unsigned int r_bit_mask;
-        unsigned int g_bit_mask;
-        unsigned int b_bit_mask;
-        unsigned int a_bit_mask;
-    } dds_pixel_format;
-
-    // DDS Header (124 bytes)
-    typedef struct {
-        unsigned int size;
-        unsigned int flags;
-        unsigned int height;
-        unsigned int width;
-        unsigned int pitch_or_linear_size;
-        unsigned int depth;
-        unsigned int mipmap_count;
-        unsigned int reserved1[11];
-        dds_pixel_format ddspf;
-        unsigned int caps;
-        unsigned int caps2;
-        unsigned int caps3;
-        unsigned int caps4;
-        unsigned int reserved2;
-    } dds_header;
+        if (header->mipmap_count == 0) *mips = 1;   // Parameter not used
+        else *mips = header->mipmap_count;
 
-    if (file_data_ptr != NULL)
-    {
-        // Verify the type of file
-        unsigned char *dds_header_id = file_data_ptr;
-        file_data_ptr += 4;
+        if (header->ddspf.flags & DDPF_FOURCC)      // Compressed or floating point
+        {
+            switch (header->ddspf.fourcc)
+            {
+                case FOURCC_DXT1: *format = (header->ddspf.flags & DDPF_ALPHAPIXELS)? PIXELFORMAT_COMPRESSED_DXT1_RGBA : PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
+                case FOURCC_DXT3: *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+                case FOURCC_DXT5: *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+                case FOURCC_R16F: *format = PIXELFORMAT_UNCOMPRESSED_R16; break;
+                case FOURCC_A16B16G16R16F: *format = PIXELFORMAT_UNCOMPRESSED_R16G16B16A16; break;
+                case FOURCC_R32F: *format = PIXELFORMAT_UNCOMPRESSED_R32; break;
+                case FOURCC_A32B32G32R32F: *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;
+                case FOURCC_DX10:
+                {
+                    if (file_size >= (header_size + sizeof(dds_header_dx10)))
+                    {
+                        const dds_header_dx10 *header_dx10 = (const dds_header_dx10 *)(file_data + header_size);
+                        header_size += sizeof(dds_header_dx10);
 
-        if ((dds_header_id[0] != 'D') || (dds_header_id[1] != 'D') || (dds_header_id[2] != 'S') || (dds_header_id[3] != ' '))
+                        // NOTE: Only 2D textures (no arrays) supported, DXGI formats matching raylib pixel formats
+                        if (header_dx10->array_size <= 1)
+                        {
+                            switch (header_dx10->dxgi_format)
+                            {
+                                case 2: *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;     // DXGI_FORMAT_R32G32B32A32_FLOAT
+                                case 6: *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;        // DXGI_FORMAT_R32G32B32_FLOAT
+                                case 10: *format = PIXELFORMAT_UNCOMPRESSED_R16G16B16A16; break;    // DXGI_FORMAT_R16G16B16A16_FLOAT
+                                case 28:                                                            // DXGI_FORMAT_R8G8B8A8_UNORM
+                                case 29: *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;        // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+                                case 41: *format = PIXELFORMAT_UNCOMPRESSED_R32; break;             // DXGI_FORMAT_R32_FLOAT
+                                case 49: *format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;      // DXGI_FORMAT_R8G8_UNORM
+                                case 54: *format = PIXELFORMAT_UNCOMPRESSED_R16; break;             // DXGI_FORMAT_R16_FLOAT
+                                case 61: *format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;       // DXGI_FORMAT_R8_UNORM
+                                case 71:                                                            // DXGI_FORMAT_BC1_UNORM
+                                case 72: *format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;         // DXGI_FORMAT_BC1_UNORM_SRGB
+                                case 74:                                                            // DXGI_FORMAT_BC2_UNORM
+                                case 75: *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;         // DXGI_FORMAT_BC2_UNORM_SRGB
+                                case 77:                                                            // DXGI_FORMAT_BC3_UNORM
+                                case 78: *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;         // DXGI_FORMAT_BC3_UNORM_SRGB
+                                default: break;
+                            }
+                        }
+                    }
+                } break;
+                default: break;
+            }
+        }
+        else if (header->ddspf.flags & DDPF_RGB)    // Uncompressed
         {
-            LOG("WARNING: IMAGE: DDS file data not valid");
+            if (header->ddspf.rgb_bit_count == 16)
+            {
+                if (!(header->ddspf.flags & DDPF_ALPHAPIXELS)) *format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                else if (header->ddspf.a_bit_mask == 0x8000)        // 1bit alpha
+                {
+                    *format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+                    *conversion = DDS_CONVERSION_A1R5G5B5;
+                }
+                else if (header->ddspf.a_bit_mask == 0xf000)        // 4bit alpha
+                {
+                    *format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+                    *conversion = DDS_CONVERSION_A4R4G4B4;
+                }
+            }
+            else if (header->ddspf.rgb_bit_count == 24)
+            {
+                *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+                if (header->ddspf.r_bit_mask == 0xff0000) *conversion = DDS_CONVERSION_BGR;
+            }
+            else if (header->ddspf.rgb_bit_count == 32)
+            {
+                // NOTE: DirectX understands ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA,
+                // data is reordered unless masks define R8G8B8A8 memory layout
+                *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                if (header->ddspf.r_bit_mask != 0xff) *conversion = DDS_CONVERSION_BGRA;
+            }
         }
+        else if (header->ddspf.flags & DDPF_LUMINANCE)  // Uncompressed luminance
+        {
+            if (header->ddspf.rgb_bit_count == 8) *format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+            else if ((header->ddspf.rgb_bit_count == 16) && (header->ddspf.flags & DDPF_ALPHAPIXELS)) *format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        }
+
+        if (*format == 0) LOG("WARNING: IMAGE: DDS file pixel format not supported");
         else
         {
-            dds_header *header = (dds_header *)file_data_ptr;
+            // Get data size for all the mipmaps available in file data
+            int level_width = *width;
+            int level_height = *height;
+            int level = 0;
 
-            file_data_ptr += sizeof(dds_header);        // Skip header
+            for (; level < *mips; level++)
+            {
+                int level_size = get_pixel_data_size(level_width, level_height, *format);
 
-            *width = header->width;
-            *height = header->height;
+                if ((header_size + *data_size + level_size) > file_size) break;
 
-            if (*width % 4 != 0) LOG("WARNING: IMAGE: DDS file width must be multiple of 4. Image will not display correctly");
-            if (*height % 4 != 0) LOG("WARNING: IMAGE: DDS file height must be multiple of 4. Image will not display correctly");
+                *data_size += level_size;
+                level_width = (level_width > 1)? level_width/2 : 1;
+                level_height = (level_height > 1)? level_height/2 : 1;
+            }
 
-            image_pixel_size = header->width*header->height;
+            if (level == 0) LOG("WARNING: IMAGE: DDS file data size not valid");
+            else
+            {
+                if (level < *mips) LOG("WARNING: IMAGE: DDS file mipmaps data not complete, %i of %i mipmaps loaded", level, *mips);
 
-            if (header->mipmap_count == 0) *mips = 1;   // Parameter not used
-            else *mips = header->mipmap_count;
+                *mips = level;
+                image_data = file_data + header_size;
+            }
+        }
+    }
 
-            if (header->ddspf.rgb_bit_count == 16)      // 16bit mode, no compressed
-            {
-                if (header->ddspf.flags == 0x40)        // No alpha channel
-                {
-                    int data_size = image_pixel_size*sizeof(unsigned short);
-                    image_data = RL_MALLOC(data_size);
+    if (image_data == NULL) *format = 0;
 
-                    memcpy(image_data, file_data_ptr, data_size);
+    return image_data;
+}
 
-                    *format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
-                }
-                else if (header->ddspf.flags == 0x41)           // With alpha channel
-                {
-                    if (header->ddspf.a_bit_mask == 0x8000)     // 1bit alpha
-                    {
-                        int data_size = image_pixel_size*sizeof(unsigned short);
-                        image_data = RL_MALLOC(data_size);
+// Reorder DDS pixel data from/to raylib pixel formats
+static void convert_dds_data(unsigned char *data, int data_size, int conversion, int to_dds)
+{
+    unsigned short *data16 = (unsigned short *)data;
 
-                        memcpy(image_data, file_data_ptr, data_size);
+    switch (conversion)
+    {
+        case DDS_CONVERSION_BGR:
+        {
+            for (int i = 0; i < data_size - 2; i += 3) { unsigned char r = data[i]; data[i] = data[i + 2]; data[i + 2] = r; }
+        } break;
+        case DDS_CONVERSION_BGRA:
+        {
+            for (int i = 0; i < data_size - 3; i += 4) { unsigned char r = data[i]; data[i] = data[i + 2]; data[i + 2] = r; }
+        } break;
+        case DDS_CONVERSION_A1R5G5B5:
+        {
+            for (int i = 0; i < data_size/2; i++)
+            {
+                if (to_dds) data16[i] = (unsigned short)((data16[i] >> 1) | (data16[i] << 15));
+                else data16[i] = (unsigned short)((data16[i] << 1) | (data16[i] >> 15));
+            }
+        } break;
+        case DDS_CONVERSION_A4R4G4B4:
+        {
+            for (int i = 0; i < data_size/2; i++)
+            {
+                if (to_dds) data16[i] = (unsigned short)((data16[i] >> 4) | (data16[i] << 12));
+                else data16[i] = (unsigned short)((data16[i] << 4) | (data16[i] >> 12));
+            }
+        } break;
+        default: break;
+    }
+}
 
-                        unsigned char alpha = 0;
+// Loading DDS from memory image data (compressed or uncompressed)
+// NOTE: All mipmaps available in file data are loaded
+void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
+{
+    void *image_data = NULL;        // Image data pointer
+    int data_size = 0;
+    int conversion = DDS_CONVERSION_NONE;
 
-                        // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1
-                        for (int i = 0; i < image_pixel_size; i++)
-                        {
-                            alpha = ((unsigned short *)image_data)[i] >> 15;
-                            ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 1;
-                            ((unsigned short *)image_data)[i] += alpha;
-                        }
+    const unsigned char *dds_data = get_dds_data(file_data, file_size, width, height, format, mips, &data_size, &conversion);
 
-                        *format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
-                    }
-                    else if (header->ddspf.a_bit_mask == 0xf000)   // 4bit alpha
-                    {
-                        int data_size = image_pixel_size*sizeof(unsigned short);
-                        image_data = RL_MALLOC(data_size);
+    if (dds_data != NULL)
+    {
+        image_data = RL_MALLOC(data_size);
+        memcpy(image_data, dds_data, data_size);
 
-                        memcpy(image_data, file_data_ptr, data_size);
+        convert_dds_data((unsigned char *)image_data, data_size, conversion, 0);
+    }
 
-                        unsigned char alpha = 0;
+    return image_data;
+}
 
-                        // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4
-                        for (int i = 0; i < image_pixel_size; i++)
-                        {
-                            alpha = ((unsigned short *)image_data)[i] >> 12;
-                            ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 4;
-                            ((unsigned short *)image_data)[i] += alpha;
-                        }
+// Get DDS image data from memory, pointing to file data (no data copy), i.e. GPU upload from memory-mapped file
+// NOTE: Returns NULL if pixel data requires reordering (format is still returned, 0 if file data is not valid)
+const void *rl_get_dds_data_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
+{
+    int data_size = 0;
+    int conversion = DDS_CONVERSION_NONE;
 
-                        *format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
-                    }
-                }
-            }
-            else if ((header->ddspf.flags == 0x40) && (header->ddspf.rgb_bit_count == 24))   // DDS_RGB, no compressed
-            {
-                int data_size = image_pixel_size*3*sizeof(unsigned char);
-                image_data = RL_MALLOC(data_size);
+    const unsigned char *dds_data = get_dds_data(file_data, file_size, width, height, format, mips, &data_size, &conversion);
 
-                memcpy(image_data, file_data_ptr, data_size);
+    return (conversion == DDS_CONVERSION_NONE)? dds_data : NULL;
+}
 
-                *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
-            }
-            else if ((header->ddspf.flags == 0x41) && (header->ddspf.rgb_bit_count == 32)) // DDS_RGBA, no compressed
-            {
-                int data_size = image_pixel_size*4*sizeof(unsigned char);
-                image_data = RL_MALLOC(data_size);
+// Save image data as DDS file into memory buffer, including all mipmaps
+// NOTE: Uncompressed pixel data is stored using raylib pixel formats channels masks, floating point formats
+// use D3DFMT codes and DX10 header extension (R32G32B32), ETC, PVRT and ASTC formats not supported by DDS
+unsigned char *rl_save_dds_to_memory(const void *data, int width, int height, int format, int mipmaps, int *file_size)
+{
+    unsigned char *file_data = NULL;
+    dds_header header = { 0 };
+    dds_header_dx10 header_dx10 = { 0 };
+    int conversion = DDS_CONVERSION_NONE;
 
-                memcpy(image_data, file_data_ptr, data_size);
+    *file_size = 0;
+    if (mipmaps < 1) mipmaps = 1;
 
-                unsigned char blue = 0;
+    header.size = sizeof(dds_header);
+    header.flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT;
+    header.width = width;
+    header.height = height;
+    header.mipmap_count = mipmaps;
+    header.ddspf.size = sizeof(dds_pixel_format);
+    header.caps = DDSCAPS_TEXTURE;
 
-                // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
-                // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
-                // So, we must realign B8G8R8A8 to R8G8B8A8
-                for (int i = 0; i < image_pixel_size*4; i += 4)
-                {
-                    blue = ((unsigned char *)image_data)[i];
-                    ((unsigned char *)image_data)[i] = ((unsigned char *)image_data)[i + 2];
-                    ((unsigned char *)image_data)[i + 2] = blue;
-                }
+    if (mipmaps > 1)
+    {
+        header.flags |= DDSD_MIPMAPCOUNT;
+        header.caps |= (DDSCAPS_COMPLEX | DDSCAPS_MIPMAP);
+    }
 
-                *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-            }
-            else if (((header->ddspf.flags == 0x04) || (header->ddspf.flags == 0x05)) && (header->ddspf.fourcc > 0)) // Compressed
-            {
-                // NOTE: This forces only 1 mipmap to be loaded which is not really correct but it works
-                int data_size = (header->pitch_or_linear_size < file_size - 0x80) ? header->pitch_or_linear_size : file_size - 0x80;
-                *mips = 1;
+    dds_pixel_format *ddspf = &header.ddspf;
 
-                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: ddspf->flags = DDPF_LUMINANCE; ddspf->rgb_bit_count = 8; ddspf->r_bit_mask = 0xff; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            ddspf->flags = DDPF_LUMINANCE | DDPF_ALPHAPIXELS;
+            ddspf->rgb_bit_count = 16;
+            ddspf->r_bit_mask = 0xff;
+            ddspf->a_bit_mask = 0xff00;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            ddspf->flags = DDPF_RGB;
+            ddspf->rgb_bit_count = 16;
+            ddspf->r_bit_mask = 0xf800;
+            ddspf->g_bit_mask = 0x07e0;
+            ddspf->b_bit_mask = 0x001f;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            ddspf->flags = DDPF_RGB | DDPF_ALPHAPIXELS;
+            ddspf->rgb_bit_count = 16;
+            ddspf->r_bit_mask = 0x7c00;
+            ddspf->g_bit_mask = 0x03e0;
+            ddspf->b_bit_mask = 0x001f;
+            ddspf->a_bit_mask = 0x8000;
+            conversion = DDS_CONVERSION_A1R5G5B5;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            ddspf->flags = DDPF_RGB | DDPF_ALPHAPIXELS;
+            ddspf->rgb_bit_count = 16;
+            ddspf->r_bit_mask = 0x0f00;
+            ddspf->g_bit_mask = 0x00f0;
+            ddspf->b_bit_mask = 0x000f;
+            ddspf->a_bit_mask = 0xf000;
+            conversion = DDS_CONVERSION_A4R4G4B4;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            ddspf->flags = DDPF_RGB;
+            ddspf->rgb_bit_count = 24;
+            ddspf->r_bit_mask = 0xff;
+            ddspf->g_bit_mask = 0xff00;
+            ddspf->b_bit_mask = 0xff0000;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ddspf->flags = DDPF_RGB | DDPF_ALPHAPIXELS;
+            ddspf->rgb_bit_count = 32;
+            ddspf->r_bit_mask = 0xff;
+            ddspf->g_bit_mask = 0xff00;
+            ddspf->b_bit_mask = 0xff0000;
+            ddspf->a_bit_mask = 0xff000000;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: ddspf->flags = DDPF_FOURCC; ddspf->fourcc = FOURCC_R32F; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            ddspf->flags = DDPF_FOURCC;
+            ddspf->fourcc = FOURCC_DX10;
+            header_dx10.dxgi_format = 6;        // DXGI_FORMAT_R32G32B32_FLOAT
+            header_dx10.resource_dimension = 3; // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+            header_dx10.array_size = 1;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: ddspf->flags = DDPF_FOURCC; ddspf->fourcc = FOURCC_A32B32G32R32F; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: ddspf->flags = DDPF_FOURCC; ddspf->fourcc = FOURCC_R16F; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: ddspf->flags = DDPF_FOURCC; ddspf->fourcc = FOURCC_A16B16G16R16F; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: ddspf->flags = DDPF_FOURCC; ddspf->fourcc = FOURCC_DXT1; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: ddspf->flags = DDPF_FOURCC | DDPF_ALPHAPIXELS; ddspf->fourcc = FOURCC_DXT1; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA: ddspf->flags = DDPF_FOURCC; ddspf->fourcc = FOURCC_DXT3; break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA: ddspf->flags = DDPF_FOURCC; ddspf->fourcc = FOURCC_DXT5; break;
+        default: break;
+    }
 
-                memcpy(image_data, file_data_ptr, data_size);
+    if ((ddspf->flags == 0) || (data == NULL)) LOG("WARNING: IMAGE: Pixel format not supported for DDS export (%i)", format);
+    else
+    {
+        if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+        {
+            header.flags |= DDSD_LINEARSIZE;
+            header.pitch_or_linear_size = get_pixel_data_size(width, height, format);
+        }
+        else
+        {
+            header.flags |= DDSD_PITCH;
+            header.pitch_or_linear_size = get_pixel_data_size(width, 1, format);
+        }
 
-                switch (header->ddspf.fourcc)
-                {
-                    case FOURCC_DXT1:
-                    {
-                        if (header->ddspf.flags == 0x04) *format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
-                        else *format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
-                    } break;
-                    case FOURCC_DXT3: *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
-                    case FOURCC_DXT5: *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
-                    default: break;
-                }
-            }
+        int header_size = 4 + sizeof(dds_header) + ((ddspf->fourcc == FOURCC_DX10)? sizeof(dds_header_dx10) : 0);
+        int data_size = 0;
+
+        for (int i = 0, w = width, h = height; i < mipmaps; i++)
+        {
+            data_size += get_pixel_data_size(w, h, format);
+            w = (w > 1)? w/2 : 1;
+            h = (h > 1)? h/2 : 1;
         }
+
+        file_data = (unsigned char *)RL_MALLOC(header_size + data_size);
+
+        memcpy(file_data, "DDS ", 4);
+        memcpy(file_data + 4, &header, sizeof(dds_header));
+        if (ddspf->fourcc == FOURCC_DX10) memcpy(file_data + 4 + sizeof(dds_header), &header_dx10, sizeof(dds_header_dx10));
+        memcpy(file_data + header_size, data, data_size);
+
+        convert_dds_data(file_data + header_size, data_size, conversion, 1);
+
+        *file_size = header_size + data_size;
     }
 
-    return image_data;
+    return file_data;
 }
 #endif
 
@@ -427,21 +685,56 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 
             *width = header->width;
             *height = header->height;
-            *mips = header->mipmap_levels;
+            *mips = (header->mipmap_levels == 0)? 1 : header->mipmap_levels;
 
             file_data_ptr += header->key_value_data_size; // Skip value data size
 
-            int data_size = ((int *)file_data_ptr)[0];
-            file_data_ptr += sizeof(int);
-
-            image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-            memcpy(image_data, file_data_ptr, data_size);
-
             if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
             else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
             else if (header->gl_internal_format == 0x9278) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
 
+            // Load all mipmaps data, every mipmap level data is preceded by its size and padded to 4 bytes
+            const unsigned char *file_data_end = file_data + file_size;
+            int data_size = 0;
+
+            for (int i = 0, w = *width, h = *height; i < *mips; i++)
+            {
+                data_size += get_pixel_data_size(w, h, *format);
+                w = (w > 1)? w/2 : 1;
+                h = (h > 1)? h/2 : 1;
+            }
+
+            if (data_size > 0) image_data = RL_CALLOC(data_size, 1);
+
+            int data_offset = 0;
+            int level = 0;
+
+            for (int w = *width, h = *height; (image_data != NULL) && (level < *mips); level++)
+            {
+                if ((file_data_ptr + sizeof(unsigned int)) > file_data_end) break;
+
+                unsigned int image_size = ((unsigned int *)file_data_ptr)[0];
+                unsigned int level_size = get_pixel_data_size(w, h, *format);
+                file_data_ptr += sizeof(unsigned int);
+
+                if ((image_size < level_size) || ((file_data_ptr + level_size) > file_data_end)) break;
+
+                memcpy((unsigned char *)image_data + data_offset, file_data_ptr, level_size);
+
+                file_data_ptr += (image_size + 3) & ~3u;
+                data_offset += level_size;
+                w = (w > 1)? w/2 : 1;
+                h = (h > 1)? h/2 : 1;
+            }
+
+            if (level == 0)
+            {
+                LOG("WARNING: IMAGE: KTX file data not valid");
+                RL_FREE(image_data);
+                image_data = NULL;
+            }
+            else *mips = level;
+
             // TODO: Support uncompressed data formats? Right now it returns format = 0!
         }
     }
@@ -566,6 +859,341 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 }
 #endif
 
+#if defined(RL_GPUTEX_SUPPORT_KTX2)
+// KTX 2.0 file Header (80 bytes)
+// v2.0 - https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+typedef struct {
+    unsigned char id[12];                   // Identifier: "«KTX 20»\r\n\x1A\n"
+    unsigned int vk_format;                 // Vulkan format (VkFormat), 0 for undefined (supercompressed)
+    unsigned int type_size;                 // Size of data type in bytes, 1 for compressed formats
+    unsigned int pixel_width;               // Texture image width in pixels
+    unsigned int pixel_height;              // Texture image height in pixels
+    unsigned int pixel_depth;               // For 2D textures is 0
+    unsigned int layer_count;               // Number of array elements, for no-array = 0
+    unsigned int face_count;                // Cubemap faces, for no-cubemap = 1
+    unsigned int level_count;               // Mipmap levels, 0 means mipmaps should be generated on loading
+    unsigned int supercompression_scheme;   // 0 (None), 1 (BasisLZ), 2 (Zstandard), 3 (Zlib)
+    unsigned int dfd_byte_offset;           // Data Format Descriptor offset
+    unsigned int dfd_byte_length;           // Data Format Descriptor length
+    unsigned int kvd_byte_offset;           // Key/Value data offset
+    unsigned int kvd_byte_length;           // Key/Value data length
+    unsigned long long sgd_byte_offset;     // Supercompression global data offset
+    unsigned long long sgd_byte_length;     // Supercompression global data length
+} ktx2_header;
+
+// KTX 2.0 mipmap level index (24 bytes), levels data is stored from smallest to largest
+typedef struct {
+    unsigned long long byte_offset;
+    unsigned long long byte_length;
+    unsigned long long uncompressed_byte_length;
+} ktx2_level;
+
+// KTX 2.0 pixel formats supported, raylib PixelFormat to VkFormat
+static const unsigned int ktx2_vk_formats[][2] = {
+    { PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, 9 },              // VK_FORMAT_R8_UNORM
+    { PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, 16 },            // VK_FORMAT_R8G8_UNORM
+    { PIXELFORMAT_UNCOMPRESSED_R5G6B5, 4 },                 // VK_FORMAT_R5G6B5_UNORM_PACK16
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8, 23 },                // VK_FORMAT_R8G8B8_UNORM
+    { PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, 6 },               // VK_FORMAT_R5G5B5A1_UNORM_PACK16
+    { PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, 2 },               // VK_FORMAT_R4G4B4A4_UNORM_PACK16
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 37 },              // VK_FORMAT_R8G8B8A8_UNORM
+    { PIXELFORMAT_UNCOMPRESSED_R32, 100 },                  // VK_FORMAT_R32_SFLOAT
+    { PIXELFORMAT_UNCOMPRESSED_R32G32B32, 106 },            // VK_FORMAT_R32G32B32_SFLOAT
+    { PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 109 },         // VK_FORMAT_R32G32B32A32_SFLOAT
+    { PIXELFORMAT_UNCOMPRESSED_R16, 76 },                   // VK_FORMAT_R16_SFLOAT
+    { PIXELFORMAT_UNCOMPRESSED_R16G16B16, 90 },             // VK_FORMAT_R16G16B16_SFLOAT
+    { PIXELFORMAT_UNCOMPRESSED_R16G16B16A16, 97 },          // VK_FORMAT_R16G16B16A16_SFLOAT
+    { PIXELFORMAT_COMPRESSED_DXT1_RGB, 131 },               // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+    { PIXELFORMAT_COMPRESSED_DXT1_RGBA, 133 },              // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    { PIXELFORMAT_COMPRESSED_DXT3_RGBA, 135 },              // VK_FORMAT_BC2_UNORM_BLOCK
+    { PIXELFORMAT_COMPRESSED_DXT5_RGBA, 137 },              // VK_FORMAT_BC3_UNORM_BLOCK
+    { PIXELFORMAT_COMPRESSED_ETC2_RGB, 147 },               // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+    { PIXELFORMAT_COMPRESSED_ETC1_RGB, 147 },               // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK (ETC1 is a subset of ETC2)
+    { PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA, 151 },          // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+    { PIXELFORMAT_COMPRESSED_PVRT_RGBA, 1000054001 },       // VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG
+    { PIXELFORMAT_COMPRESSED_PVRT_RGB, 1000054001 },        // VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG
+    { PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA, 157 },          // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+    { PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA, 171 },          // VK_FORMAT_ASTC_8x8_UNORM_BLOCK
+};
+
+#define KTX2_VK_FORMATS_COUNT   (sizeof(ktx2_vk_formats)/sizeof(ktx2_vk_formats[0]))
+
+// Get KTX 2.0 mipmap levels index from memory file data, validating levels data
+// NOTE: Only 2D textures (no arrays, no cubemaps) with no supercompression supported
+static const ktx2_level *get_ktx2_levels(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
+{
+    const ktx2_level *levels = NULL;
+    const unsigned char ktx2_identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    *format = 0;
+
+    if ((file_data == NULL) || (file_size < sizeof(ktx2_header)) || (memcmp(file_data, ktx2_identifier, 12) != 0))
+    {
+        LOG("WARNING: IMAGE: KTX2 file data not valid");
+        return NULL;
+    }
+
+    const ktx2_header *header = (const ktx2_header *)file_data;
+
+    for (unsigned int i = 0; i < KTX2_VK_FORMATS_COUNT; i++)
+    {
+        if (ktx2_vk_formats[i][1] == header->vk_format) { *format = ktx2_vk_formats[i][0]; break; }
+    }
+
+    *width = header->pixel_width;
+    *height = header->pixel_height;
+    *mips = (header->level_count == 0)? 1 : header->level_count;
+
+    if ((*format == 0) || (header->supercompression_scheme != 0)) LOG("WARNING: IMAGE: KTX2 file pixel format or supercompression not supported");
+    else if ((header->pixel_depth > 1) || (header->layer_count > 1) || (header->face_count > 1)) LOG("WARNING: IMAGE: KTX2 file only 2D textures supported");
+    else if ((sizeof(ktx2_header) + *mips*sizeof(ktx2_level)) > file_size) LOG("WARNING: IMAGE: KTX2 file data not valid");
+    else
+    {
+        levels = (const ktx2_level *)(file_data + sizeof(ktx2_header));
+
+        for (int i = 0, w = *width, h = *height; i < *mips; i++)
+        {
+            unsigned long long level_size = get_pixel_data_size(w, h, *format);
+
+            if ((levels[i].byte_length < level_size) || (levels[i].byte_offset + level_size > file_size))
+            {
+                LOG("WARNING: IMAGE: KTX2 file mipmap level data not valid");
+                levels = NULL;
+                break;
+            }
+
+            w = (w > 1)? w/2 : 1;
+            h = (h > 1)? h/2 : 1;
+        }
+    }
+
+    if (levels == NULL) *format = 0;
+
+    return levels;
+}
+
+// Load KTX 2.0 image data from memory (uncompressed or compressed, no supercompression)
+// NOTE: Mipmap levels are stored from smallest to largest, they are reordered into a contiguous mipmap chain
+void *rl_load_ktx2_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
+{
+    void *image_data = NULL;
+    const ktx2_level *levels = get_ktx2_levels(file_data, file_size, width, height, format, mips);
+
+    if (levels != NULL)
+    {
+        int data_size = 0;
+
+        for (int i = 0, w = *width, h = *height; i < *mips; i++)
+        {
+            data_size += get_pixel_data_size(w, h, *format);
+            w = (w > 1)? w/2 : 1;
+            h = (h > 1)? h/2 : 1;
+        }
+
+        image_data = RL_MALLOC(data_size);
+
+        for (int i = 0, w = *width, h = *height, data_offset = 0; i < *mips; i++)
+        {
+            int level_size = get_pixel_data_size(w, h, *format);
+
+            memcpy((unsigned char *)image_data + data_offset, file_data + levels[i].byte_offset, level_size);
+
+            data_offset += level_size;
+            w = (w > 1)? w/2 : 1;
+            h = (h > 1)? h/2 : 1;
+        }
+    }
+
+    return image_data;
+}
+
+// Get KTX 2.0 image data from memory, pointing to file data (no data copy), i.e. GPU upload from memory-mapped file
+// NOTE: Returns NULL if mipmap levels require reordering (format is still returned, 0 if file data is not valid)
+const void *rl_get_ktx2_data_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
+{
+    const ktx2_level *levels = get_ktx2_levels(file_data, file_size, width, height, format, mips);
+
+    return ((levels != NULL) && (*mips == 1))? (file_data + levels[0].byte_offset) : NULL;
+}
+
+// Get KTX 2.0 Data Format Descriptor (DFD) for pixel format, returns DFD size in bytes
+// NOTE: Basic descriptor block, linear transfer function, BT709 primaries, straight alpha
+static int get_ktx2_dfd(int format, unsigned int *dfd)
+{
+    // Samples definition: bit offset, bit length, channel id
+    int samples[4][3] = { 0 };
+    int sample_count = 0;
+    int color_model = 1;        // KHR_DF_MODEL_RGBSDA
+    int block_dim = 0;          // Texel block dimensions minus 1 (4x4 blocks: 3)
+    int bytes_plane = get_pixel_data_size(1, 1, format);
+    int is_float = 0;
+
+    #define KTX2_SAMPLE(offset, length, channel) { samples[sample_count][0] = offset; samples[sample_count][1] = length; samples[sample_count][2] = channel; sample_count++; }
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: KTX2_SAMPLE(0, 8, 0); break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: KTX2_SAMPLE(0, 8, 0); KTX2_SAMPLE(8, 8, 1); break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5: KTX2_SAMPLE(11, 5, 0); KTX2_SAMPLE(5, 6, 1); KTX2_SAMPLE(0, 5, 2); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: KTX2_SAMPLE(0, 8, 0); KTX2_SAMPLE(8, 8, 1); KTX2_SAMPLE(16, 8, 2); break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: KTX2_SAMPLE(11, 5, 0); KTX2_SAMPLE(6, 5, 1); KTX2_SAMPLE(1, 5, 2); KTX2_SAMPLE(0, 1, 15); break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: KTX2_SAMPLE(12, 4, 0); KTX2_SAMPLE(8, 4, 1); KTX2_SAMPLE(4, 4, 2); KTX2_SAMPLE(0, 4, 15); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: KTX2_SAMPLE(0, 8, 0); KTX2_SAMPLE(8, 8, 1); KTX2_SAMPLE(16, 8, 2); KTX2_SAMPLE(24, 8, 15); break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: is_float = 1; KTX2_SAMPLE(0, 32, 0); break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: is_float = 1; KTX2_SAMPLE(0, 32, 0); KTX2_SAMPLE(32, 32, 1); KTX2_SAMPLE(64, 32, 2); break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: is_float = 1; KTX2_SAMPLE(0, 32, 0); KTX2_SAMPLE(32, 32, 1); KTX2_SAMPLE(64, 32, 2); KTX2_SAMPLE(96, 32, 15); break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: is_float = 1; KTX2_SAMPLE(0, 16, 0); break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: is_float = 1; KTX2_SAMPLE(0, 16, 0); KTX2_SAMPLE(16, 16, 1); KTX2_SAMPLE(32, 16, 2); break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: is_float = 1; KTX2_SAMPLE(0, 16, 0); KTX2_SAMPLE(16, 16, 1); KTX2_SAMPLE(32, 16, 2); KTX2_SAMPLE(48, 16, 15); break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: color_model = 128; block_dim = 3; KTX2_SAMPLE(0, 64, 0); break;     // KHR_DF_MODEL_BC1A, color
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: color_model = 128; block_dim = 3; KTX2_SAMPLE(0, 64, 1); break;    // KHR_DF_MODEL_BC1A, alpha present
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA: color_model = 129; block_dim = 3; KTX2_SAMPLE(0, 64, 15); KTX2_SAMPLE(64, 64, 0); break;    // KHR_DF_MODEL_BC2
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA: color_model = 130; block_dim = 3; KTX2_SAMPLE(0, 64, 15); KTX2_SAMPLE(64, 64, 0); break;    // KHR_DF_MODEL_BC3
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: color_model = 161; block_dim = 3; KTX2_SAMPLE(0, 64, 2); break;     // KHR_DF_MODEL_ETC2, color
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: color_model = 161; block_dim = 3; KTX2_SAMPLE(0, 64, 15); KTX2_SAMPLE(64, 64, 2); break;
+        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: color_model = 164; block_dim = 3; bytes_plane = 8; KTX2_SAMPLE(0, 64, 0); break;   // KHR_DF_MODEL_PVRTC
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: color_model = 162; block_dim = 3; KTX2_SAMPLE(0, 128, 0); break;   // KHR_DF_MODEL_ASTC
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: color_model = 162; block_dim = 7; KTX2_SAMPLE(0, 128, 0); break;
+        default: break;
+    }
+
+    #undef KTX2_SAMPLE
+
+    int block_size = 24 + 16*sample_count;
+
+    dfd[0] = 4 + block_size;                    // DFD total size
+    dfd[1] = 0;                                 // Vendor id (Khronos) and descriptor type (basic)
+    dfd[2] = 2 | (block_size << 16);            // Version number and descriptor block size
+    dfd[3] = color_model | (1 << 8) | (1 << 16);    // Color model, primaries (BT709), transfer function (linear), flags
+    dfd[4] = block_dim | (block_dim << 8);      // Texel block dimensions (2D)
+    dfd[5] = bytes_plane;                       // Bytes plane 0
+    dfd[6] = 0;
+
+    for (int i = 0; i < sample_count; i++)
+    {
+        unsigned int *sample = dfd + 7 + i*4;
+
+        sample[0] = (unsigned int)samples[i][0] | ((unsigned int)(samples[i][1] - 1) << 16) | (((unsigned int)samples[i][2] | (is_float? 0xc0u : 0u)) << 24);
+        sample[1] = 0;                          // Sample position
+
+        if (is_float) { sample[2] = 0xbf800000; sample[3] = 0x3f800000; }   // -1.0f, 1.0f
+        else if (color_model != 1) { sample[2] = 0; sample[3] = 0xffffffff; }
+        else { sample[2] = 0; sample[3] = (1u << samples[i][1]) - 1; }
+    }
+
+    return (sample_count > 0)? (int)dfd[0] : 0;
+}
+
+// Save image data as KTX 2.0 file into memory buffer, including all mipmaps (no supercompression)
+// NOTE: Grayscale formats are stored as R8/R8G8 with KTXswizzle metadata
+unsigned char *rl_save_ktx2_to_memory(const void *data, int width, int height, int format, int mipmaps, int *file_size)
+{
+    unsigned char *file_data = NULL;
+    unsigned int dfd[7 + 4*4] = { 0 };
+    ktx2_header header = { 0 };
+    const unsigned char ktx2_identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    *file_size = 0;
+    if (mipmaps < 1) mipmaps = 1;
+
+    for (unsigned int i = 0; i < KTX2_VK_FORMATS_COUNT; i++)
+    {
+        if ((int)ktx2_vk_formats[i][0] == format) { header.vk_format = ktx2_vk_formats[i][1]; break; }
+    }
+
+    int dfd_size = get_ktx2_dfd(format, dfd);
+
+    if ((header.vk_format == 0) || (dfd_size == 0) || (data == NULL)) LOG("WARNING: IMAGE: Pixel format not supported for KTX2 export (%i)", format);
+    else
+    {
+        // Key/Value data: writer and channels swizzle (grayscale formats)
+        unsigned char kvd[128] = { 0 };
+        int kvd_size = 0;
+        const char *keys[2] = { "KTXwriter", "KTXswizzle" };
+        const char *values[2] = { "raylib", NULL };
+
+        if (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) values[1] = "rrr1";
+        else if (format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) values[1] = "rrrg";
+
+        for (int i = 0; i < 2; i++)
+        {
+            if (values[i] == NULL) continue;
+
+            unsigned int key_value_size = (unsigned int)(strlen(keys[i]) + 1 + strlen(values[i]) + 1);
+
+            memcpy(kvd + kvd_size, &key_value_size, 4);
+            memcpy(kvd + kvd_size + 4, keys[i], strlen(keys[i]) + 1);
+            memcpy(kvd + kvd_size + 4 + strlen(keys[i]) + 1, values[i], strlen(values[i]) + 1);
+            kvd_size += (4 + key_value_size + 3) & ~3;
+        }
+
+        // Mipmap levels data alignment: least common multiple of texel block size and 4
+        int block_bytes = (int)(dfd[5] & 0xff);
+        int alignment = block_bytes;
+        while ((alignment%4) != 0) alignment += block_bytes;
+
+        int levels_offset = sizeof(ktx2_header) + mipmaps*sizeof(ktx2_level);
+        int data_offset = levels_offset + dfd_size + kvd_size;
+        int level_sizes[32] = { 0 };
+
+        if (mipmaps > 32) mipmaps = 32;
+
+        for (int i = 0, w = width, h = height; i < mipmaps; i++)
+        {
+            level_sizes[i] = get_pixel_data_size(w, h, format);
+            w = (w > 1)? w/2 : 1;
+            h = (h > 1)? h/2 : 1;
+        }
+
+        // Levels data is stored from smallest to largest
+        ktx2_level levels[32] = { 0 };
+        int size = data_offset;
+
+        for (int i = mipmaps - 1; i >= 0; i--)
+        {
+            size = ((size + alignment - 1)/alignment)*alignment;
+            levels[i].byte_offset = size;
+            levels[i].byte_length = level_sizes[i];
+            levels[i].uncompressed_byte_length = level_sizes[i];
+            size += level_sizes[i];
+        }
+
+        memcpy(header.id, ktx2_identifier, 12);
+        header.type_size = 1;
+        if ((format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) || (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) ||
+            (format == PIXELFORMAT_UNCOMPRESSED_R16) || (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) || (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) header.type_size = 2;
+        else if ((format == PIXELFORMAT_UNCOMPRESSED_R32) || (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) || (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) header.type_size = 4;
+        header.pixel_width = width;
+        header.pixel_height = height;
+        header.face_count = 1;
+        header.level_count = mipmaps;
+        header.dfd_byte_offset = levels_offset;
+        header.dfd_byte_length = dfd_size;
+        header.kvd_byte_offset = (kvd_size > 0)? levels_offset + dfd_size : 0;
+        header.kvd_byte_length = kvd_size;
+
+        file_data = (unsigned char *)RL_CALLOC(size, 1);
+
+        memcpy(file_data, &header, sizeof(ktx2_header));
+        memcpy(file_data + sizeof(ktx2_header), levels, mipmaps*sizeof(ktx2_level));
+        memcpy(file_data + levels_offset, dfd, dfd_size);
+        memcpy(file_data + levels_offset + dfd_size, kvd, kvd_size);
+
+        for (int i = 0, offset = 0; i < mipmaps; i++)
+        {
+            memcpy(file_data + levels[i].byte_offset, (const unsigned char *)data + offset, level_sizes[i]);
+            offset += level_sizes[i];
+        }
+
+        *file_size = size;
+    }
+
+    return file_data;
+}
+#endif
+
 #if defined(RL_GPUTEX_SUPPORT_PVR)
 // Loading PVR image data (uncompressed or PVRT compression)
 // NOTE: PVR v2 not supported, use PVR v3 instead
@@ -790,6 +1418,9 @@ static int get_pixel_data_size(int width, int height, int format)
         case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
         case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
         case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
         case PIXELFORMAT_COMPRESSED_DXT1_RGB:
         case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
         case PIXELFORMAT_COMPRESSED_ETC1_RGB:
@@ -806,13 +1437,15 @@ static int get_pixel_data_size(int width, int height, int format)
 
     data_size = width*height*bpp/8;  // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // Most compressed formats works on 4x4 blocks (8x8 for ASTC 8x8), data is stored in full blocks,
+    // textures smaller or not multiple of block size (i.e. mipmaps) require padded blocks
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGBA))
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) data_size = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) data_size = 16;
+        int block_width = (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)? 8 : 4;
+
+        data_size = ((width + block_width - 1)/block_width)*((height + block_width - 1)/block_width)*(bpp*block_width*block_width/8);
     }
+    else if ((format >= PIXELFORMAT_COMPRESSED_PVRT_RGB) && (width < 4) && (height < 4)) data_size = 16;
 
     return data_size;
 }
@@ -96,6 +96,13 @@ extern int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
                              unsigned int *num_shapes, tinyobj_material_t **materials,
                              unsigned int *num_materials, const char *buf, unsigned int len,
                              unsigned int flags);
+/* Same as tinyobj_parse_obj(), material file (mtllib) path is relative to `base_dir'
+ * (i.e. .obj file directory) instead of current working directory, if not NULL.
+ */
+extern int tinyobj_parse_obj_ex(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
+                                unsigned int *num_shapes, tinyobj_material_t **materials,
+                                unsigned int *num_materials, const char *buf, unsigned int len,
+                                unsigned int flags, const char *base_dir);
 extern int tinyobj_parse_mtl_file(tinyobj_material_t **materials_out,
                                   unsigned int *num_materials_out,
                                   const char *filename);
@@ -1211,6 +1218,13 @@ int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
                       unsigned int *num_shapes, tinyobj_material_t **materials_out,
                       unsigned int *num_materials_out, const char *buf, unsigned int len,
                       unsigned int flags) {
+  return tinyobj_parse_obj_ex(attrib, shapes, num_shapes, materials_out, num_materials_out, buf, len, flags, NULL);
+}
+
+int tinyobj_parse_obj_ex(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
+                         unsigned int *num_shapes, tinyobj_material_t **materials_out,
+                         unsigned int *num_materials_out, const char *buf, unsigned int len,
+                         unsigned int flags, const char *base_dir) {
   LineInfo *line_infos = NULL;
   Command *commands = NULL;
   unsigned int num_lines = 0;
@@ -1324,6 +1338,22 @@ int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
     char *filename = my_strndup(commands[mtllib_line_index].mtllib_name,
                                 commands[mtllib_line_index].mtllib_name_len);
 
+    /* Material file path relative to base directory (absolute paths kept) */
+    if (base_dir != NULL && base_dir[0] != '\0' && filename[0] != '/' && filename[0] != '\\' &&
+        !(filename[0] != '\0' && filename[1] == ':')) {
+      size_t dir_len = strlen(base_dir);
+      size_t name_len = strlen(filename);
+      int add_sep = (base_dir[dir_len - 1] != '/' && base_dir[dir_len - 1] != '\\');
+      char *path = (char *)TINYOBJ_MALLOC(dir_len + (size_t)add_sep + name_len + 1);
+
+      memcpy(path, base_dir, dir_len);
+      if (add_sep) path[dir_len] = '/';
+      memcpy(path + dir_len + add_sep, filename, name_len + 1);
+
+      TINYOBJ_FREE(filename);
+      filename = path;
+    }
+
     int ret = tinyobj_parse_and_index_mtl_file(&materials, &num_materials, filename, &material_table);
 
     if (ret != TINYOBJ_SUCCESS) {
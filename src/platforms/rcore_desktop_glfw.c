@@ -1195,6 +1195,12 @@ void PollInputEvents(void)
 
                 if (button != -1)   // Check for valid button
                 {
+                    // NOTE: Gamepads state is polled, events are registered on state changes
+                    if (CORE.Input.Gamepad.currentButtonState[i][button] != (buttons[k] == GLFW_PRESS))
+                    {
+                        PushInputEvent((buttons[k] == GLFW_PRESS)? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, i, button, (Vector2){ 0.0f, 0.0f }, GetTime());
+                    }
+
                     if (buttons[k] == GLFW_PRESS)
                     {
                         CORE.Input.Gamepad.currentButtonState[i][button] = 1;
@@ -1209,6 +1215,8 @@ void PollInputEvents(void)
 
             for (int k = 0; (axes != NULL) && (k < GLFW_GAMEPAD_AXIS_LAST + 1); k++)
             {
+                if (CORE.Input.Gamepad.axisState[i][k] != axes[k]) PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, i, k, (Vector2){ axes[k], 0.0f }, GetTime());
+
                 CORE.Input.Gamepad.axisState[i][k] = axes[k];
             }
 
@@ -1770,6 +1778,10 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
     else if(action == GLFW_PRESS) CORE.Input.Keyboard.currentKeyState[key] = 1;
     else if(action == GLFW_REPEAT) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
 
+    // NOTE: GLFW does not provide events time, events are timestamped when received on glfwPollEvents()
+    int eventType = (action == GLFW_RELEASE)? INPUT_EVENT_KEY_UP : ((action == GLFW_PRESS)? INPUT_EVENT_KEY_DOWN : INPUT_EVENT_KEY_REPEAT);
+    PushInputEvent(eventType, 0, key, (Vector2){ 0.0f, 0.0f }, GetTime());
+
     // WARNING: Check if CAPS/NUM key modifiers are enabled and force down state for those keys
     if (((key == KEY_CAPS_LOCK) && ((mods & GLFW_MOD_CAPS_LOCK) > 0)) ||
         ((key == KEY_NUM_LOCK) && ((mods & GLFW_MOD_NUM_LOCK) > 0))) CORE.Input.Keyboard.currentKeyState[key] = 1;
@@ -1803,6 +1815,8 @@ static void CharCallback(GLFWwindow *window, unsigned int codepoint)
         CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = codepoint;
         CORE.Input.Keyboard.charPressedQueueCount++;
     }
+
+    PushInputEvent(INPUT_EVENT_CHAR, 0, (int)codepoint, (Vector2){ 0.0f, 0.0f }, GetTime());
 }
 
 // GLFW3 Mouse Button Callback, runs on mouse button pressed
@@ -1813,6 +1827,8 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     CORE.Input.Mouse.currentButtonState[button] = action;
     CORE.Input.Touch.currentTouchState[button] = action;
 
+    PushInputEvent((action == GLFW_PRESS)? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, 0, button, (Vector2){ 0.0f, 0.0f }, GetTime());
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -1848,6 +1864,8 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
     CORE.Input.Mouse.currentPosition.y = (float)y;
     CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
 
+    PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition, GetTime());
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -1876,6 +1894,8 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
     CORE.Input.Mouse.currentWheelMove = (Vector2){ (float)xoffset, (float)yoffset };
+
+    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, CORE.Input.Mouse.currentWheelMove, GetTime());
 }
 
 // GLFW3 CursorEnter Callback, when cursor enters the window
@@ -903,6 +903,9 @@ void PollInputEvents(void)
 
         RGFW_Event *event = &platform.window->event;
 
+        // NOTE: RGFW does not provide events time, events are timestamped when received
+        double eventTime = GetTime();
+
         // All input events can be processed after polling
         switch (event->type)
         {
@@ -965,6 +968,8 @@ void PollInputEvents(void)
                     }
 
                     CORE.Input.Keyboard.currentKeyState[key] = 1;
+
+                    PushInputEvent(INPUT_EVENT_KEY_DOWN, 0, key, (Vector2){ 0.0f, 0.0f }, eventTime);
                 }
 
                 // TODO: Put exitKey verification outside the switch?
@@ -981,11 +986,17 @@ void PollInputEvents(void)
                     CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = RSGL_keystrToChar(event->keyName);
                     CORE.Input.Keyboard.charPressedQueueCount++;
                 }
+
+                PushInputEvent(INPUT_EVENT_CHAR, 0, RSGL_keystrToChar(event->keyName), (Vector2){ 0.0f, 0.0f }, eventTime);
             } break;
             case RGFW_keyReleased:
             {
                 KeyboardKey key = ConvertScancodeToKey(event->keyCode);
-                if (key != KEY_NULL) CORE.Input.Keyboard.currentKeyState[key] = 0;
+                if (key != KEY_NULL)
+                {
+                    CORE.Input.Keyboard.currentKeyState[key] = 0;
+                    PushInputEvent(INPUT_EVENT_KEY_UP, 0, key, (Vector2){ 0.0f, 0.0f }, eventTime);
+                }
             } break;
 
             // Check mouse events
@@ -994,6 +1005,7 @@ void PollInputEvents(void)
                 if ((event->button == RGFW_mouseScrollUp) || (event->button == RGFW_mouseScrollDown))
                 {
                     CORE.Input.Mouse.currentWheelMove.y = event->scroll;
+                    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, CORE.Input.Mouse.currentWheelMove, eventTime);
                     break;
                 }
 
@@ -1005,6 +1017,8 @@ void PollInputEvents(void)
                 CORE.Input.Mouse.currentButtonState[btn - 1] = 1;
                 CORE.Input.Touch.currentTouchState[btn - 1] = 1;
 
+                PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_DOWN, 0, btn - 1, (Vector2){ 0.0f, 0.0f }, eventTime);
+
                 touchAction = 1;
             } break;
             case RGFW_mouseButtonReleased:
@@ -1024,6 +1038,8 @@ void PollInputEvents(void)
                 CORE.Input.Mouse.currentButtonState[btn - 1] = 0;
                 CORE.Input.Touch.currentTouchState[btn - 1] = 0;
 
+                PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_UP, 0, btn - 1, (Vector2){ 0.0f, 0.0f }, eventTime);
+
                 touchAction = 0;
             } break;
             case RGFW_mousePosChanged:
@@ -1049,6 +1065,8 @@ void PollInputEvents(void)
 
                 CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
                 touchAction = 2;
+
+                PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition, eventTime);
             } break;
             case RGFW_jsButtonPressed:
             {
@@ -1083,6 +1101,8 @@ void PollInputEvents(void)
                 {
                     CORE.Input.Gamepad.currentButtonState[event->joystick][button] = 1;
                     CORE.Input.Gamepad.lastButtonPressed = button;
+
+                    PushInputEvent(INPUT_EVENT_GAMEPAD_BUTTON_DOWN, event->joystick, button, (Vector2){ 0.0f, 0.0f }, eventTime);
                 }
             } break;
             case RGFW_jsButtonReleased:
@@ -1116,6 +1136,8 @@ void PollInputEvents(void)
                 {
                     CORE.Input.Gamepad.currentButtonState[event->joystick][button] = 0;
                     if (CORE.Input.Gamepad.lastButtonPressed == button) CORE.Input.Gamepad.lastButtonPressed = 0;
+
+                    PushInputEvent(INPUT_EVENT_GAMEPAD_BUTTON_UP, event->joystick, button, (Vector2){ 0.0f, 0.0f }, eventTime);
                 }
             } break;
             case RGFW_jsAxisMove:
@@ -1157,6 +1179,8 @@ void PollInputEvents(void)
                     #endif
                     CORE.Input.Gamepad.axisState[event->joystick][axis] = value;
 
+                    if (axis >= 0) PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, event->joystick, axis, (Vector2){ value, 0.0f }, eventTime);
+
                     // Register button state for triggers in addition to their axes
                     if ((axis == GAMEPAD_AXIS_LEFT_TRIGGER) || (axis == GAMEPAD_AXIS_RIGHT_TRIGGER))
                     {
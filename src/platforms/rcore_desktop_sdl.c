@@ -1079,6 +1079,8 @@ void PollInputEvents(void)
     SDL_Event event = { 0 };
     while (SDL_PollEvent(&event) != 0)
     {
+        double eventTime = (double)event.common.timestamp/1000;    // Event time, same clock as GetTime()
+
         // All input events can be processed after polling
         switch (event.type)
         {
@@ -1162,6 +1164,8 @@ void PollInputEvents(void)
                     }
 
                     CORE.Input.Keyboard.currentKeyState[key] = 1;
+
+                    PushInputEvent(event.key.repeat? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_DOWN, 0, key, (Vector2){ 0.0f, 0.0f }, eventTime);
                 }
 
                 if (event.key.repeat) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
@@ -1176,7 +1180,11 @@ void PollInputEvents(void)
             case SDL_KEYUP:
             {
                 KeyboardKey key = ConvertScancodeToKey(event.key.keysym.scancode);
-                if (key != KEY_NULL) CORE.Input.Keyboard.currentKeyState[key] = 0;
+                if (key != KEY_NULL)
+                {
+                    CORE.Input.Keyboard.currentKeyState[key] = 0;
+                    PushInputEvent(INPUT_EVENT_KEY_UP, 0, key, (Vector2){ 0.0f, 0.0f }, eventTime);
+                }
             } break;
 
             case SDL_TEXTINPUT:
@@ -1192,6 +1200,11 @@ void PollInputEvents(void)
                     CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = GetCodepointNext(event.text.text, &codepointSize);
                     CORE.Input.Keyboard.charPressedQueueCount++;
                 }
+
+                for (const char *text = event.text.text; *text != '\0'; text += codepointSize)
+                {
+                    PushInputEvent(INPUT_EVENT_CHAR, 0, GetCodepointNext(text, &codepointSize), (Vector2){ 0.0f, 0.0f }, eventTime);
+                }
             } break;
 
             // Check mouse events
@@ -1206,6 +1219,8 @@ void PollInputEvents(void)
                 CORE.Input.Mouse.currentButtonState[btn] = 1;
                 CORE.Input.Touch.currentTouchState[btn] = 1;
 
+                PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_DOWN, 0, btn, (Vector2){ 0.0f, 0.0f }, eventTime);
+
                 touchAction = 1;
             } break;
             case SDL_MOUSEBUTTONUP:
@@ -1219,12 +1234,16 @@ void PollInputEvents(void)
                 CORE.Input.Mouse.currentButtonState[btn] = 0;
                 CORE.Input.Touch.currentTouchState[btn] = 0;
 
+                PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_UP, 0, btn, (Vector2){ 0.0f, 0.0f }, eventTime);
+
                 touchAction = 0;
             } break;
             case SDL_MOUSEWHEEL:
             {
                 CORE.Input.Mouse.currentWheelMove.x = (float)event.wheel.x;
                 CORE.Input.Mouse.currentWheelMove.y = (float)event.wheel.y;
+
+                PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, CORE.Input.Mouse.currentWheelMove, eventTime);
             } break;
             case SDL_MOUSEMOTION:
             {
@@ -1242,25 +1261,21 @@ void PollInputEvents(void)
 
                 CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
                 touchAction = 2;
+
+                PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition, eventTime);
             } break;
 
             case SDL_FINGERDOWN:
-            {
-                UpdateTouchPointsSDL(event.tfinger);
-                touchAction = 1;
-                realTouch = true;
-            } break;
             case SDL_FINGERUP:
-            {
-                UpdateTouchPointsSDL(event.tfinger);
-                touchAction = 0;
-                realTouch = true;
-            } break;
             case SDL_FINGERMOTION:
             {
                 UpdateTouchPointsSDL(event.tfinger);
-                touchAction = 2;
+                touchAction = (event.type == SDL_FINGERDOWN)? 1 : ((event.type == SDL_FINGERUP)? 0 : 2);
                 realTouch = true;
+
+                int eventType = (event.type == SDL_FINGERDOWN)? INPUT_EVENT_TOUCH_DOWN : ((event.type == SDL_FINGERUP)? INPUT_EVENT_TOUCH_UP : INPUT_EVENT_TOUCH_MOVE);
+                Vector2 position = { event.tfinger.x*CORE.Window.screen.width, event.tfinger.y*CORE.Window.screen.height };
+                PushInputEvent(eventType, (int)event.tfinger.fingerId, 0, position, eventTime);
             } break;
 
             // Check gamepad events
@@ -1331,6 +1346,8 @@ void PollInputEvents(void)
                 {
                     CORE.Input.Gamepad.currentButtonState[event.jbutton.which][button] = 1;
                     CORE.Input.Gamepad.lastButtonPressed = button;
+
+                    PushInputEvent(INPUT_EVENT_GAMEPAD_BUTTON_DOWN, event.jbutton.which, button, (Vector2){ 0.0f, 0.0f }, eventTime);
                 }
             } break;
             case SDL_CONTROLLERBUTTONUP:
@@ -1365,6 +1382,8 @@ void PollInputEvents(void)
                 {
                     CORE.Input.Gamepad.currentButtonState[event.jbutton.which][button] = 0;
                     if (CORE.Input.Gamepad.lastButtonPressed == button) CORE.Input.Gamepad.lastButtonPressed = 0;
+
+                    PushInputEvent(INPUT_EVENT_GAMEPAD_BUTTON_UP, event.jbutton.which, button, (Vector2){ 0.0f, 0.0f }, eventTime);
                 }
             } break;
             case SDL_CONTROLLERAXISMOTION:
@@ -1388,6 +1407,8 @@ void PollInputEvents(void)
                     float value = event.jaxis.value/(float)32767;
                     CORE.Input.Gamepad.axisState[event.jaxis.which][axis] = value;
 
+                    PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, event.jaxis.which, axis, (Vector2){ value, 0.0f }, eventTime);
+
                     // Register button state for triggers in addition to their axes
                     if ((axis == GAMEPAD_AXIS_LEFT_TRIGGER) || (axis == GAMEPAD_AXIS_RIGHT_TRIGGER))
                     {
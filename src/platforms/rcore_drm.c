@@ -121,6 +121,8 @@ typedef struct {
     int mouseFd;                        // File descriptor for the evdev mouse/touch/gestures
     Rectangle absRange;                 // Range of values for absolute pointing devices (touchscreens)
     int touchSlot;                      // Hold the touch slot number of the currently being sent multitouch block
+    bool mouseMovePending;              // Mouse moved in current evdev report, input event pushed on SYN_REPORT
+    int touchEventPending[MAX_TOUCH_POINTS]; // Touch points input event type pending in current evdev report, pushed on SYN_REPORT
 
     // Gamepad data
     int gamepadStreamFd[MAX_GAMEPADS];  // Gamepad device file descriptor
@@ -231,6 +233,7 @@ static void ConfigureEvdevDevice(char *device); // Identifies a input device and
 static void PollKeyboardEvents(void);           // Process evdev keyboard events
 static void PollGamepadEvents(void);            // Process evdev gamepad events
 static void PollMouseEvents(void);              // Process evdev mouse events
+static double GetEvdevEventTime(const struct input_event *event); // Get evdev event time, same clock as GetTime()
 
 static int FindMatchingConnectorMode(const drmModeConnector *connector, const drmModeModeInfo *mode);                               // Search matching DRM mode in connector's mode list
 static int FindExactConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);      // Search exactly matching DRM connector mode in connector's list
@@ -1566,6 +1569,10 @@ static void ConfigureEvdevDevice(char *device)
         return;
     }
 
+    // Timestamp device events with the same clock as GetTime() (CLOCK_MONOTONIC), used by input events queue
+    int clockId = CLOCK_MONOTONIC;
+    if (ioctl(fd, EVIOCSCLOCKID, &clockId) != 0) TRACELOG(LOG_WARNING, "INPUT: Failed to set input device %s events clock, input events time could be wrong", device);
+
     TRACELOG(LOG_INFO, "INPUT: Initialized input device %s as %s", device, deviceKindStr);
 }
 
@@ -1606,6 +1613,9 @@ static void PollKeyboardEvents(void)
                 CORE.Input.Keyboard.currentKeyState[keycode] = (event.value >= 1);
                 CORE.Input.Keyboard.keyRepeatInFrame[keycode] = (event.value == 2);
 
+                int eventType = (event.value == 0)? INPUT_EVENT_KEY_UP : ((event.value == 1)? INPUT_EVENT_KEY_DOWN : INPUT_EVENT_KEY_REPEAT);
+                PushInputEvent(eventType, 0, keycode, (Vector2){ 0.0f, 0.0f }, GetEvdevEventTime(&event));
+
                 // If the key is pressed add it to the queues
                 if (event.value == 1)
                 {
@@ -1615,11 +1625,20 @@ static void PollKeyboardEvents(void)
                         CORE.Input.Keyboard.keyPressedQueueCount++;
                     }
 
-                    if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
+                    // TODO/FIXME: This is not actually converting to unicode properly because it's not taking things like shift into account
+                    // NOTE: Lookup table does not cover every key code, non-printable characters are not queued
+                    int codepoint = 0;
+                    if (event.code < (sizeof(evkeyToUnicodeLUT)/sizeof(evkeyToUnicodeLUT[0]))) codepoint = evkeyToUnicodeLUT[event.code];
+
+                    if (codepoint >= 32)
                     {
-                        // TODO/FIXME: This is not actually converting to unicode properly because it's not taking things like shift into account
-                        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = evkeyToUnicodeLUT[event.code];
-                        CORE.Input.Keyboard.charPressedQueueCount++;
+                        if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
+                        {
+                            CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = codepoint;
+                            CORE.Input.Keyboard.charPressedQueueCount++;
+                        }
+
+                        PushInputEvent(INPUT_EVENT_CHAR, 0, codepoint, (Vector2){ 0.0f, 0.0f }, GetEvdevEventTime(&event));
                     }
                 }
 
@@ -1658,6 +1677,8 @@ static void PollGamepadEvents(void)
                         CORE.Input.Gamepad.currentButtonState[i][keycodeRaylib] = event.value;
 
                         CORE.Input.Gamepad.lastButtonPressed = (event.value == 1)? keycodeRaylib : GAMEPAD_BUTTON_UNKNOWN;
+
+                        PushInputEvent((event.value == 1)? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, i, keycodeRaylib, (Vector2){ 0.0f, 0.0f }, GetEvdevEventTime(&event));
                     }
                 }
             }
@@ -1676,6 +1697,8 @@ static void PollGamepadEvents(void)
 
                         // NOTE: Scaling of event.value to get values between -1..1
                         CORE.Input.Gamepad.axisState[i][axisRaylib] = (2*(float)(event.value - min)/range) - 1;
+
+                        PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, i, axisRaylib, (Vector2){ CORE.Input.Gamepad.axisState[i][axisRaylib], 0.0f }, GetEvdevEventTime(&event));
                     }
                 }
             }
@@ -1695,6 +1718,21 @@ static void PollMouseEvents(void)
     // Try to read data from the mouse/touch/gesture and only continue if successful
     while (read(fd, &event, sizeof(event)) == (int)sizeof(event))
     {
+        double eventTime = GetEvdevEventTime(&event);
+
+        // Report end, register pending movement input events (axis are reported separately)
+        if ((event.type == EV_SYN) && (event.code == SYN_REPORT))
+        {
+            if (platform.mouseMovePending) PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition, eventTime);
+            platform.mouseMovePending = false;
+
+            for (int i = 0; i < MAX_TOUCH_POINTS; i++)
+            {
+                if (platform.touchEventPending[i] != INPUT_EVENT_NONE) PushInputEvent(platform.touchEventPending[i], i, 0, CORE.Input.Touch.position[i], eventTime);
+                platform.touchEventPending[i] = INPUT_EVENT_NONE;
+            }
+        }
+
         // Relative movement parsing
         if (event.type == EV_REL)
         {
@@ -1709,6 +1747,7 @@ static void PollMouseEvents(void)
 
                 CORE.Input.Touch.position[0].x = CORE.Input.Mouse.currentPosition.x;
                 touchAction = 2;    // TOUCH_ACTION_MOVE
+                platform.mouseMovePending = true;
             }
 
             if (event.code == REL_Y)
@@ -1722,9 +1761,14 @@ static void PollMouseEvents(void)
 
                 CORE.Input.Touch.position[0].y = CORE.Input.Mouse.currentPosition.y;
                 touchAction = 2;    // TOUCH_ACTION_MOVE
+                platform.mouseMovePending = true;
             }
 
-            if (event.code == REL_WHEEL) platform.eventWheelMove.y += event.value;
+            if (event.code == REL_WHEEL)
+            {
+                platform.eventWheelMove.y += event.value;
+                PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (Vector2){ 0.0f, (float)event.value }, eventTime);
+            }
         }
 
         // Absolute movement parsing
@@ -1737,6 +1781,7 @@ static void PollMouseEvents(void)
                 CORE.Input.Touch.position[0].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;        // Scale according to absRange
 
                 touchAction = 2;    // TOUCH_ACTION_MOVE
+                platform.mouseMovePending = true;
             }
 
             if (event.code == ABS_Y)
@@ -1745,6 +1790,7 @@ static void PollMouseEvents(void)
                 CORE.Input.Touch.position[0].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;      // Scale according to absRange
 
                 touchAction = 2;    // TOUCH_ACTION_MOVE
+                platform.mouseMovePending = true;
             }
 
             // Multitouch movement
@@ -1752,22 +1798,34 @@ static void PollMouseEvents(void)
 
             if (event.code == ABS_MT_POSITION_X)
             {
-                if (platform.touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[platform.touchSlot].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;    // Scale according to absRange
+                if (platform.touchSlot < MAX_TOUCH_POINTS)
+                {
+                    CORE.Input.Touch.position[platform.touchSlot].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;    // Scale according to absRange
+                    if (platform.touchEventPending[platform.touchSlot] == INPUT_EVENT_NONE) platform.touchEventPending[platform.touchSlot] = INPUT_EVENT_TOUCH_MOVE;
+                }
             }
 
             if (event.code == ABS_MT_POSITION_Y)
             {
-                if (platform.touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[platform.touchSlot].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;  // Scale according to absRange
+                if (platform.touchSlot < MAX_TOUCH_POINTS)
+                {
+                    CORE.Input.Touch.position[platform.touchSlot].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;  // Scale according to absRange
+                    if (platform.touchEventPending[platform.touchSlot] == INPUT_EVENT_NONE) platform.touchEventPending[platform.touchSlot] = INPUT_EVENT_TOUCH_MOVE;
+                }
             }
 
             if (event.code == ABS_MT_TRACKING_ID)
             {
                 if ((event.value < 0) && (platform.touchSlot < MAX_TOUCH_POINTS))
                 {
+                    PushInputEvent(INPUT_EVENT_TOUCH_UP, platform.touchSlot, 0, CORE.Input.Touch.position[platform.touchSlot], eventTime);
+                    platform.touchEventPending[platform.touchSlot] = INPUT_EVENT_NONE;
+
                     // Touch has ended for this point
                     CORE.Input.Touch.position[platform.touchSlot].x = -1;
                     CORE.Input.Touch.position[platform.touchSlot].y = -1;
                 }
+                else if (platform.touchSlot < MAX_TOUCH_POINTS) platform.touchEventPending[platform.touchSlot] = INPUT_EVENT_TOUCH_DOWN;
             }
 
             // Touchscreen tap
@@ -1779,12 +1837,14 @@ static void PollMouseEvents(void)
                 {
                     platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 0;
                     touchAction = 0;    // TOUCH_ACTION_UP
+                    PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_UP, 0, MOUSE_BUTTON_LEFT, (Vector2){ 0.0f, 0.0f }, eventTime);
                 }
 
                 if (event.value && !previousMouseLeftButtonState)
                 {
                     platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 1;
                     touchAction = 1;    // TOUCH_ACTION_DOWN
+                    PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_DOWN, 0, MOUSE_BUTTON_LEFT, (Vector2){ 0.0f, 0.0f }, eventTime);
                 }
             }
 
@@ -1808,6 +1868,23 @@ static void PollMouseEvents(void)
             if (event.code == BTN_EXTRA) platform.currentButtonStateEvdev[MOUSE_BUTTON_EXTRA] = event.value;
             if (event.code == BTN_FORWARD) platform.currentButtonStateEvdev[MOUSE_BUTTON_FORWARD] = event.value;
             if (event.code == BTN_BACK) platform.currentButtonStateEvdev[MOUSE_BUTTON_BACK] = event.value;
+
+            // Register mouse button input event
+            int button = -1;
+            switch (event.code)
+            {
+                case BTN_TOUCH:
+                case BTN_LEFT: button = MOUSE_BUTTON_LEFT; break;
+                case BTN_RIGHT: button = MOUSE_BUTTON_RIGHT; break;
+                case BTN_MIDDLE: button = MOUSE_BUTTON_MIDDLE; break;
+                case BTN_SIDE: button = MOUSE_BUTTON_SIDE; break;
+                case BTN_EXTRA: button = MOUSE_BUTTON_EXTRA; break;
+                case BTN_FORWARD: button = MOUSE_BUTTON_FORWARD; break;
+                case BTN_BACK: button = MOUSE_BUTTON_BACK; break;
+                default: break;
+            }
+
+            if ((button != -1) && (event.value != 2)) PushInputEvent((event.value == 1)? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, 0, button, (Vector2){ 0.0f, 0.0f }, eventTime);
         }
 
         // Screen confinement
@@ -1849,6 +1926,19 @@ static void PollMouseEvents(void)
     }
 }
 
+// Get evdev event time, same clock as GetTime()
+// NOTE: Input devices are configured to use CLOCK_MONOTONIC for events time [EVIOCSCLOCKID]
+static double GetEvdevEventTime(const struct input_event *event)
+{
+#if defined(input_event_sec)
+    unsigned long long int nanoSeconds = (unsigned long long int)event->input_event_sec*1000000000LLU + (unsigned long long int)event->input_event_usec*1000LLU;
+#else
+    unsigned long long int nanoSeconds = (unsigned long long int)event->time.tv_sec*1000000000LLU + (unsigned long long int)event->time.tv_usec*1000LLU;
+#endif
+
+    return (double)(nanoSeconds - CORE.Time.base)*1e-9;
+}
+
 // Search matching DRM mode in connector's mode list
 static int FindMatchingConnectorMode(const drmModeConnector *connector, const drmModeModeInfo *mode)
 {
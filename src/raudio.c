@@ -393,6 +393,14 @@ typedef struct AudioData {
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
+#if !defined(RAUDIO_STANDALONE)
+// Async sound loading data
+typedef struct AsyncSoundData {
+    char *fileName;                 // Sound file name
+    Sound sound;                    // Sound loaded on worker thread
+} AsyncSoundData;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -431,6 +439,17 @@ static const char *GetFileNameWithoutExt(const char *filePath);     // Get filen
 static unsigned char *LoadFileData(const char *fileName, int *dataSize);    // Load file data as byte array (read)
 static bool SaveFileData(const char *fileName, void *data, int dataSize);   // Save data to file from byte array (write)
 static bool SaveFileText(const char *fileName, char *text);         // Save text data to file (write), string must be '\0' terminated
+#else
+extern int AddAsyncAsset(void *data, bool (*load)(void *data), void (*upload)(void *data), void (*unload)(void *data)); // [Module: core] Add async asset
+extern void *ReleaseAsyncAsset(int asset, bool (*load)(void *data)); // [Module: core] Release async asset handle, returns asset data
+
+static bool LoadSoundAsyncData(void *data);         // Async sound load function (worker thread)
+static void UnloadSoundAsyncData(void *data);       // Async sound unload function, sound not retrieved (main thread)
+
+#if defined(SUPPORT_RESOURCE_TRACKING)
+extern void TrackResource(int type, unsigned long long id, long long cpuBytes, long long gpuBytes); // [Module: core] Register resource
+extern void UntrackResource(int type, unsigned long long id); // [Module: core] Unregister resource
+#endif
 #endif
 
 //----------------------------------------------------------------------------------
@@ -614,6 +633,12 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     // Track audio buffer to linked list next position
     TrackAudioBuffer(audioBuffer);
 
+#if defined(SUPPORT_RESOURCE_TRACKING) && !defined(RAUDIO_STANDALONE)
+    // NOTE: Audio data lives on CPU memory, mixed by miniaudio
+    TrackResource((usage == AUDIO_BUFFER_USAGE_STATIC)? RESOURCE_SOUND : RESOURCE_AUDIO_STREAM, (unsigned long long)(uintptr_t)audioBuffer,
+        sizeof(AudioBuffer) + (long long)sizeInFrames*channels*ma_get_bytes_per_sample(format), 0);
+#endif
+
     return audioBuffer;
 }
 
@@ -622,6 +647,9 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
+#if defined(SUPPORT_RESOURCE_TRACKING) && !defined(RAUDIO_STANDALONE)
+        UntrackResource((buffer->usage == AUDIO_BUFFER_USAGE_STATIC)? RESOURCE_SOUND : RESOURCE_AUDIO_STREAM, (unsigned long long)(uintptr_t)buffer);
+#endif
         UntrackAudioBuffer(buffer);
         ma_data_converter_uninit(&buffer->converter, NULL);
         RL_FREE(buffer->data);
@@ -919,6 +947,38 @@ Sound LoadSound(const char *fileName)
     return sound;
 }
 
+#if !defined(RAUDIO_STANDALONE)
+// Load sound from file asynchronously, returns async asset handle
+// NOTE: Sound is loaded and converted on a worker thread, no GPU upload is required
+int LoadSoundAsync(const char *fileName)
+{
+    AsyncSoundData *data = (AsyncSoundData *)RL_CALLOC(1, sizeof(AsyncSoundData));
+
+    int fileNameSize = (int)strlen(fileName) + 1;
+    data->fileName = (char *)RL_MALLOC(fileNameSize);
+    memcpy(data->fileName, fileName, fileNameSize);
+
+    return AddAsyncAsset(data, LoadSoundAsyncData, NULL, UnloadSoundAsyncData);
+}
+
+// Get sound from async asset handle (ready or failed), handle is released
+Sound GetAssetSound(int asset)
+{
+    Sound sound = { 0 };
+    AsyncSoundData *data = (AsyncSoundData *)ReleaseAsyncAsset(asset, LoadSoundAsyncData);
+
+    if (data != NULL)
+    {
+        sound = data->sound;
+
+        RL_FREE(data->fileName);
+        RL_FREE(data);
+    }
+
+    return sound;
+}
+#endif
+
 // Load sound from wave data
 // NOTE: Wave data must be unallocated manually
 Sound LoadSoundFromWave(Wave wave)
@@ -1026,6 +1086,9 @@ void UnloadSoundAlias(Sound alias)
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
     if (alias.stream.buffer != NULL)
     {
+#if defined(SUPPORT_RESOURCE_TRACKING) && !defined(RAUDIO_STANDALONE)
+        UntrackResource(RESOURCE_SOUND, (unsigned long long)(uintptr_t)alias.stream.buffer);
+#endif
         UntrackAudioBuffer(alias.stream.buffer);
         ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
         RL_FREE(alias.stream.buffer);
@@ -2700,6 +2763,40 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
     }
 }
 
+#if !defined(RAUDIO_STANDALONE)
+// Async sound load function (worker thread)
+static bool LoadSoundAsyncData(void *data)
+{
+    AsyncSoundData *soundData = (AsyncSoundData *)data;
+
+    soundData->sound = LoadSound(soundData->fileName);
+
+    return (soundData->sound.stream.buffer != NULL);
+}
+
+// Async sound unload function, sound not retrieved (main thread)
+// NOTE: Audio device could be already closed, buffer can not be untracked from device but it is freed
+static void UnloadSoundAsyncData(void *data)
+{
+    AsyncSoundData *soundData = (AsyncSoundData *)data;
+    AudioBuffer *buffer = soundData->sound.stream.buffer;
+
+    if (AUDIO.System.isReady) UnloadSound(soundData->sound);
+    else if (buffer != NULL)
+    {
+#if defined(SUPPORT_RESOURCE_TRACKING)
+        UntrackResource(RESOURCE_SOUND, (unsigned long long)(uintptr_t)buffer);
+#endif
+        ma_data_converter_uninit(&buffer->converter, NULL);
+        RL_FREE(buffer->data);
+        RL_FREE(buffer);
+    }
+
+    RL_FREE(soundData->fileName);
+    RL_FREE(soundData);
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
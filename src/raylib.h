@@ -135,6 +135,12 @@
 #ifndef RL_FREE
     #define RL_FREE(ptr)        free(ptr)
 #endif
+#ifndef RL_TEMP_ALLOC
+    #define RL_TEMP_ALLOC(sz)   MemAllocTemp(sz)
+#endif
+#ifndef RL_TEMP_FREE
+    #define RL_TEMP_FREE(ptr)   MemFreeTemp(ptr)
+#endif
 
 // NOTE: MSVC C++ compiler does not support compound literals (C99 feature)
 // Plain structures in C++ (without constructors) can be initialized with { }
@@ -262,6 +268,15 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// ImageView, non-owning view of image pixel data (base mipmap level)
+typedef struct ImageView {
+    void *data;             // Image raw data (not owned by view)
+    int width;              // View width
+    int height;             // View height
+    int stride;             // Row size in bytes
+    int format;             // Data format (PixelFormat type, uncompressed)
+} ImageView;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -505,6 +520,10 @@ typedef struct VrStereoConfig {
     float scaleIn[2];               // VR distortion scale in
 } VrStereoConfig;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rcore module
+typedef struct rDirectoryScan rDirectoryScan;
+
 // File path list
 typedef struct FilePathList {
     unsigned int capacity;          // Filepaths max entries
@@ -526,6 +545,63 @@ typedef struct AutomationEventList {
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Job counter, tracks submitted jobs completion
+typedef struct JobCounter {
+    int pending;                    // Pending jobs count (managed internally, initialize to 0)
+} JobCounter;
+
+// Resource usage, live resources of one type
+typedef struct ResourceUsage {
+    int count;                      // Live resources count
+    int peakCount;                  // Maximum live resources count reached
+    long long cpuBytes;             // Memory used by live resources on CPU side (bytes)
+    long long gpuBytes;             // Estimated memory used by live resources on GPU side (bytes)
+} ResourceUsage;
+
+// Input event, timestamped platform input event
+typedef struct InputEvent {
+    double time;                    // Event time in seconds, same clock as GetTime()
+    int type;                       // Event type (InputEventType)
+    int device;                     // Event device: gamepad index or touch point id (if required)
+    int code;                       // Event code: key, codepoint, button or axis (if required)
+    Vector2 value;                  // Event value: position, wheel move or axis movement (if required)
+} InputEvent;
+
+// Image process operation, pixel operation applied by ImageProcess()
+typedef struct ImageProcessOp {
+    int type;                       // Operation type (ImageProcessOpType)
+    float value;                    // Operation value: contrast (-100 to 100), brightness (-255 to 255)
+    Color color;                    // Operation color: tint color, replace source color
+    Color replace;                  // Operation replace color
+} ImageProcessOp;
+
+// Atlas sprite, image packed into an atlas
+typedef struct AtlasSprite {
+    Rectangle rec;                  // Sprite rectangle in atlas (trimmed size, swapped if rotated), zero size if not packed
+    Vector2 offset;                 // Sprite trimmed content offset in source image
+    Vector2 size;                   // Sprite source image size (before trimming)
+    bool rotated;                   // Sprite rotated 90 degrees clockwise in atlas
+} AtlasSprite;
+
+// Image atlas, images packed into a single image
+typedef struct ImageAtlas {
+    Image image;                    // Atlas image (R8G8B8A8)
+    AtlasSprite *sprites;           // Atlas sprites, in images insertion order
+    int spriteCount;                // Atlas sprites count
+    int padding;                    // Padding around sprites in pixels
+    int flags;                      // Atlas packing flags (AtlasFlags)
+    void *packer;                   // Atlas packer data (skyline), managed internally
+} ImageAtlas;
+
+// Image animation stream, animated image decoded frame by frame
+typedef struct ImageAnimStream {
+    Image frame;                    // Current frame image (R8G8B8A8), pixel data reused by all frames
+    int frameCount;                 // Animation frames count
+    int currentFrame;               // Current frame index
+    float frameDelay;               // Current frame delay in seconds
+    void *ctxData;                  // Decoder context data, managed internally
+} ImageAnimStream;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -747,6 +823,25 @@ typedef enum {
     GAMEPAD_AXIS_RIGHT_TRIGGER = 5      // Gamepad back trigger right, pressure level: [1..-1]
 } GamepadAxis;
 
+// Input event type
+typedef enum {
+    INPUT_EVENT_NONE = 0,               // No event
+    INPUT_EVENT_KEY_DOWN,               // Key pressed, code: key
+    INPUT_EVENT_KEY_UP,                 // Key released, code: key
+    INPUT_EVENT_KEY_REPEAT,             // Key repeated while pressed, code: key
+    INPUT_EVENT_CHAR,                   // Character input, code: unicode codepoint
+    INPUT_EVENT_MOUSE_BUTTON_DOWN,      // Mouse button pressed, code: button
+    INPUT_EVENT_MOUSE_BUTTON_UP,        // Mouse button released, code: button
+    INPUT_EVENT_MOUSE_MOVE,             // Mouse moved, value: position (or delta with cursor disabled)
+    INPUT_EVENT_MOUSE_WHEEL,            // Mouse wheel moved, value: wheel move
+    INPUT_EVENT_TOUCH_DOWN,             // Touch point down, device: point id, value: position
+    INPUT_EVENT_TOUCH_UP,               // Touch point up, device: point id, value: position
+    INPUT_EVENT_TOUCH_MOVE,             // Touch point moved, device: point id, value: position
+    INPUT_EVENT_GAMEPAD_BUTTON_DOWN,    // Gamepad button pressed, device: gamepad, code: button
+    INPUT_EVENT_GAMEPAD_BUTTON_UP,      // Gamepad button released, device: gamepad, code: button
+    INPUT_EVENT_GAMEPAD_AXIS            // Gamepad axis moved, device: gamepad, code: axis, value.x: axis movement
+} InputEventType;
+
 // Material map index
 typedef enum {
     MATERIAL_MAP_ALBEDO = 0,        // Albedo material (same as: MATERIAL_MAP_DIFFUSE)
@@ -863,6 +958,13 @@ typedef enum {
     TEXTURE_FILTER_ANISOTROPIC_16X,         // Anisotropic filtering 16x
 } TextureFilter;
 
+// Mipmap filters, ImageMipmapsEx() downsampling filter (each level filtered from previous one)
+typedef enum {
+    MIPMAP_FILTER_BOX = 0,                  // Box filter (2x2 pixels average for even sizes)
+    MIPMAP_FILTER_KAISER,                   // Kaiser-windowed sinc filter (sharp, low aliasing)
+    MIPMAP_FILTER_LANCZOS,                  // Lanczos3 filter (sharpest, may ring on high contrast edges)
+} MipmapFilter;
+
 // Texture parameters: wrap mode
 typedef enum {
     TEXTURE_WRAP_REPEAT = 0,                // Repeats texture in tiled mode
@@ -938,6 +1040,51 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Async asset loading state
+typedef enum {
+    ASSET_STATE_INVALID = 0,        // Asset handle not valid (or already retrieved)
+    ASSET_STATE_LOADING,            // Asset file loading and decoding (worker thread)
+    ASSET_STATE_UPLOADING,          // Asset waiting for GPU upload (main thread, EndDrawing())
+    ASSET_STATE_READY,              // Asset ready to be retrieved
+    ASSET_STATE_FAILED              // Asset failed to load, retrieving it releases the handle
+} AssetState;
+
+// Image batch loading result
+typedef enum {
+    IMAGE_LOAD_SUCCESS = 0,         // Image loaded successfully
+    IMAGE_LOAD_FILE_ERROR,          // Image file could not be read
+    IMAGE_LOAD_DECODE_ERROR         // Image file data could not be decoded (invalid data or file format not supported)
+} ImageLoadResult;
+
+// Resource types, tracked by resources registry
+typedef enum {
+    RESOURCE_TEXTURE = 0,           // GPU textures and cubemaps (including render textures color buffers)
+    RESOURCE_RENDER_TEXTURE,        // GPU framebuffers and their depth buffers
+    RESOURCE_BUFFER,                // GPU buffers: mesh vertex and index buffers, shader storage buffers
+    RESOURCE_SHADER,                // GPU shader programs
+    RESOURCE_SOUND,                 // Static audio buffers (sounds)
+    RESOURCE_AUDIO_STREAM           // Streaming audio buffers (music and audio streams)
+} ResourceType;
+
+// Image process operation types, ImageProcess() operations
+typedef enum {
+    IMAGE_PROCESS_TINT = 0,         // Tint pixels by color, like ImageColorTint()
+    IMAGE_PROCESS_INVERT,           // Invert pixels color, like ImageColorInvert()
+    IMAGE_PROCESS_GRAYSCALE,        // Convert pixels color to gray, alpha and pixel format are kept
+    IMAGE_PROCESS_CONTRAST,         // Modify pixels contrast by value, like ImageColorContrast()
+    IMAGE_PROCESS_BRIGHTNESS,       // Modify pixels brightness by value, like ImageColorBrightness()
+    IMAGE_PROCESS_REPLACE,          // Replace pixels of color by replace color, like ImageColorReplace()
+    IMAGE_PROCESS_ALPHA_PREMULTIPLY // Premultiply pixels color by alpha, like ImageAlphaPremultiply()
+} ImageProcessOpType;
+
+// Atlas packing flags
+// NOTE: Every bit registers one option (use it with bit masks)
+typedef enum {
+    ATLAS_ALLOW_ROTATION    = 0x00000001,   // Allow sprites rotated 90 degrees clockwise for a tighter packing
+    ATLAS_TRIM_ALPHA        = 0x00000002,   // Trim fully transparent borders of sprites (like GetImageAlphaBorder())
+    ATLAS_EXTRUDE_BORDERS   = 0x00000004    // Fill padding with sprite border pixels (avoids filtering bleeding)
+} AtlasFlags;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -945,6 +1092,8 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef void (*JobCallback)(void *userData);                             // Jobs: Job function
+typedef void (*ParallelForCallback)(int start, int end, void *userData); // Jobs: Parallel-for range function, [start, end)
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1089,13 +1238,41 @@ RLAPI void TakeScreenshot(const char *fileName);                  // Takes a scr
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
+// Job system functions
+// NOTE: Jobs run synchronously on the calling thread if job system is not initialized
+RLAPI void InitJobSystem(int workerCount);                        // Initialize job system worker threads (workerCount <= 0: processors count - 1)
+RLAPI void CloseJobSystem(void);                                  // Close job system, pending jobs are completed before closing
+RLAPI int GetJobWorkerCount(void);                                // Get job system worker threads count (0 if not initialized)
+RLAPI void SubmitJob(JobCallback callback, void *userData, JobCounter *counter); // Submit job for execution, counter (optional) tracks completion, safe from any thread
+RLAPI void WaitJobCounter(JobCounter *counter);                   // Wait for counter jobs completion, calling thread runs pending jobs while waiting
+RLAPI bool IsJobCounterDone(JobCounter *counter);                 // Check if all counter jobs have been completed
+RLAPI void ParallelFor(int count, int batchSize, ParallelForCallback callback, void *userData); // Run callback over [0, count) ranges split across workers, blocks until completion
+
+// Async assets loading functions
+// NOTE: Assets are loaded and decoded on job system workers, GPU upload happens on main thread
+// at EndDrawing() within a per-frame time budget, use Get*Asset*() functions to retrieve them
+RLAPI int GetAssetState(int asset);                               // Get async asset loading state (AssetState)
+RLAPI bool IsAssetReady(int asset);                               // Check if async asset is ready to be retrieved
+RLAPI void SetAsyncUploadBudget(float milliseconds);              // Set async assets GPU upload time budget per frame (default: 2 ms)
+RLAPI void UpdateAsyncAssets(void);                               // Upload pending async assets to GPU within budget (called by EndDrawing())
+
+// Resources registry functions
+// NOTE: Requires SUPPORT_RESOURCE_TRACKING, live resources are reported as leaked on CloseWindow()
+RLAPI ResourceUsage GetResourceUsage(int type);                   // Get live resources count and memory usage for a resource type (ResourceType)
+RLAPI void TraceLogResources(void);                               // Log live resources usage per type, and every live resource with LOG_DEBUG level
+
 // NOTE: Following functions implemented in module [utils]
 //------------------------------------------------------------------
 RLAPI void TraceLog(int logLevel, const char *text, ...);         // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
 RLAPI void SetTraceLogLevel(int logLevel);                        // Set the current threshold (minimum) log level
+RLAPI void SetTraceLogAsync(bool enabled);                        // Set trace log messages output on a background thread (messages queued, dropped if queue full)
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI void *MemAllocTemp(unsigned int size);                      // Temporary memory allocator (released at EndDrawing() or EndTempMemory())
+RLAPI void MemFreeTemp(void *ptr);                                // Temporary memory free (optional, memory owned by allocating frame or scope, last allocation released immediately)
+RLAPI void BeginTempMemory(void);                                 // Begin temporary memory scope (current thread)
+RLAPI void EndTempMemory(void);                                   // End temporary memory scope, releasing temporary allocations done within it
 
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advanced users
@@ -1134,10 +1311,18 @@ RLAPI bool IsFileNameValid(const char *fileName);                 // Check if fi
 RLAPI FilePathList LoadDirectoryFiles(const char *dirPath);       // Load directory filepaths
 RLAPI FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs); // Load directory filepaths with extension filtering and recursive directory scan. Use 'DIR' in the filter string to include directories in the result
 RLAPI void UnloadDirectoryFiles(FilePathList files);              // Unload filepaths
+RLAPI rDirectoryScan *OpenDirectoryScan(const char *basePath, const char *filter, bool scanSubdirs); // Open directory scan iterator, streams filepaths with no capacity limit. Use 'DIR' in the filter string to include directories
+RLAPI const char *GetNextDirectoryFile(rDirectoryScan *scan);     // Get next scanned filepath, NULL when finished (string valid until next call)
+RLAPI void CloseDirectoryScan(rDirectoryScan *scan);              // Close directory scan iterator
 RLAPI bool IsFileDropped(void);                                   // Check if a file has been dropped into window
 RLAPI FilePathList LoadDroppedFiles(void);                        // Load dropped filepaths
 RLAPI void UnloadDroppedFiles(FilePathList files);                // Unload dropped filepaths
 RLAPI long GetFileModTime(const char *fileName);                  // Get file modification time (last write time)
+RLAPI bool WatchFile(const char *fileName);                       // Watch a file for changes (inotify on Linux, modification time polling otherwise)
+RLAPI bool WatchDirectory(const char *dirPath);                   // Watch a directory files for changes (no recursive)
+RLAPI void UnwatchFile(const char *path);                         // Stop watching a file or directory
+RLAPI void UnwatchFiles(void);                                    // Stop watching all files and directories
+RLAPI FilePathList PollFileChanges(void);                         // Poll changed filepaths since last call, duplicates coalesced (list managed internally, valid until next call)
 
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
@@ -1205,6 +1390,11 @@ RLAPI Vector2 GetTouchPosition(int index);                    // Get touch posit
 RLAPI int GetTouchPointId(int index);                         // Get touch point identifier for given index
 RLAPI int GetTouchPointCount(void);                           // Get number of touch points
 
+// Input-related functions: events
+RLAPI void EnableInputEvents(void);                           // Enable timestamped input events queueing (disabled by default)
+RLAPI void DisableInputEvents(void);                          // Disable timestamped input events queueing
+RLAPI int GetInputEvents(InputEvent *events, int maxCount);   // Get queued input events (oldest first), returns events count, call it until 0 to drain the queue
+
 //------------------------------------------------------------------------------------
 // Gestures and Touch Handling Functions (Module: rgestures)
 //------------------------------------------------------------------------------------
@@ -1315,7 +1505,14 @@ RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format
 RLAPI Image LoadImageSvg(const char *fileNameOrString, int width, int height);                           // Load image from SVG file data or string with specified size
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
+RLAPI ImageAnimStream LoadImageAnimStream(const char *fileName);                                         // Load image animation stream from file, frames decoded on demand
+RLAPI ImageAnimStream LoadImageAnimStreamFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load image animation stream from memory buffer (data must be kept while stream is used)
+RLAPI bool IsImageAnimStreamReady(ImageAnimStream anim);                                                 // Check if an image animation stream is ready
+RLAPI void UnloadImageAnimStream(ImageAnimStream anim);                                                  // Unload image animation stream
+RLAPI void UpdateImageAnimStream(ImageAnimStream *anim);                                                 // Update image animation stream frame with next frame (loops to first frame)
+RLAPI void SeekImageAnimStream(ImageAnimStream *anim, int frame);                                        // Seek image animation stream to frame
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
+RLAPI int LoadImagesBatch(const char **fileNames, int count, Image *images, int *results);             // Load images from files in parallel (job system), results (optional) per image (ImageLoadResult), returns loaded count
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI bool IsImageReady(Image image);                                                                    // Check if an image is ready
@@ -1323,6 +1520,7 @@ RLAPI void UnloadImage(Image image);
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
+RLAPI void SetPngCompressionLevel(int level);                                                            // Set PNG export compression level: 0 (fastest) to 8 (smallest, slowest), default: 1
 
 // Image generation functions
 RLAPI Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
@@ -1332,6 +1530,7 @@ RLAPI Image GenImageGradientSquare(int width, int height, float density, Color i
 RLAPI Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2);    // Generate image: checked
 RLAPI Image GenImageWhiteNoise(int width, int height, float factor);                                     // Generate image: white noise
 RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
+RLAPI Image GenImagePerlinNoiseEx(int width, int height, int offsetX, int offsetY, float scale, float lacunarity, float gain, int octaves); // Generate image: perlin noise heightmap (R32, values in [0.0f..1.0f] range)
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
 
@@ -1339,9 +1538,12 @@ RLAPI Image GenImageText(int width, int height, const char *text);
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
 RLAPI Image ImageFromImage(Image image, Rectangle rec);                                                  // Create an image from another image piece
 RLAPI Image ImageFromChannel(Image image, int selectedChannel);                                          // Create an image from a selected channel of another image (GRAYSCALE)
+RLAPI Image ImageIndexed(Image image, const Color *palette, int colorCount, bool dither);                // Create an indexed image (GRAYSCALE, palette indices) from image nearest palette colors (max 256 colors)
+RLAPI Image ImageFromIndexed(Image indexed, const Color *palette, int colorCount);                       // Create an image (RGBA) from indexed image (GRAYSCALE, palette indices) and palette colors
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
+RLAPI void ImageCompress(Image *image, int format, bool highQuality);                                    // Compress image data to block compressed format: DXT1, DXT3, DXT5, ETC1, ETC2, ETC2 EAC
 RLAPI void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
@@ -1349,23 +1551,28 @@ RLAPI void ImageAlphaClear(Image *image, Color color, float threshold);
 RLAPI void ImageAlphaMask(Image *image, Image alphaMask);                                                // Apply alpha mask to image
 RLAPI void ImageAlphaPremultiply(Image *image);                                                          // Premultiply alpha channel
 RLAPI void ImageBlurGaussian(Image *image, int blurSize);                                                // Apply Gaussian blur using a box blur approximation
+RLAPI void ImageBlurGaussianSigma(Image *image, float sigma);                                            // Apply Gaussian blur with exact standard deviation (sigma in pixels)
 RLAPI void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize);                    // Apply custom square convolution kernel to image
 RLAPI void ImageResize(Image *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, int filter, bool srgb, float alphaCutoff);                       // Compute all mipmap levels with filter, linear space filtering for sRGB and alpha coverage preserved for cutoff (0.0f to disable)
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
 RLAPI void ImageRotate(Image *image, int degrees);                                                       // Rotate image by input angle in degrees (-359 to 359)
+RLAPI void ImageRotateEx(Image *image, float degrees, bool antialias);                                   // Rotate image by angle in degrees (bilinear sampling), optional borders antialiasing
 RLAPI void ImageRotateCW(Image *image);                                                                  // Rotate image clockwise 90deg
 RLAPI void ImageRotateCCW(Image *image);                                                                 // Rotate image counter-clockwise 90deg
+RLAPI void ImageProcess(Image *image, const ImageProcessOp *ops, int count);                              // Apply pixel operations chain to image in a single pass (parallel rows bands)
 RLAPI void ImageColorTint(Image *image, Color color);                                                    // Modify image color: tint
 RLAPI void ImageColorInvert(Image *image);                                                               // Modify image color: invert
 RLAPI void ImageColorGrayscale(Image *image);                                                            // Modify image color: grayscale
 RLAPI void ImageColorContrast(Image *image, float contrast);                                             // Modify image color: contrast (-100 to 100)
 RLAPI void ImageColorBrightness(Image *image, int brightness);                                           // Modify image color: brightness (-255 to 255)
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
+RLAPI void ImageColorQuantize(Image *image, int maxColors, bool dither);                                 // Modify image color: quantize to best colors palette (median cut), optional Floyd-Steinberg dithering
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
@@ -1373,6 +1580,23 @@ RLAPI void UnloadImagePalette(Color *colors);
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
+// Image views functions
+// NOTE: Views reference pixel data of another image, no data is copied or freed
+RLAPI ImageView GetImageView(Image image);                                                               // Get view of full image pixel data (uncompressed formats only)
+RLAPI ImageView GetImageViewRec(ImageView view, Rectangle rec);                                          // Get view of a rectangle inside another view (clamped to view bounds)
+RLAPI Image ImageFromView(ImageView view);                                                               // Create an image from view pixel data (packed copy)
+RLAPI void ImageViewCopy(ImageView dst, ImageView src);                                                  // Copy view pixels into another view (size clamped, format converted)
+RLAPI void ImageViewClearBackground(ImageView dst, Color color);                                         // Clear view pixels with given color
+RLAPI void ImageViewProcess(ImageView view, const ImageProcessOp *ops, int count);                       // Apply pixel operations chain to view pixels
+RLAPI void ImageViewDraw(ImageView dst, ImageView src, Rectangle dstRec, Color tint, int blendMode);     // Draw a source view within a destination view (resized to dstRec if required)
+
+// Image atlas functions
+RLAPI ImageAtlas GenImageAtlas(const Image *images, int imageCount, int maxSize, int padding, int flags); // Generate atlas: images packed into smallest power-of-two image (up to maxSize)
+RLAPI ImageAtlas GenImageAtlasFromFiles(const char **fileNames, int fileCount, int maxSize, int padding, int flags); // Generate atlas: images loaded from files packed into smallest power-of-two image
+RLAPI ImageAtlas LoadImageAtlas(int width, int height, int padding, int flags);                          // Load empty atlas of given size, images added with ImageAtlasAdd()
+RLAPI void UnloadImageAtlas(ImageAtlas atlas);                                                           // Unload atlas image, sprites and packer data
+RLAPI int ImageAtlasAdd(ImageAtlas *atlas, Image image);                                                 // Add image to atlas free space, returns sprite index (-1 if it does not fit)
+
 // Image drawing functions
 // NOTE: Image software-rendering functions (CPU)
 RLAPI void ImageClearBackground(Image *dst, Color color);                                                // Clear image background with given color
@@ -1395,6 +1619,7 @@ RLAPI void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3
 RLAPI void ImageDrawTriangleFan(Image *dst, Vector2 *points, int pointCount, Color color);               // Draw a triangle fan defined by points within an image (first vertex is the center)
 RLAPI void ImageDrawTriangleStrip(Image *dst, Vector2 *points, int pointCount, Color color);             // Draw a triangle strip defined by points within an image
 RLAPI void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
+RLAPI void ImageDrawEx(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, int blendMode); // Draw a source image within a destination image with blend mode (BLEND_ALPHA, BLEND_ALPHA_PREMULTIPLY)
 RLAPI void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
 
@@ -1402,6 +1627,8 @@ RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 posi
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
+RLAPI int LoadTextureAsync(const char *fileName);                                                        // Load texture from file asynchronously, returns async asset handle
+RLAPI Texture2D GetAssetTexture(int asset);                                                              // Get texture from async asset handle (ready or failed), handle is released
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI bool IsTextureReady(Texture2D texture);                                                            // Check if a texture is ready
@@ -1410,6 +1637,7 @@ RLAPI bool IsRenderTextureReady(RenderTexture2D target);
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RLAPI int UpdateTextureAtlas(Texture2D texture, ImageAtlas *atlas, Image image);                         // Add image to atlas and update atlas texture sprite region, returns sprite index (-1 if it does not fit)
 
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
@@ -1453,6 +1681,8 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI int LoadFontAsync(const char *fileName);                                              // Load font from file asynchronously, returns async asset handle
+RLAPI Font GetAssetFont(int asset);                                                         // Get font from async asset handle (ready or failed), handle is released
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
@@ -1489,19 +1719,25 @@ RLAPI const char *CodepointToUTF8(int codepoint, int *utf8Size);        // Encod
 
 // Text strings management functions (no UTF-8 strings, only byte chars)
 // NOTE: Some strings allocate memory internally for returned strings, just be careful!
+// NOTE: Functions returning const char * use per-thread static buffers, *Buffer() versions write into provided buffer
 RLAPI int TextCopy(char *dst, const char *src);                                             // Copy one string to another, returns bytes copied
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
 RLAPI const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf() style)
+RLAPI int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...);            // Text formatting with variables into buffer, returns formatted text length
 RLAPI const char *TextSubtext(const char *text, int position, int length);                  // Get a piece of a text string
+RLAPI int TextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length); // Get a piece of a text string into buffer, returns bytes copied
 RLAPI char *TextReplace(const char *text, const char *replace, const char *by);             // Replace text string (WARNING: memory must be freed!)
 RLAPI char *TextInsert(const char *text, const char *insert, int position);                 // Insert text in a position (WARNING: memory must be freed!)
 RLAPI const char *TextJoin(const char **textList, int count, const char *delimiter);        // Join text strings with delimiter
+RLAPI int TextJoinBuffer(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter); // Join text strings with delimiter into buffer, returns bytes copied
 RLAPI const char **TextSplit(const char *text, char delimiter, int *count);                 // Split text into multiple strings
 RLAPI void TextAppend(char *text, const char *append, int *position);                       // Append text at specific position and move cursor!
 RLAPI int TextFindIndex(const char *text, const char *find);                                // Find first text occurrence within a string
 RLAPI const char *TextToUpper(const char *text);                      // Get upper case version of provided string
 RLAPI const char *TextToLower(const char *text);                      // Get lower case version of provided string
+RLAPI int TextToUpperBuffer(char *buffer, int bufferSize, const char *text); // Get upper case version of provided string into buffer, returns bytes copied
+RLAPI int TextToLowerBuffer(char *buffer, int bufferSize, const char *text); // Get lower case version of provided string into buffer, returns bytes copied
 RLAPI const char *TextToPascal(const char *text);                     // Get Pascal case notation version of provided string
 RLAPI const char *TextToSnake(const char *text);                      // Get Snake case notation version of provided string
 RLAPI const char *TextToCamel(const char *text);                      // Get Camel case notation version of provided string
@@ -1543,6 +1779,8 @@ RLAPI void DrawGrid(int slices, float spacing);
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
+RLAPI int LoadModelAsync(const char *fileName);                                             // Load model from files asynchronously, returns async asset handle
+RLAPI Model GetAssetModel(int asset);                                                       // Get model from async asset handle (ready or failed), handle is released
 RLAPI bool IsModelReady(Model model);                                                       // Check if a model is ready
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
@@ -1627,6 +1865,8 @@ RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileDat
 RLAPI bool IsWaveReady(Wave wave);                                    // Checks if wave data is ready
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+RLAPI int LoadSoundAsync(const char *fileName);                       // Load sound from file asynchronously, returns async asset handle
+RLAPI Sound GetAssetSound(int asset);                                 // Get sound from async asset handle (ready or failed), handle is released
 RLAPI Sound LoadSoundAlias(Sound source);                             // Create a new sound that shares the same sample data as the source sound, does not own the sound data
 RLAPI bool IsSoundReady(Sound sound);                                 // Checks if a sound is ready
 RLAPI void UpdateSound(Sound sound, const void *data, int sampleCount); // Update sound buffer with new data
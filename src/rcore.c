@@ -55,6 +55,10 @@
 *       #define SUPPORT_AUTOMATION_EVENTS
 *           Support automatic events recording and playing, useful for automated testing systems or AI based game playing
 *
+*       #define SUPPORT_JOB_SYSTEM
+*           Support job system API: worker threads with work-stealing queues, jobs submission, completion counters
+*           and parallel-for, also used internally to split CPU-heavy work, jobs run synchronously if not initialized
+*
 *   DEPENDENCIES:
 *       raymath  - 3D math functionality (Vector2, Vector3, Matrix, Quaternion)
 *       camera   - Multiple 3D camera modes (free, orbital, 1st person, 3rd person)
@@ -109,6 +113,25 @@
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
+#include <stdint.h>                 // Required for: intptr_t [Used in InitJobSystem()]
+
+#if defined(SUPPORT_RESOURCE_TRACKING)
+    // Resources registry hooks for rlgl GPU objects
+    // NOTE: GPU objects names are unique per object type, depth buffers are registered
+    // as render textures along with framebuffers, so their names are tagged on id upper bits
+    void TrackResource(int type, unsigned long long id, long long cpuBytes, long long gpuBytes);
+    void UntrackResource(int type, unsigned long long id);
+
+    #define RL_RESOURCE_TEXTURE(id)             RESOURCE_TEXTURE, (unsigned long long)(id)
+    #define RL_RESOURCE_FRAMEBUFFER(id)         RESOURCE_RENDER_TEXTURE, (unsigned long long)(id)
+    #define RL_RESOURCE_DEPTH_TEXTURE(id)       RESOURCE_RENDER_TEXTURE, ((1ULL << 32) | (unsigned long long)(id))
+    #define RL_RESOURCE_DEPTH_RENDERBUFFER(id)  RESOURCE_RENDER_TEXTURE, ((2ULL << 32) | (unsigned long long)(id))
+    #define RL_RESOURCE_BUFFER(id)              RESOURCE_BUFFER, (unsigned long long)(id)
+    #define RL_RESOURCE_SHADER(id)              RESOURCE_SHADER, (unsigned long long)(id)
+
+    #define RL_TRACK_RESOURCE(object, id, size) TrackResource(RL_RESOURCE_##object(id), 0, (long long)(size))
+    #define RL_UNTRACK_RESOURCE(object, id)     UntrackResource(RL_RESOURCE_##object(id))
+#endif
 
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
@@ -165,6 +188,7 @@ unsigned int __stdcall timeBeginPeriod(unsigned int uPeriod);
 unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
 #elif defined(__linux__)
     #include <unistd.h>
+    #include <sys/inotify.h>        // Required for: inotify_init1(), inotify_add_watch() [Used in WatchFile(), PollFileChanges()]
 #elif defined(__FreeBSD__)
     #include <sys/types.h>
     #include <sys/sysctl.h>
@@ -180,6 +204,9 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
 #if !defined(S_ISREG) && defined(S_IFMT) && defined(S_IFREG)
     #define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
 #endif
+#if !defined(S_ISDIR) && defined(S_IFMT) && defined(S_IFDIR)
+    #define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
 
 #if defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
     #define DIRENT_MALLOC RL_MALLOC
@@ -207,7 +234,10 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_FILEPATH_CAPACITY
-    #define MAX_FILEPATH_CAPACITY       8192        // Maximum capacity for filepath
+    #define MAX_FILEPATH_CAPACITY       8192        // Initial capacity for filepaths list, grown on demand
+#endif
+#ifndef DIRECTORY_SCAN_JOB_CAPACITY
+    #define DIRECTORY_SCAN_JOB_CAPACITY   16        // Initial capacity for subtree filepaths list scanned by a job, grown on demand
 #endif
 #ifndef MAX_FILEPATH_LENGTH
     #if defined(_WIN32)
@@ -244,6 +274,9 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
 #ifndef MAX_CHAR_PRESSED_QUEUE
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
+#ifndef MAX_INPUT_EVENTS
+    #define MAX_INPUT_EVENTS             512        // Maximum number of timestamped input events queued, power of two (EnableInputEvents())
+#endif
 
 #ifndef MAX_DECOMPRESSION_SIZE
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
@@ -253,9 +286,17 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef MAX_JOB_WORKERS
+    #define MAX_JOB_WORKERS               64        // Maximum number of job system worker threads
+#endif
+
+#ifndef MAX_FILE_WATCH_POLL_COUNT
+    #define MAX_FILE_WATCH_POLL_COUNT     64        // Maximum number of watched paths checked per PollFileChanges() call (polling mode)
+#endif
+
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
-#endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and LoadDirectoryFilesEx()
+#endif                                              // NOTE: Used in OpenDirectoryScan() and LoadDirectoryFilesEx()
 
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
@@ -269,6 +310,146 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
 
+// Directory scan level, one directory stream opened per depth level
+typedef struct DirectoryScanLevel {
+    DIR *dir;                           // Directory stream
+    int pathLength;                     // Directory path length (scan path up to this level)
+} DirectoryScanLevel;
+
+// Directory scan iterator
+// NOTE: Opaque struct declared in raylib.h
+struct rDirectoryScan {
+    char path[MAX_FILEPATH_LENGTH];     // Current scanned path, entries names are appended in-place
+    char *filter;                       // Extensions filter (copy), NULL for no filtering
+    bool includeDirs;                   // Directories included in results (filter contains DIRECTORY_FILTER_TAG)
+    bool recursive;                     // Scan subdirectories
+    bool isDirectory;                   // Last returned entry is a directory
+
+    DirectoryScanLevel *levels;         // Opened directory levels (stack)
+    int levelCount;                     // Opened directory levels count
+    int levelCapacity;                  // Opened directory levels capacity
+};
+
+// File watch entry
+typedef struct FileWatch {
+    char *path;                         // Watched path (file or directory)
+    bool isDirectory;                   // Watched path is a directory (changes reported for contained files)
+    bool implicit;                      // Watch added for a directory file (polling mode)
+    int wd;                             // Watch descriptor (inotify, parent directory for files), -1 for polling
+    long modTime;                       // Last modification time (polling mode)
+    long size;                          // Last file size (polling mode), modification time resolution could be too low
+} FileWatch;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+// Job, unit of work for the job system
+typedef struct Job {
+    JobCallback callback;               // Job function
+    void *userData;                     // Job function user data
+    JobCounter *counter;                // Completion counter (optional)
+} Job;
+
+// Job queue, ring buffer double-ended queue
+// NOTE: Owner worker pushes/pops jobs at the back (LIFO, cache-friendly),
+// other threads steal jobs from the front (FIFO, oldest and usually biggest jobs)
+typedef struct JobQueue {
+    rMutex mutex;                       // Queue access mutex
+    Job *jobs;                          // Jobs ring buffer
+    int capacity;                       // Jobs ring buffer capacity
+    int head;                           // First job index
+    int count;                          // Queued jobs count
+} JobQueue;
+
+// Job system state
+typedef struct JobSystem {
+    bool ready;                         // Job system initialized
+    bool running;                       // Workers running, set to false to request workers exit
+    int workerCount;                    // Worker threads count
+    rThread *workers;                   // Worker threads
+    JobQueue *queues;                   // Jobs queues: one per worker plus one shared queue (last) for external threads
+    int queueCount;                     // Jobs queues count
+    int pendingCount;                   // Queued jobs count, all queues (atomic)
+    rMutex sleepMutex;                  // Idle workers sleep mutex
+    rCondition sleepCondition;          // Idle workers sleep condition
+} JobSystem;
+
+// Parallel-for range, job data
+typedef struct ParallelForRange {
+    ParallelForCallback callback;       // Range function
+    void *userData;                     // Range function user data
+    int start;                          // Range start (inclusive)
+    int end;                            // Range end (exclusive)
+} ParallelForRange;
+
+// Directory subtree scan, job data
+typedef struct DirectoryScanEntry {
+    char *path;                         // Entry path
+    bool isDirectory;                   // Entry is a directory, subtree scanned into files
+    const char *filter;                 // Subtree scan extensions filter
+    FilePathList files;                 // Subtree scanned filepaths
+} DirectoryScanEntry;
+#endif
+
+// Async asset deferred GPU upload
+typedef struct AsyncUpload {
+    unsigned int (*upload)(void *data); // Upload function (main thread), returns GPU resource id, releases data
+    void (*release)(void *data);        // Release function, releases data if upload is not done (asset failed), NULL if not required
+    void *data;                         // Upload function data
+    unsigned int id;                    // Uploaded GPU resource id
+} AsyncUpload;
+
+// Async asset, loaded on a worker thread and uploaded to GPU on main thread
+// NOTE: Asset type and data are defined by the loading module, load function identifies the type
+typedef struct AsyncAsset {
+    int state;                          // Asset state (AssetState), atomic
+    void *data;                         // Asset data
+    bool (*load)(void *data);           // Load function (worker thread), returns false on failure
+    void (*upload)(void *data);         // Upload function (main thread), called once all deferred uploads are done
+    void (*unload)(void *data);         // Unload function (main thread), unloads asset data not retrieved on CloseWindow()
+    AsyncUpload *uploads;               // Deferred GPU uploads, requested by load function
+    int uploadCount;                    // Deferred GPU uploads count
+    int uploadCapacity;                 // Deferred GPU uploads capacity
+    int uploadIndex;                    // Next deferred GPU upload to process
+} AsyncAsset;
+
+// Input event slot, queued timestamped input event
+typedef struct InputEventSlot {
+    unsigned int sequence;              // Slot sequence (atomic), equals write position when free, position + 1 when written
+    InputEvent event;                   // Input event
+} InputEventSlot;
+
+// Input events queue, bounded multiple-producers single-consumer lock-free ring of events
+// NOTE: Platform backends push events as they are received (possibly from an input thread),
+// events are drained by user on main thread with GetInputEvents(), events are dropped if ring is full
+typedef struct InputEventQueue {
+    InputEventSlot slots[MAX_INPUT_EVENTS]; // Events ring
+    unsigned int head;                  // Next event write position (atomic)
+    unsigned int tail;                  // Next event read position (main thread)
+    int dropped;                        // Events dropped, ring full (atomic)
+    int enabled;                        // Input events queueing enabled (atomic)
+    bool ready;                         // Ring slots sequences initialized
+} InputEventQueue;
+
+#if defined(SUPPORT_RESOURCE_TRACKING)
+#define MAX_RESOURCE_TYPES      6       // Resource types count (ResourceType)
+
+// Resource entry, registered on load by modules chokepoints
+typedef struct ResourceEntry {
+    unsigned long long id;              // Resource id, unique per resource type (0: empty entry)
+    int type;                           // Resource type (ResourceType)
+    long long cpuBytes;                 // Memory used on CPU side (bytes)
+    long long gpuBytes;                 // Estimated memory used on GPU side (bytes)
+} ResourceEntry;
+
+// Resources registry, live resources hash table and usage per type
+// NOTE: Open addressing with linear probing, entries are removed with backward shift (no tombstones)
+typedef struct ResourceRegistry {
+    ResourceEntry *entries;             // Resources entries
+    int capacity;                       // Resources entries capacity (power of two)
+    int count;                          // Live resources count
+    ResourceUsage usage[MAX_RESOURCE_TYPES]; // Live resources usage per type
+} ResourceRegistry;
+#endif
+
 // Core global state context data
 typedef struct CoreData {
     struct {
@@ -473,6 +654,38 @@ static AutomationEventList *currentEventList = NULL;        // Current automatio
 static bool automationEventRecording = false;               // Recording automation events flag
 //static short automationEventEnabled = 0b0000001111111111; // TODO: Automation events enabled for recording/playing
 #endif
+
+// File watcher state
+// NOTE: On Linux inotify is used, watching the parent directory of watched files because
+// most editors replace the file on save and a watch on the file itself would be lost,
+// on other platforms (or if inotify fails) watched paths modification time is polled
+static FileWatch *fileWatches = NULL;       // File watches array
+static int fileWatchCount = 0;              // File watches count
+static int fileWatchCapacity = 0;           // File watches capacity
+static int fileWatchPollIndex = 0;          // Next file watch to poll (round-robin, polling mode)
+static int fileWatcherFd = -1;              // File watcher descriptor (inotify)
+static bool fileWatcherReady = false;       // File watcher initialized
+static FilePathList fileChanges = { 0 };    // Changed filepaths on last poll (coalesced)
+
+#if defined(SUPPORT_JOB_SYSTEM)
+static JobSystem jobSystem = { 0 };                 // Job system state
+static RL_THREAD_LOCAL int jobWorkerIndex = -1;     // Current thread job worker index, -1 for non-worker threads
+#endif
+
+static AsyncAsset **asyncAssets = NULL;             // Async assets slots, asset handle is slot index + 1
+static int asyncAssetCapacity = 0;                  // Async assets slots capacity
+static rMutex asyncAssetsMutex = RL_MUTEX_INITIALIZER;  // Async assets slots mutex
+static float asyncUploadBudget = ASYNC_UPLOAD_BUDGET;   // Async assets GPU upload time budget per frame (milliseconds)
+static AsyncAsset *asyncAssetUploading = NULL;      // Async asset being uploaded (main thread)
+static RL_THREAD_LOCAL AsyncAsset *asyncAssetLoading = NULL;    // Async asset being loaded by current thread
+
+static InputEventQueue inputEvents = { 0 };         // Timestamped input events queue
+
+#if defined(SUPPORT_RESOURCE_TRACKING)
+static ResourceRegistry resources = { 0 };          // Resources registry
+static rMutex resourcesMutex = RL_MUTEX_INITIALIZER;    // Resources registry mutex, audio buffers could be loaded on worker threads
+static const char *resourceTypeNames[MAX_RESOURCE_TYPES] = { "Texture", "Render texture", "Buffer", "Shader", "Sound", "Audio stream" };
+#endif
 //-----------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------
@@ -484,6 +697,9 @@ static bool automationEventRecording = false;               // Recording automat
 extern void LoadFontDefault(void);      // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadMeshInstancesBuffer(void);    // [Module: models] Unloads DrawMeshInstanced() instances buffer from GPU memory
+#endif
 
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
@@ -492,8 +708,33 @@ static void InitTimer(void);                                // Initialize timer,
 static void SetupFramebuffer(int width, int height);        // Setup main framebuffer (required by InitPlatform())
 static void SetupViewport(int width, int height);           // Set viewport for a provided width and height
 
-static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
+static void ScanDirectoryFiles(rDirectoryScan *scan, FilePathList *files); // Scan all directory files into a filepaths list, growing it as required
+static bool AddFileWatch(const char *path, bool isDirectory, bool implicit); // Add file watch entry, initializing file watcher if required
+static void AddFileChange(const char *path);                // Add changed filepath to current changes list, duplicates are coalesced
+static void AddFilePath(FilePathList *files, char *path);   // Add filepath to list (takes ownership), growing it as required
+
+#if defined(SUPPORT_JOB_SYSTEM)
+static void JobWorkerThread(void *arg);                     // Job system worker thread loop
+static void PushJob(JobQueue *queue, Job job);              // Push job at the back of a queue
+static bool PopJob(JobQueue *queue, Job *job, bool back);   // Pop job from the back (owner) or front (steal) of a queue
+static bool GetNextJob(Job *job);                           // Get next job to run: own queue, shared queue, then steal from other workers
+static void RunJob(Job *job);                               // Run job and update its completion counter
+static void ParallelForJob(void *userData);                 // Parallel-for range job
+static void ScanDirectoryEntryJob(void *userData);          // Directory subtree scan job
+#endif
+
+static void LoadAsyncAssetJob(void *userData);              // Async asset loading job
+static void CloseAsyncAssets(void);                         // Unload async assets not retrieved and free slots
+
+#if defined(SUPPORT_RESOURCE_TRACKING)
+static unsigned int GetResourceHash(int type, unsigned long long id); // Get resource hash, for registry hash table
+static int FindResourceEntry(int type, unsigned long long id); // Find resource entry index, or first empty entry index if not registered
+static void TraceLogResourceEntry(int logLevel, ResourceEntry *entry); // Log resource entry info
+static void CloseResourceRegistry(void);                    // Report not unloaded resources and free registry
+#endif
+
+static void PushInputEvent(int type, int device, int code, Vector2 value, double time); // Push timestamped input event to queue (if enabled), called by platform backends
+static bool PopInputEvent(InputEvent *event);               // Pop oldest queued input event, false if queue is empty
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
@@ -657,6 +898,9 @@ void InitWindow(int width, int height, const char *title)
     // Setup default viewport
     SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
 
+    // Main thread temporary memory is released every frame, at EndDrawing()
+    InitTempMemoryFrame();
+
 #if defined(SUPPORT_MODULE_RTEXT)
     #if defined(SUPPORT_DEFAULT_FONT)
         // Load default font
@@ -699,6 +943,9 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+    CloseJobSystem();           // Complete pending jobs and join worker threads (if initialized)
+    CloseAsyncAssets();         // Unload async assets not retrieved (GPU context required)
+
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
@@ -712,8 +959,19 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadMeshInstancesBuffer();    // WARNING: Module required: rmodels
+#endif
+
     rlglClose();                // De-init rlgl
 
+#if defined(SUPPORT_RESOURCE_TRACKING)
+    CloseResourceRegistry();    // Report resources not unloaded
+#endif
+
+    UnwatchFiles();             // Free file watcher and watched/changed files paths (if not unwatched by user)
+    CloseTempMemory();          // Free main thread temporary memory
+
     // De-initialize platform
     //--------------------------------------------------------------
     ClosePlatform();
@@ -721,6 +979,8 @@ void CloseWindow(void)
 
     CORE.Window.ready = false;
     TRACELOG(LOG_INFO, "Window closed successfully");
+
+    SetTraceLogAsync(false);    // Output queued trace log messages (if async output enabled)
 }
 
 // Check if window has been initialized successfully
@@ -911,6 +1171,8 @@ void EndDrawing(void)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+    UpdateAsyncAssets();    // Upload pending async assets to GPU (within time budget)
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
@@ -974,6 +1236,8 @@ void EndDrawing(void)
     }
 #endif  // SUPPORT_SCREEN_CAPTURE
 
+    ResetTempMemoryFrame();     // Release frame temporary memory (RL_TEMP_ALLOC())
+
     CORE.Time.frameCounter++;
 }
 
@@ -1863,239 +2127,794 @@ void SetConfigFlags(unsigned int flags)
 }
 
 //----------------------------------------------------------------------------------
-// Module Functions Definition: File system
+// Module Functions Definition: Job system
 //----------------------------------------------------------------------------------
 
-// Check if the file exists
-bool FileExists(const char *fileName)
+// Initialize job system worker threads
+// NOTE: If workerCount <= 0, processors count - 1 workers are created (calling thread also runs jobs while waiting)
+void InitJobSystem(int workerCount)
 {
-    bool result = false;
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (jobSystem.ready)
+    {
+        TRACELOG(LOG_WARNING, "JOBS: Job system already initialized");
+        return;
+    }
 
-#if defined(_WIN32)
-    if (_access(fileName, 0) != -1) result = true;
-#else
-    if (access(fileName, F_OK) != -1) result = true;
-#endif
+    if (workerCount <= 0) workerCount = rGetProcessorCount() - 1;
+    if (workerCount > MAX_JOB_WORKERS) workerCount = MAX_JOB_WORKERS;
 
-    // NOTE: Alternatively, stat() can be used instead of access()
-    //#include <sys/stat.h>
-    //struct stat statbuf;
-    //if (stat(filename, &statbuf) == 0) result = true;
+    if (workerCount <= 0)
+    {
+        TRACELOG(LOG_INFO, "JOBS: No worker threads available, jobs run on calling thread");
+        return;
+    }
 
-    return result;
-}
+    jobSystem.workerCount = workerCount;
+    jobSystem.queueCount = workerCount + 1;
+    jobSystem.queues = (JobQueue *)RL_CALLOC(jobSystem.queueCount, sizeof(JobQueue));
+    jobSystem.workers = (rThread *)RL_CALLOC(workerCount, sizeof(rThread));
+    jobSystem.pendingCount = 0;
 
-// Check file extension
-// NOTE: Extensions checking is not case-sensitive
-bool IsFileExtension(const char *fileName, const char *ext)
-{
-    #define MAX_FILE_EXTENSION_LENGTH  16
+    for (int i = 0; i < jobSystem.queueCount; i++)
+    {
+        rMutexInit(&jobSystem.queues[i].mutex);
+        jobSystem.queues[i].capacity = 256;
+        jobSystem.queues[i].jobs = (Job *)RL_MALLOC(jobSystem.queues[i].capacity*sizeof(Job));
+    }
 
-    bool result = false;
-    const char *fileExt = GetFileExtension(fileName);
+    rMutexInit(&jobSystem.sleepMutex);
+    rConditionInit(&jobSystem.sleepCondition);
 
-    if (fileExt != NULL)
+    jobSystem.running = true;
+    jobSystem.ready = true;
+
+    int threadCount = 0;
+    for (; threadCount < workerCount; threadCount++)
     {
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = TextSplit(ext, ';', &extCount); // WARNING: Module required: rtext
+        if (!rThreadCreate(&jobSystem.workers[threadCount], JobWorkerThread, (void *)(intptr_t)threadCount)) break;
+    }
 
-        char fileExtLower[MAX_FILE_EXTENSION_LENGTH + 1] = { 0 };
-        strncpy(fileExtLower, TextToLower(fileExt), MAX_FILE_EXTENSION_LENGTH); // WARNING: Module required: rtext
+    // NOTE: Queues of workers that could not be created are only used for stealing (always empty)
+    jobSystem.workerCount = threadCount;
 
-        for (int i = 0; i < extCount; i++)
-        {
-            if (strcmp(fileExtLower, TextToLower(checkExts[i])) == 0)
-            {
-                result = true;
-                break;
-            }
-        }
+    if (threadCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "JOBS: Failed to create worker threads, jobs run on calling thread");
+        CloseJobSystem();
+    }
+    else TRACELOG(LOG_INFO, "JOBS: Job system initialized successfully (%i workers)", threadCount);
 #else
-        if (strcmp(fileExt, ext) == 0) result = true;
+    TRACELOG(LOG_WARNING, "JOBS: Job system not supported, jobs run on calling thread");
 #endif
-    }
-
-    return result;
 }
 
-// Check if a directory path exists
-bool DirectoryExists(const char *dirPath)
+// Close job system, pending jobs are completed before closing
+void CloseJobSystem(void)
 {
-    bool result = false;
-    DIR *dir = opendir(dirPath);
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (jobSystem.queues == NULL) return;
 
-    if (dir != NULL)
+    rMutexLock(&jobSystem.sleepMutex);
+    jobSystem.running = false;
+    rConditionBroadcast(&jobSystem.sleepCondition);
+    rMutexUnlock(&jobSystem.sleepMutex);
+
+    for (int i = 0; i < jobSystem.workerCount; i++) rThreadJoin(jobSystem.workers[i]);
+
+    // NOTE: Queues allocated for all requested workers, even if not all threads were created
+    for (int i = 0; i < jobSystem.queueCount; i++)
     {
-        result = true;
-        closedir(dir);
+        rMutexDestroy(&jobSystem.queues[i].mutex);
+        RL_FREE(jobSystem.queues[i].jobs);
     }
 
-    return result;
+    rConditionDestroy(&jobSystem.sleepCondition);
+    rMutexDestroy(&jobSystem.sleepMutex);
+
+    RL_FREE(jobSystem.queues);
+    RL_FREE(jobSystem.workers);
+
+    bool wasReady = (jobSystem.workerCount > 0);
+    jobSystem = (JobSystem){ 0 };
+
+    if (wasReady) TRACELOG(LOG_INFO, "JOBS: Job system closed successfully");
+#endif
 }
 
-// Get file length in bytes
-// NOTE: GetFileSize() conflicts with windows.h
-int GetFileLength(const char *fileName)
+// Get job system worker threads count (0 if not initialized)
+int GetJobWorkerCount(void)
 {
-    int size = 0;
-
-    // NOTE: On Unix-like systems, it can by used the POSIX system call: stat(),
-    // but depending on the platform that call could not be available
-    //struct stat result = { 0 };
-    //stat(fileName, &result);
-    //return result.st_size;
+#if defined(SUPPORT_JOB_SYSTEM)
+    return jobSystem.workerCount;
+#else
+    return 0;
+#endif
+}
 
-    FILE *file = fopen(fileName, "rb");
+// Submit job for execution, counter (optional) tracks job completion
+// NOTE: Safe to call from any thread, including jobs, if job system is not initialized job runs immediately
+void SubmitJob(JobCallback callback, void *userData, JobCounter *counter)
+{
+    if (callback == NULL) return;
 
-    if (file != NULL)
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (jobSystem.ready)
     {
-        fseek(file, 0L, SEEK_END);
-        long int fileSize = ftell(file);
+        Job job = { callback, userData, counter };
 
-        // Check for size overflow (INT_MAX)
-        if (fileSize > 2147483647) TRACELOG(LOG_WARNING, "[%s] File size overflows expected limit, do not use GetFileLength()", fileName);
-        else size = (int)fileSize;
+        if (counter != NULL) RL_ATOMIC_ADD(&counter->pending, 1);
 
-        fclose(file);
+        // Workers push to their own queue, other threads to the shared queue
+        PushJob(&jobSystem.queues[(jobWorkerIndex >= 0)? jobWorkerIndex : (jobSystem.queueCount - 1)], job);
+        RL_ATOMIC_ADD(&jobSystem.pendingCount, 1);
+
+        // NOTE: Signal done with sleep mutex locked, idle workers check pending jobs with it locked
+        rMutexLock(&jobSystem.sleepMutex);
+        rConditionSignal(&jobSystem.sleepCondition);
+        rMutexUnlock(&jobSystem.sleepMutex);
+
+        return;
     }
+#endif
 
-    return size;
+    callback(userData);
 }
 
-// Get pointer to extension for a filename string (includes the dot: .png)
-const char *GetFileExtension(const char *fileName)
+// Wait for counter jobs completion
+// NOTE: Calling thread runs pending jobs while waiting, so waiting from a job does not stall a worker
+void WaitJobCounter(JobCounter *counter)
 {
-    const char *dot = strrchr(fileName, '.');
+    if (counter == NULL) return;
 
-    if (!dot || dot == fileName) return NULL;
+#if defined(SUPPORT_JOB_SYSTEM)
+    while (RL_ATOMIC_LOAD(&counter->pending) > 0)
+    {
+        Job job = { 0 };
 
-    return dot;
+        if (jobSystem.ready && GetNextJob(&job)) RunJob(&job);
+        else rThreadYield();
+    }
+#endif
 }
 
-// String pointer reverse break: returns right-most occurrence of charset in s
-static const char *strprbrk(const char *s, const char *charset)
+// Check if all counter jobs have been completed
+bool IsJobCounterDone(JobCounter *counter)
 {
-    const char *latestMatch = NULL;
+    bool result = true;
 
-    for (; s = strpbrk(s, charset), s != NULL; latestMatch = s++) { }
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (counter != NULL) result = (RL_ATOMIC_LOAD(&counter->pending) == 0);
+#endif
 
-    return latestMatch;
+    return result;
 }
 
-// Get pointer to filename for a path string
-const char *GetFileName(const char *filePath)
+// Run callback over [0, count) split in ranges across workers, blocks until all ranges are completed
+// NOTE: If batchSize <= 0, range size is computed to get a few ranges per worker (load balancing)
+void ParallelFor(int count, int batchSize, ParallelForCallback callback, void *userData)
 {
-    const char *fileName = NULL;
+    if ((count <= 0) || (callback == NULL)) return;
 
-    if (filePath != NULL) fileName = strprbrk(filePath, "\\/");
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (jobSystem.ready)
+    {
+        if (batchSize <= 0) batchSize = count/((jobSystem.workerCount + 1)*4);
+        if (batchSize < 1) batchSize = 1;
 
-    if (fileName == NULL) return filePath;
+        int rangeCount = (count + batchSize - 1)/batchSize;
 
-    return fileName + 1;
+        if (rangeCount > 1)
+        {
+            ParallelForRange stackRanges[64] = { 0 };
+            ParallelForRange *ranges = (rangeCount <= 64)? stackRanges : (ParallelForRange *)RL_MALLOC(rangeCount*sizeof(ParallelForRange));
+            JobCounter counter = { 0 };
+
+            for (int i = 0; i < rangeCount; i++)
+            {
+                ranges[i].callback = callback;
+                ranges[i].userData = userData;
+                ranges[i].start = i*batchSize;
+                ranges[i].end = ((i + 1)*batchSize < count)? (i + 1)*batchSize : count;
+            }
+
+            // Calling thread runs the first range, waiting for the others running pending jobs
+            for (int i = 1; i < rangeCount; i++) SubmitJob(ParallelForJob, &ranges[i], &counter);
+            ParallelForJob(&ranges[0]);
+            WaitJobCounter(&counter);
+
+            if (ranges != stackRanges) RL_FREE(ranges);
+
+            return;
+        }
+    }
+#endif
+
+    callback(0, count, userData);
 }
 
-// Get filename string without extension (uses static string)
-const char *GetFileNameWithoutExt(const char *filePath)
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Async assets
+//----------------------------------------------------------------------------------
+
+// Get async asset loading state (AssetState)
+int GetAssetState(int asset)
 {
-    #define MAX_FILENAME_LENGTH     256
+    int state = ASSET_STATE_INVALID;
 
-    static char fileName[MAX_FILENAME_LENGTH] = { 0 };
-    memset(fileName, 0, MAX_FILENAME_LENGTH);
+    // NOTE: Slot state read while locked, slot can not be released meanwhile
+    rMutexLock(&asyncAssetsMutex);
+    if ((asset > 0) && (asset <= asyncAssetCapacity) && (asyncAssets[asset - 1] != NULL)) state = RL_ATOMIC_LOAD(&asyncAssets[asset - 1]->state);
+    rMutexUnlock(&asyncAssetsMutex);
 
-    if (filePath != NULL)
+    return state;
+}
+
+// Check if async asset is ready to be retrieved
+bool IsAssetReady(int asset)
+{
+    return (GetAssetState(asset) == ASSET_STATE_READY);
+}
+
+// Set async assets GPU upload time budget per frame
+// NOTE: At least one upload is processed per frame, if milliseconds <= 0 all pending uploads are processed
+void SetAsyncUploadBudget(float milliseconds)
+{
+    asyncUploadBudget = milliseconds;
+}
+
+// Upload pending async assets to GPU within time budget
+// NOTE: Called by EndDrawing(), it must be called from main thread (GPU context),
+// every deferred upload is a step, assets upload function is called once all its uploads are done
+void UpdateAsyncAssets(void)
+{
+    double startTime = GetTime();
+    double budget = asyncUploadBudget/1000.0;
+    int stepCount = 0;
+
+    for (int i = 0; ; i++)
     {
-        strcpy(fileName, GetFileName(filePath)); // Get filename.ext without path
-        int size = (int)strlen(fileName); // Get size in bytes
+        // NOTE: Uploading assets can not be released, asset is valid until its state is set to ready
+        rMutexLock(&asyncAssetsMutex);
+        if (i >= asyncAssetCapacity) { rMutexUnlock(&asyncAssetsMutex); break; }
+        AsyncAsset *asset = asyncAssets[i];
+        if ((asset != NULL) && (RL_ATOMIC_LOAD(&asset->state) != ASSET_STATE_UPLOADING)) asset = NULL;
+        rMutexUnlock(&asyncAssetsMutex);
 
-        for (int i = size; i > 0; i--) // Reverse search '.'
+        if (asset == NULL) continue;
+
+        while (true)
         {
-            if (fileName[i] == '.')
+            if ((stepCount > 0) && (budget > 0.0) && ((GetTime() - startTime) >= budget)) return;
+            stepCount++;
+
+            if (asset->uploadIndex < asset->uploadCount)
             {
-                // NOTE: We break on first '.' found
-                fileName[i] = '\0';
+                AsyncUpload *upload = &asset->uploads[asset->uploadIndex];
+                upload->id = upload->upload(upload->data);
+                asset->uploadIndex++;
+            }
+            else
+            {
+                // Asset upload function resolves placeholder ids with GetAsyncUploadId()
+                asyncAssetUploading = asset;
+                if (asset->upload != NULL) asset->upload(asset->data);
+                asyncAssetUploading = NULL;
+
+                RL_FREE(asset->uploads);
+                asset->uploads = NULL;
+                asset->uploadCount = 0;
+                asset->uploadCapacity = 0;
+
+                RL_ATOMIC_CAS(&asset->state, ASSET_STATE_UPLOADING, ASSET_STATE_READY);
                 break;
             }
         }
     }
-
-    return fileName;
 }
 
-// Get directory for a given filePath
-const char *GetDirectoryPath(const char *filePath)
+// Add async asset, load function is submitted to the job system
+// NOTE: Internal function, used by modules Load*Async() functions
+int AddAsyncAsset(void *data, bool (*load)(void *data), void (*upload)(void *data), void (*unload)(void *data))
 {
-    /*
-    // NOTE: Directory separator is different in Windows and other platforms,
-    // fortunately, Windows also support the '/' separator, that's the one should be used
-    #if defined(_WIN32)
-        char separator = '\\';
-    #else
-        char separator = '/';
-    #endif
-    */
-    const char *lastSlash = NULL;
-    static char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(dirPath, 0, MAX_FILEPATH_LENGTH);
+    AsyncAsset *asset = (AsyncAsset *)RL_CALLOC(1, sizeof(AsyncAsset));
+    asset->state = ASSET_STATE_LOADING;
+    asset->data = data;
+    asset->load = load;
+    asset->upload = upload;
+    asset->unload = unload;
 
-    // In case provided path does not contain a root drive letter (C:\, D:\) nor leading path separator (\, /),
-    // we add the current directory path to dirPath
-    if (filePath[1] != ':' && filePath[0] != '\\' && filePath[0] != '/')
+    rMutexLock(&asyncAssetsMutex);
+
+    int index = 0;
+    while ((index < asyncAssetCapacity) && (asyncAssets[index] != NULL)) index++;
+
+    if (index == asyncAssetCapacity)
     {
-        // For security, we set starting path to current directory,
-        // obtained path will be concatenated to this
-        dirPath[0] = '.';
-        dirPath[1] = '/';
+        int capacity = (asyncAssetCapacity > 0)? asyncAssetCapacity*2 : 16;
+        AsyncAsset **slots = (AsyncAsset **)RL_REALLOC(asyncAssets, capacity*sizeof(AsyncAsset *));
+
+        for (int i = asyncAssetCapacity; i < capacity; i++) slots[i] = NULL;
+        asyncAssets = slots;
+        asyncAssetCapacity = capacity;
     }
 
-    lastSlash = strprbrk(filePath, "\\/");
-    if (lastSlash)
+    asyncAssets[index] = asset;
+
+    rMutexUnlock(&asyncAssetsMutex);
+
+    SubmitJob(LoadAsyncAssetJob, asset, NULL);
+
+    return index + 1;
+}
+
+// Release async asset handle, returns asset data (ready or failed) to be retrieved by the loading module
+// NOTE: Internal function, NULL is returned if asset is not valid, not loaded yet or loaded by a different function
+void *ReleaseAsyncAsset(int asset, bool (*load)(void *data))
+{
+    AsyncAsset *slot = NULL;
+    bool valid = false;
+    void *data = NULL;
+
+    // Slot checked and cleared in a single locked section, only one release can take the slot
+    rMutexLock(&asyncAssetsMutex);
+    if ((asset > 0) && (asset <= asyncAssetCapacity) && (asyncAssets[asset - 1] != NULL) && (asyncAssets[asset - 1]->load == load))
     {
-        if (lastSlash == filePath)
+        valid = true;
+        int state = RL_ATOMIC_LOAD(&asyncAssets[asset - 1]->state);
+
+        if ((state == ASSET_STATE_READY) || (state == ASSET_STATE_FAILED))
         {
-            // The last and only slash is the leading one: path is in a root directory
-            dirPath[0] = filePath[0];
-            dirPath[1] = '\0';
+            slot = asyncAssets[asset - 1];
+            asyncAssets[asset - 1] = NULL;
         }
-        else
+    }
+    rMutexUnlock(&asyncAssetsMutex);
+
+    if (slot != NULL)
+    {
+        data = slot->data;
+
+        // Release data of deferred uploads not done (asset failed to load)
+        for (int i = slot->uploadIndex; i < slot->uploadCount; i++)
         {
-            // NOTE: Be careful, strncpy() is not safe, it does not care about '\0'
-            char *dirPathPtr = dirPath;
-            if ((filePath[1] != ':') && (filePath[0] != '\\') && (filePath[0] != '/')) dirPathPtr += 2;     // Skip drive letter, "C:"
-            memcpy(dirPathPtr, filePath, strlen(filePath) - (strlen(lastSlash) - 1));
-            dirPath[strlen(filePath) - strlen(lastSlash) + (((filePath[1] != ':') && (filePath[0] != '\\') && (filePath[0] != '/'))? 2 : 0)] = '\0';  // Add '\0' manually
+            if (slot->uploads[i].release != NULL) slot->uploads[i].release(slot->uploads[i].data);
         }
+
+        RL_FREE(slot->uploads);
+        RL_FREE(slot);
     }
+    else if (!valid) TRACELOG(LOG_WARNING, "ASYNC: [ID %i] Asset handle not valid for requested type", asset);
+    else TRACELOG(LOG_WARNING, "ASYNC: [ID %i] Asset not ready to be retrieved", asset);
 
-    return dirPath;
+    return data;
 }
 
-// Get previous directory path for a given path
-const char *GetPrevDirectoryPath(const char *dirPath)
+// Check if current thread is loading an async asset
+// NOTE: Internal function, GPU is not available while loading, uploads must be deferred with AddAsyncUpload()
+bool IsAsyncAssetLoading(void)
 {
-    static char prevDirPath[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(prevDirPath, 0, MAX_FILEPATH_LENGTH);
-    int pathLen = (int)strlen(dirPath);
+    return (asyncAssetLoading != NULL);
+}
 
-    if (pathLen <= 3) strcpy(prevDirPath, dirPath);
+// Add deferred GPU upload to async asset being loaded, returns a placeholder GPU resource id
+// NOTE: Internal function, upload function runs on main thread before asset upload function,
+// placeholder id can be resolved into the uploaded resource id with GetAsyncUploadId(),
+// release function (optional) is called instead of upload function if asset fails to load
+unsigned int AddAsyncUpload(unsigned int (*upload)(void *data), void (*release)(void *data), void *data)
+{
+    AsyncAsset *asset = asyncAssetLoading;
 
-    for (int i = (pathLen - 1); (i >= 0) && (pathLen > 3); i--)
+    if (asset->uploadCount >= asset->uploadCapacity)
     {
-        if ((dirPath[i] == '\\') || (dirPath[i] == '/'))
-        {
-            // Check for root: "C:\" or "/"
-            if (((i == 2) && (dirPath[1] ==':')) || (i == 0)) i++;
-
-            strncpy(prevDirPath, dirPath, i);
-            break;
-        }
+        asset->uploadCapacity = (asset->uploadCapacity > 0)? asset->uploadCapacity*2 : 8;
+        asset->uploads = (AsyncUpload *)RL_REALLOC(asset->uploads, asset->uploadCapacity*sizeof(AsyncUpload));
     }
 
-    return prevDirPath;
+    asset->uploads[asset->uploadCount] = (AsyncUpload){ upload, release, data, 0 };
+    asset->uploadCount++;
+
+    return (0x80000000u | (unsigned int)asset->uploadCount);
 }
 
-// Get current working directory
-const char *GetWorkingDirectory(void)
+// Get uploaded GPU resource id from an async upload placeholder id, other ids are returned unchanged
+// NOTE: Internal function, only valid within async asset upload function
+unsigned int GetAsyncUploadId(unsigned int id)
+{
+    AsyncAsset *asset = asyncAssetUploading;
+
+    if ((asset != NULL) && ((id & 0x80000000u) != 0))
+    {
+        int index = (int)(id & 0x7fffffffu) - 1;
+        if ((index >= 0) && (index < asset->uploadCount)) id = asset->uploads[index].id;
+    }
+
+    return id;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Resources registry
+//----------------------------------------------------------------------------------
+
+// Get live resources count and memory usage for a resource type
+// NOTE: Usage is only tracked with SUPPORT_RESOURCE_TRACKING, zero usage is returned otherwise
+ResourceUsage GetResourceUsage(int type)
+{
+    ResourceUsage usage = { 0 };
+
+#if defined(SUPPORT_RESOURCE_TRACKING)
+    if ((type >= 0) && (type < MAX_RESOURCE_TYPES))
+    {
+        rMutexLock(&resourcesMutex);
+        usage = resources.usage[type];
+        rMutexUnlock(&resourcesMutex);
+    }
+#else
+    (void)type;
+#endif
+
+    return usage;
+}
+
+// Log live resources usage per type, and every live resource with LOG_DEBUG level
+void TraceLogResources(void)
+{
+#if defined(SUPPORT_RESOURCE_TRACKING)
+    rMutexLock(&resourcesMutex);
+
+    TRACELOG(LOG_INFO, "RESOURCES: Live resources: %i", resources.count);
+    for (int i = 0; i < MAX_RESOURCE_TYPES; i++)
+    {
+        ResourceUsage *usage = &resources.usage[i];
+        TRACELOG(LOG_INFO, "    > %s: %i (peak: %i) | CPU: %lli bytes | GPU: %lli bytes", resourceTypeNames[i], usage->count, usage->peakCount, usage->cpuBytes, usage->gpuBytes);
+    }
+
+    for (int i = 0; i < resources.capacity; i++)
+    {
+        if (resources.entries[i].id != 0) TraceLogResourceEntry(LOG_DEBUG, &resources.entries[i]);
+    }
+
+    rMutexUnlock(&resourcesMutex);
+#else
+    TRACELOG(LOG_WARNING, "RESOURCES: Resources tracking not enabled, define SUPPORT_RESOURCE_TRACKING");
+#endif
+}
+
+#if defined(SUPPORT_RESOURCE_TRACKING)
+// Register a resource, already registered resources get their memory usage updated
+// NOTE: Internal function, called by modules chokepoints (rlgl objects, audio buffers), safe from any thread
+void TrackResource(int type, unsigned long long id, long long cpuBytes, long long gpuBytes)
+{
+    if ((type < 0) || (type >= MAX_RESOURCE_TYPES) || (id == 0)) return;
+
+    rMutexLock(&resourcesMutex);
+
+    // Grow hash table when half full, re-inserting live entries
+    if ((resources.count + 1)*2 > resources.capacity)
+    {
+        ResourceEntry *entries = resources.entries;
+        int capacity = resources.capacity;
+
+        resources.capacity = (capacity > 0)? capacity*2 : 256;
+        resources.entries = (ResourceEntry *)RL_CALLOC(resources.capacity, sizeof(ResourceEntry));
+
+        for (int i = 0; i < capacity; i++)
+        {
+            if (entries[i].id != 0) resources.entries[FindResourceEntry(entries[i].type, entries[i].id)] = entries[i];
+        }
+
+        RL_FREE(entries);
+    }
+
+    ResourceEntry *entry = &resources.entries[FindResourceEntry(type, id)];
+    ResourceUsage *usage = &resources.usage[type];
+
+    if (entry->id == 0)
+    {
+        *entry = (ResourceEntry){ id, type, 0, 0 };
+        resources.count++;
+        usage->count++;
+        if (usage->count > usage->peakCount) usage->peakCount = usage->count;
+    }
+
+    usage->cpuBytes += (cpuBytes - entry->cpuBytes);
+    usage->gpuBytes += (gpuBytes - entry->gpuBytes);
+    entry->cpuBytes = cpuBytes;
+    entry->gpuBytes = gpuBytes;
+
+    rMutexUnlock(&resourcesMutex);
+}
+
+// Unregister a resource, not registered resources are ignored
+// NOTE: Internal function, called by modules chokepoints (rlgl objects, audio buffers), safe from any thread
+void UntrackResource(int type, unsigned long long id)
+{
+    if ((type < 0) || (type >= MAX_RESOURCE_TYPES) || (id == 0)) return;
+
+    rMutexLock(&resourcesMutex);
+
+    if (resources.capacity > 0)
+    {
+        int index = FindResourceEntry(type, id);
+        ResourceEntry *entry = &resources.entries[index];
+
+        if (entry->id != 0)
+        {
+            ResourceUsage *usage = &resources.usage[type];
+            usage->count--;
+            usage->cpuBytes -= entry->cpuBytes;
+            usage->gpuBytes -= entry->gpuBytes;
+            resources.count--;
+
+            // Shift back following entries of the probe sequence to fill the gap
+            int mask = resources.capacity - 1;
+            int hole = index;
+
+            for (int i = (index + 1) & mask; resources.entries[i].id != 0; i = (i + 1) & mask)
+            {
+                int home = (int)(GetResourceHash(resources.entries[i].type, resources.entries[i].id) & mask);
+
+                // Entry can be moved if the hole is between its home position and its current position
+                if (((i - home) & mask) >= ((i - hole) & mask))
+                {
+                    resources.entries[hole] = resources.entries[i];
+                    hole = i;
+                }
+            }
+
+            resources.entries[hole] = (ResourceEntry){ 0 };
+        }
+    }
+
+    rMutexUnlock(&resourcesMutex);
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: File system
+//----------------------------------------------------------------------------------
+
+// Check if the file exists
+bool FileExists(const char *fileName)
+{
+    bool result = false;
+
+#if defined(_WIN32)
+    if (_access(fileName, 0) != -1) result = true;
+#else
+    if (access(fileName, F_OK) != -1) result = true;
+#endif
+
+    // NOTE: Alternatively, stat() can be used instead of access()
+    //#include <sys/stat.h>
+    //struct stat statbuf;
+    //if (stat(filename, &statbuf) == 0) result = true;
+
+    return result;
+}
+
+// Check file extension
+// NOTE: Extensions checking is not case-sensitive, multiple extensions can be provided separated by ';'
+// Comparison is done in-place, no memory is allocated and no static buffers are used
+bool IsFileExtension(const char *fileName, const char *ext)
+{
+    bool result = false;
+    const char *fileExt = GetFileExtension(fileName);
+
+    if (fileExt != NULL)
+    {
+        int fileExtLength = (int)strlen(fileExt);
+        const char *checkExt = ext;
+
+        while (!result && (checkExt != NULL))
+        {
+            const char *checkExtEnd = strchr(checkExt, ';');
+            int checkExtLength = (checkExtEnd != NULL)? (int)(checkExtEnd - checkExt) : (int)strlen(checkExt);
+
+            if (checkExtLength == fileExtLength)
+            {
+                result = true;
+
+                for (int i = 0; i < fileExtLength; i++)
+                {
+                    char a = fileExt[i];
+                    char b = checkExt[i];
+
+                    if ((a >= 'A') && (a <= 'Z')) a += 32;
+                    if ((b >= 'A') && (b <= 'Z')) b += 32;
+
+                    if (a != b)
+                    {
+                        result = false;
+                        break;
+                    }
+                }
+            }
+
+            checkExt = (checkExtEnd != NULL)? (checkExtEnd + 1) : NULL;
+        }
+    }
+
+    return result;
+}
+
+// Check if a directory path exists
+bool DirectoryExists(const char *dirPath)
+{
+    bool result = false;
+    DIR *dir = opendir(dirPath);
+
+    if (dir != NULL)
+    {
+        result = true;
+        closedir(dir);
+    }
+
+    return result;
+}
+
+// Get file length in bytes
+// NOTE: GetFileSize() conflicts with windows.h
+int GetFileLength(const char *fileName)
+{
+    int size = 0;
+
+    // NOTE: On Unix-like systems, it can by used the POSIX system call: stat(),
+    // but depending on the platform that call could not be available
+    //struct stat result = { 0 };
+    //stat(fileName, &result);
+    //return result.st_size;
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0L, SEEK_END);
+        long int fileSize = ftell(file);
+
+        // Check for size overflow (INT_MAX)
+        if (fileSize > 2147483647) TRACELOG(LOG_WARNING, "[%s] File size overflows expected limit, do not use GetFileLength()", fileName);
+        else size = (int)fileSize;
+
+        fclose(file);
+    }
+
+    return size;
+}
+
+// Get pointer to extension for a filename string (includes the dot: .png)
+const char *GetFileExtension(const char *fileName)
+{
+    const char *dot = strrchr(fileName, '.');
+
+    if (!dot || dot == fileName) return NULL;
+
+    return dot;
+}
+
+// String pointer reverse break: returns right-most occurrence of charset in s
+static const char *strprbrk(const char *s, const char *charset)
+{
+    const char *latestMatch = NULL;
+
+    for (; s = strpbrk(s, charset), s != NULL; latestMatch = s++) { }
+
+    return latestMatch;
+}
+
+// Get pointer to filename for a path string
+const char *GetFileName(const char *filePath)
+{
+    const char *fileName = NULL;
+
+    if (filePath != NULL) fileName = strprbrk(filePath, "\\/");
+
+    if (fileName == NULL) return filePath;
+
+    return fileName + 1;
+}
+
+// Get filename string without extension (uses static string)
+const char *GetFileNameWithoutExt(const char *filePath)
+{
+    #define MAX_FILENAME_LENGTH     256
+
+    static RL_THREAD_LOCAL char fileName[MAX_FILENAME_LENGTH] = { 0 };
+    memset(fileName, 0, MAX_FILENAME_LENGTH);
+
+    if (filePath != NULL)
+    {
+        strcpy(fileName, GetFileName(filePath)); // Get filename.ext without path
+        int size = (int)strlen(fileName); // Get size in bytes
+
+        for (int i = size; i > 0; i--) // Reverse search '.'
+        {
+            if (fileName[i] == '.')
+            {
+                // NOTE: We break on first '.' found
+                fileName[i] = '\0';
+                break;
+            }
+        }
+    }
+
+    return fileName;
+}
+
+// Get directory for a given filePath
+const char *GetDirectoryPath(const char *filePath)
+{
+    /*
+    // NOTE: Directory separator is different in Windows and other platforms,
+    // fortunately, Windows also support the '/' separator, that's the one should be used
+    #if defined(_WIN32)
+        char separator = '\\';
+    #else
+        char separator = '/';
+    #endif
+    */
+    const char *lastSlash = NULL;
+    static RL_THREAD_LOCAL char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
+    memset(dirPath, 0, MAX_FILEPATH_LENGTH);
+
+    // In case provided path does not contain a root drive letter (C:\, D:\) nor leading path separator (\, /),
+    // we add the current directory path to dirPath
+    if (filePath[1] != ':' && filePath[0] != '\\' && filePath[0] != '/')
+    {
+        // For security, we set starting path to current directory,
+        // obtained path will be concatenated to this
+        dirPath[0] = '.';
+        dirPath[1] = '/';
+    }
+
+    lastSlash = strprbrk(filePath, "\\/");
+    if (lastSlash)
+    {
+        if (lastSlash == filePath)
+        {
+            // The last and only slash is the leading one: path is in a root directory
+            dirPath[0] = filePath[0];
+            dirPath[1] = '\0';
+        }
+        else
+        {
+            // NOTE: Be careful, strncpy() is not safe, it does not care about '\0'
+            char *dirPathPtr = dirPath;
+            if ((filePath[1] != ':') && (filePath[0] != '\\') && (filePath[0] != '/')) dirPathPtr += 2;     // Skip drive letter, "C:"
+            memcpy(dirPathPtr, filePath, strlen(filePath) - (strlen(lastSlash) - 1));
+            dirPath[strlen(filePath) - strlen(lastSlash) + (((filePath[1] != ':') && (filePath[0] != '\\') && (filePath[0] != '/'))? 2 : 0)] = '\0';  // Add '\0' manually
+        }
+    }
+
+    return dirPath;
+}
+
+// Get previous directory path for a given path
+const char *GetPrevDirectoryPath(const char *dirPath)
+{
+    static RL_THREAD_LOCAL char prevDirPath[MAX_FILEPATH_LENGTH] = { 0 };
+    memset(prevDirPath, 0, MAX_FILEPATH_LENGTH);
+    int pathLen = (int)strlen(dirPath);
+
+    if (pathLen <= 3) strcpy(prevDirPath, dirPath);
+
+    for (int i = (pathLen - 1); (i >= 0) && (pathLen > 3); i--)
+    {
+        if ((dirPath[i] == '\\') || (dirPath[i] == '/'))
+        {
+            // Check for root: "C:\" or "/"
+            if (((i == 2) && (dirPath[1] ==':')) || (i == 0)) i++;
+
+            strncpy(prevDirPath, dirPath, i);
+            break;
+        }
+    }
+
+    return prevDirPath;
+}
+
+// Get current working directory
+const char *GetWorkingDirectory(void)
 {
     static char currentDir[MAX_FILEPATH_LENGTH] = { 0 };
     memset(currentDir, 0, MAX_FILEPATH_LENGTH);
@@ -2205,57 +3024,105 @@ const char *GetApplicationDirectory(void)
 
 // Load directory filepaths
 // NOTE: Base path is prepended to the scanned filepaths
-// WARNING: Directory is scanned twice, first time to get files count
 // No recursive scanning is done!
 FilePathList LoadDirectoryFiles(const char *dirPath)
 {
     FilePathList files = { 0 };
-    unsigned int fileCounter = 0;
 
-    struct dirent *entity;
-    DIR *dir = opendir(dirPath);
+    // NOTE: Directory paths are also registered
+    rDirectoryScan *scan = OpenDirectoryScan(dirPath, NULL, false);
 
-    if (dir != NULL) // It's a directory
+    if (scan != NULL)
     {
-        // SCAN 1: Count files
-        while ((entity = readdir(dir)) != NULL)
-        {
-            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
-            if ((strcmp(entity->d_name, ".") != 0) && (strcmp(entity->d_name, "..") != 0)) fileCounter++;
-        }
-
-        // Memory allocation for dirFileCount
-        files.capacity = fileCounter;
-        files.paths = (char **)RL_MALLOC(files.capacity*sizeof(char *));
-        for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_MALLOC(MAX_FILEPATH_LENGTH*sizeof(char));
-
-        closedir(dir);
-
-        // SCAN 2: Read filepaths
-        // NOTE: Directory paths are also registered
-        ScanDirectoryFiles(dirPath, &files, NULL);
-
-        // Security check: read files.count should match fileCounter
-        if (files.count != files.capacity) TRACELOG(LOG_WARNING, "FILEIO: Read files count do not match capacity allocated");
+        ScanDirectoryFiles(scan, &files);
+        CloseDirectoryScan(scan);
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
 
     return files;
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-// NOTE: On recursive loading we do not pre-scan for file count, we use MAX_FILEPATH_CAPACITY
+// NOTE: Filepaths list starts with MAX_FILEPATH_CAPACITY entries and grows on demand
 FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs)
 {
     FilePathList files = { 0 };
 
-    files.capacity = MAX_FILEPATH_CAPACITY;
-    files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-    for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (scanSubdirs && jobSystem.ready)
+    {
+        // Base directory entries are scanned first, every subdirectory subtree is scanned
+        // in a separate job and results are merged in entries order, same as a serial scan
+        rDirectoryScan *scan = OpenDirectoryScan(basePath, NULL, false);
+
+        if (scan != NULL)
+        {
+            DirectoryScanEntry *entries = NULL;
+            int entryCount = 0;
+            int entryCapacity = 0;
+            const char *path = NULL;
+            JobCounter counter = { 0 };
+
+            while ((path = GetNextDirectoryFile(scan)) != NULL)
+            {
+                if (entryCount >= entryCapacity)
+                {
+                    entryCapacity = (entryCapacity > 0)? entryCapacity*2 : 64;
+                    entries = (DirectoryScanEntry *)RL_REALLOC(entries, entryCapacity*sizeof(DirectoryScanEntry));
+                }
+
+                DirectoryScanEntry *entry = &entries[entryCount];
+                int pathSize = (int)strlen(path) + 1;
+
+                entry->path = (char *)RL_MALLOC(pathSize);
+                memcpy(entry->path, path, pathSize);
+                entry->isDirectory = scan->isDirectory;
+                entry->filter = filter;
+                entry->files = (FilePathList){ 0 };
+                entryCount++;
+            }
+
+            CloseDirectoryScan(scan);
+
+            // NOTE: Entries array is not reallocated anymore, jobs can keep pointers to it
+            for (int i = 0; i < entryCount; i++)
+            {
+                if (entries[i].isDirectory) SubmitJob(ScanDirectoryEntryJob, &entries[i], &counter);
+            }
+
+            WaitJobCounter(&counter);
+
+            bool includeDirs = (filter != NULL) && (strstr(filter, DIRECTORY_FILTER_TAG) != NULL);
+
+            for (int i = 0; i < entryCount; i++)
+            {
+                bool include = false;
+
+                if (entries[i].isDirectory) include = includeDirs;
+                else include = ((filter == NULL) || IsFileExtension(entries[i].path, filter));
+
+                if (include) AddFilePath(&files, entries[i].path);
+                else RL_FREE(entries[i].path);
+
+                // Move subtree filepaths to result list
+                for (unsigned int j = 0; j < entries[i].files.count; j++) AddFilePath(&files, entries[i].files.paths[j]);
+                RL_FREE(entries[i].files.paths);
+            }
+
+            RL_FREE(entries);
+        }
+
+        return files;
+    }
+#endif
 
     // WARNING: basePath is always prepended to scanned paths
-    if (scanSubdirs) ScanDirectoryFilesRecursively(basePath, &files, filter);
-    else ScanDirectoryFiles(basePath, &files, filter);
+    rDirectoryScan *scan = OpenDirectoryScan(basePath, filter, scanSubdirs);
+
+    if (scan != NULL)
+    {
+        ScanDirectoryFiles(scan, &files);
+        CloseDirectoryScan(scan);
+    }
 
     return files;
 }
@@ -2269,6 +3136,146 @@ void UnloadDirectoryFiles(FilePathList files)
     RL_FREE(files.paths);
 }
 
+// Open directory scan iterator, filepaths are streamed one at a time with no capacity limit
+// NOTE: Use 'DIR' in the filter string to include directories in the results
+rDirectoryScan *OpenDirectoryScan(const char *basePath, const char *filter, bool scanSubdirs)
+{
+    rDirectoryScan *scan = NULL;
+    DIR *dir = opendir(basePath);
+
+    if (dir != NULL)
+    {
+        scan = (rDirectoryScan *)RL_CALLOC(1, sizeof(rDirectoryScan));
+
+        int pathLength = (int)strlen(basePath);
+        if (pathLength > (MAX_FILEPATH_LENGTH - 1)) pathLength = MAX_FILEPATH_LENGTH - 1;
+        memcpy(scan->path, basePath, pathLength);
+
+        if (filter != NULL)
+        {
+            int filterLength = (int)strlen(filter);
+            scan->filter = (char *)RL_CALLOC(filterLength + 1, 1);
+            memcpy(scan->filter, filter, filterLength);
+            scan->includeDirs = (strstr(filter, DIRECTORY_FILTER_TAG) != NULL);
+        }
+
+        // NOTE: Directories are only included by default on non-recursive unfiltered scans
+        if (!scanSubdirs && (filter == NULL)) scan->includeDirs = true;
+        scan->recursive = scanSubdirs;
+
+        scan->levelCapacity = 16;
+        scan->levels = (DirectoryScanLevel *)RL_MALLOC(scan->levelCapacity*sizeof(DirectoryScanLevel));
+        scan->levels[0].dir = dir;
+        scan->levels[0].pathLength = pathLength;
+        scan->levelCount = 1;
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    return scan;
+}
+
+// Get next filepath from directory scan, returns NULL when scan is finished
+// NOTE: Returned string is only valid until next call, entries type is retrieved
+// from directory entry (d_type) when available, avoiding a stat() call per entry
+const char *GetNextDirectoryFile(rDirectoryScan *scan)
+{
+    const char *result = NULL;
+
+    if (scan == NULL) return result;
+
+    while ((result == NULL) && (scan->levelCount > 0))
+    {
+        DirectoryScanLevel *level = &scan->levels[scan->levelCount - 1];
+        struct dirent *dp = readdir(level->dir);
+
+        if (dp == NULL)
+        {
+            // Current directory finished, move back to parent
+            closedir(level->dir);
+            scan->levelCount--;
+            continue;
+        }
+
+        const char *name = dp->d_name;
+
+        // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
+        if ((name[0] == '.') && ((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0')))) continue;
+
+        int nameLength = (int)strlen(name);
+        int pathLength = level->pathLength + 1 + nameLength;
+
+        if (pathLength > (MAX_FILEPATH_LENGTH - 1))
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: Filepath too long, skipped (%s)", name);
+            continue;
+        }
+
+        // Construct new path from level path, no need to reformat the full path
+    #if defined(_WIN32)
+        scan->path[level->pathLength] = '\\';
+    #else
+        scan->path[level->pathLength] = '/';
+    #endif
+        memcpy(scan->path + level->pathLength + 1, name, nameLength + 1);
+
+        bool isDirectory = false;
+        bool checkStat = true;
+
+    #if defined(DT_DIR) && defined(DT_REG)
+        if (dp->d_type == DT_DIR) { isDirectory = true; checkStat = false; }
+        else if (dp->d_type == DT_REG) { isDirectory = false; checkStat = false; }
+    #endif
+        if (checkStat)
+        {
+            // NOTE: Filesystem does not provide entry type (or it's a symlink), stat() required
+            struct stat info = { 0 };
+            if (stat(scan->path, &info) == 0) isDirectory = S_ISDIR(info.st_mode);
+        }
+
+        scan->isDirectory = isDirectory;
+
+        if (isDirectory)
+        {
+            if (scan->includeDirs) result = scan->path;
+
+            if (scan->recursive)
+            {
+                DIR *dir = opendir(scan->path);
+
+                if (dir != NULL)
+                {
+                    if (scan->levelCount >= scan->levelCapacity)
+                    {
+                        scan->levelCapacity *= 2;
+                        scan->levels = (DirectoryScanLevel *)RL_REALLOC(scan->levels, scan->levelCapacity*sizeof(DirectoryScanLevel));
+                    }
+
+                    scan->levels[scan->levelCount].dir = dir;
+                    scan->levels[scan->levelCount].pathLength = pathLength;
+                    scan->levelCount++;
+                }
+                else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", scan->path);
+            }
+        }
+        else if ((scan->filter == NULL) || IsFileExtension(scan->path, scan->filter)) result = scan->path;
+    }
+
+    return result;
+}
+
+// Close directory scan iterator
+void CloseDirectoryScan(rDirectoryScan *scan)
+{
+    if (scan != NULL)
+    {
+        for (int i = 0; i < scan->levelCount; i++) closedir(scan->levels[i].dir);
+
+        RL_FREE(scan->levels);
+        RL_FREE(scan->filter);
+        RL_FREE(scan);
+    }
+}
+
 // Create directories (including full path requested), returns 0 on success
 int MakeDirectory(const char *dirPath)
 {
@@ -2404,33 +3411,211 @@ FilePathList LoadDroppedFiles(void)
 // Unload dropped filepaths
 void UnloadDroppedFiles(FilePathList files)
 {
-    // WARNING: files pointers are the same as internal ones
+    // WARNING: files pointers are the same as internal ones
+
+    if (files.count > 0)
+    {
+        for (unsigned int i = 0; i < files.count; i++) RL_FREE(files.paths[i]);
+
+        RL_FREE(files.paths);
+
+        CORE.Window.dropFileCount = 0;
+        CORE.Window.dropFilepaths = NULL;
+    }
+}
+
+// Get file modification time (last write time)
+long GetFileModTime(const char *fileName)
+{
+    struct stat result = { 0 };
+    long modTime = 0;
+
+    if (stat(fileName, &result) == 0)
+    {
+        time_t mod = result.st_mtime;
+
+        modTime = (long)mod;
+    }
+
+    return modTime;
+}
+
+// Watch a file for changes
+// NOTE: Changes are retrieved with PollFileChanges()
+bool WatchFile(const char *fileName)
+{
+    bool result = false;
+
+    if (IsPathFile(fileName)) result = AddFileWatch(fileName, false, false);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] File can not be watched, not found", fileName);
+
+    return result;
+}
+
+// Watch a directory for changes on its files (no recursive watching)
+// NOTE: Changed files paths are reported, on polling mode directory path is also reported on files addition/removal
+bool WatchDirectory(const char *dirPath)
+{
+    bool result = false;
+
+    if (DirectoryExists(dirPath))
+    {
+        result = AddFileWatch(dirPath, true, false);
+
+        // On polling mode, directory files are watched independently,
+        // directory modification time only changes on files addition/removal
+        if (result && (fileWatches[fileWatchCount - 1].wd < 0))
+        {
+            rDirectoryScan *scan = OpenDirectoryScan(dirPath, NULL, false);
+            const char *path = NULL;
+
+            while ((path = GetNextDirectoryFile(scan)) != NULL)
+            {
+                if (IsPathFile(path)) AddFileWatch(path, false, true);
+            }
+
+            CloseDirectoryScan(scan);
+        }
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Directory can not be watched, not found", dirPath);
+
+    return result;
+}
+
+// Stop watching a file or directory
+void UnwatchFile(const char *path)
+{
+    int pathLength = (int)strlen(path);
+
+    for (int i = fileWatchCount - 1; i >= 0; i--)
+    {
+        FileWatch *watch = &fileWatches[i];
+
+        // Remove requested watch and implicit watches added for directory files
+        bool remove = (strcmp(watch->path, path) == 0);
+        if (!remove && watch->implicit && (strncmp(watch->path, path, pathLength) == 0) &&
+            ((watch->path[pathLength] == '/') || (watch->path[pathLength] == '\\')) &&
+            (strprbrk(watch->path + pathLength + 1, "\\/") == NULL)) remove = true;
+
+        if (remove)
+        {
+            int wd = watch->wd;
+
+            RL_FREE(watch->path);
+            memmove(&fileWatches[i], &fileWatches[i + 1], (fileWatchCount - i - 1)*sizeof(FileWatch));
+            fileWatchCount--;
+
+        #if defined(__linux__)
+            // Parent directory watch descriptor can be shared by multiple watched files
+            if (wd >= 0)
+            {
+                bool shared = false;
+                for (int j = 0; j < fileWatchCount; j++) if (fileWatches[j].wd == wd) { shared = true; break; }
+
+                if (!shared) inotify_rm_watch(fileWatcherFd, wd);
+            }
+        #endif
+        }
+    }
+
+    fileWatchPollIndex = 0;
+}
+
+// Stop watching all files and directories
+void UnwatchFiles(void)
+{
+    for (int i = 0; i < fileWatchCount; i++) RL_FREE(fileWatches[i].path);
+    RL_FREE(fileWatches);
+
+    fileWatches = NULL;
+    fileWatchCount = 0;
+    fileWatchCapacity = 0;
+    fileWatchPollIndex = 0;
+
+#if defined(__linux__)
+    if (fileWatcherFd >= 0) close(fileWatcherFd);
+#endif
+    fileWatcherFd = -1;
+    fileWatcherReady = false;
+
+    for (unsigned int i = 0; i < fileChanges.count; i++) RL_FREE(fileChanges.paths[i]);
+    RL_FREE(fileChanges.paths);
+    fileChanges = (FilePathList){ 0 };
+}
+
+// Poll watched files changes since last call, returns a batch of changed filepaths
+// NOTE: Duplicate events are coalesced, returned list is managed internally, valid until next call (do not unload)
+FilePathList PollFileChanges(void)
+{
+    for (unsigned int i = 0; i < fileChanges.count; i++) RL_FREE(fileChanges.paths[i]);
+    fileChanges.count = 0;
 
-    if (files.count > 0)
+#if defined(__linux__)
+    if (fileWatcherFd >= 0)
     {
-        for (unsigned int i = 0; i < files.count; i++) RL_FREE(files.paths[i]);
+        // NOTE: Union used to get a buffer properly aligned for inotify events
+        union { struct inotify_event event; char data[4096]; } buffer;
+        char path[MAX_FILEPATH_LENGTH] = { 0 };
+        ssize_t length = 0;
 
-        RL_FREE(files.paths);
+        while ((length = read(fileWatcherFd, buffer.data, sizeof(buffer.data))) > 0)
+        {
+            const struct inotify_event *event = NULL;
 
-        CORE.Window.dropFileCount = 0;
-        CORE.Window.dropFilepaths = NULL;
+            for (char *ptr = buffer.data; ptr < (buffer.data + length); ptr += (sizeof(struct inotify_event) + event->len))
+            {
+                event = (const struct inotify_event *)ptr;
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    // Events lost, report all watched paths as changed
+                    TRACELOG(LOG_WARNING, "FILEIO: File watcher events queue overflow");
+                    for (int i = 0; i < fileWatchCount; i++) AddFileChange(fileWatches[i].path);
+                    continue;
+                }
+
+                if (event->len == 0) continue;  // Event on watched directory itself
+
+                for (int i = 0; i < fileWatchCount; i++)
+                {
+                    if (fileWatches[i].wd != event->wd) continue;
+
+                    if (fileWatches[i].isDirectory)
+                    {
+                        snprintf(path, MAX_FILEPATH_LENGTH, "%s/%s", fileWatches[i].path, event->name);
+                        AddFileChange(path);
+                    }
+                    else if (strcmp(GetFileName(fileWatches[i].path), event->name) == 0) AddFileChange(fileWatches[i].path);
+                }
+            }
+        }
     }
-}
+#endif
 
-// Get file modification time (last write time)
-long GetFileModTime(const char *fileName)
-{
-    struct stat result = { 0 };
-    long modTime = 0;
+    // Poll modification time for watches not covered by inotify,
+    // a maximum number of watches is checked per call to avoid stat() storms
+    int pollCount = (fileWatchCount < MAX_FILE_WATCH_POLL_COUNT)? fileWatchCount : MAX_FILE_WATCH_POLL_COUNT;
 
-    if (stat(fileName, &result) == 0)
+    for (int i = 0; i < pollCount; i++)
     {
-        time_t mod = result.st_mtime;
+        if (fileWatchPollIndex >= fileWatchCount) fileWatchPollIndex = 0;
+        FileWatch *watch = &fileWatches[fileWatchPollIndex];
+        fileWatchPollIndex++;
 
-        modTime = (long)mod;
+        if (watch->wd >= 0) continue;
+
+        struct stat info = { 0 };
+        stat(watch->path, &info);
+
+        if (((long)info.st_mtime != watch->modTime) || ((long)info.st_size != watch->size))
+        {
+            watch->modTime = (long)info.st_mtime;
+            watch->size = (long)info.st_size;
+            AddFileChange(watch->path);
+        }
     }
 
-    return modTime;
+    return fileChanges;
 }
 
 //----------------------------------------------------------------------------------
@@ -3221,6 +4406,58 @@ int GetTouchPointCount(void)
     return CORE.Input.Touch.pointCount;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input Handling: Events
+//----------------------------------------------------------------------------------
+
+// Enable timestamped input events queueing, events are received by GetInputEvents()
+// NOTE: Events queued before a previous DisableInputEvents() are discarded
+void EnableInputEvents(void)
+{
+    if (RL_ATOMIC_LOAD(&inputEvents.enabled)) return;
+
+    if (!inputEvents.ready)
+    {
+        // Free slots sequence matches their write position
+        for (unsigned int i = 0; i < MAX_INPUT_EVENTS; i++) inputEvents.slots[i].sequence = i;
+        inputEvents.ready = true;
+    }
+    else
+    {
+        InputEvent event = { 0 };
+        while (PopInputEvent(&event));
+    }
+
+    RL_ATOMIC_ADD(&inputEvents.dropped, -RL_ATOMIC_LOAD(&inputEvents.dropped));
+    RL_ATOMIC_CAS(&inputEvents.enabled, 0, 1);
+}
+
+// Disable timestamped input events queueing
+void DisableInputEvents(void)
+{
+    RL_ATOMIC_CAS(&inputEvents.enabled, 1, 0);
+}
+
+// Get queued input events (oldest first), returns number of events copied
+// NOTE: Call it until it returns 0 to drain the queue, events keep being queued while enabled
+int GetInputEvents(InputEvent *events, int maxCount)
+{
+    int count = 0;
+
+    if (!inputEvents.ready || (events == NULL)) return 0;
+
+    while ((count < maxCount) && PopInputEvent(&events[count])) count++;
+
+    int dropped = RL_ATOMIC_LOAD(&inputEvents.dropped);
+    if (dropped > 0)
+    {
+        TRACELOG(LOG_WARNING, "INPUT: %i input events dropped, events queue full (Max input events: %i)", dropped, MAX_INPUT_EVENTS);
+        RL_ATOMIC_ADD(&inputEvents.dropped, -dropped);
+    }
+
+    return count;
+}
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
@@ -3358,130 +4595,421 @@ void SetupFramebuffer(int width, int height)
     }
 }
 
-// Scan all files and directories in a base path
-// WARNING: files.paths[] must be previously allocated and
-// contain enough space to store all required paths
-static void ScanDirectoryFiles(const char *basePath, FilePathList *files, const char *filter)
+// Scan all directory files into a filepaths list
+// NOTE: Filepaths list grows as required, only the needed memory is allocated per filepath
+static void ScanDirectoryFiles(rDirectoryScan *scan, FilePathList *files)
 {
-    static char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
+    const char *path = NULL;
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    while ((path = GetNextDirectoryFile(scan)) != NULL)
+    {
+        int pathSize = (int)strlen(path) + 1;
+        char *filePath = (char *)RL_MALLOC(pathSize);
+        memcpy(filePath, path, pathSize);
 
-    if (dir != NULL)
+        AddFilePath(files, filePath);
+    }
+}
+
+// Add filepath to list (takes ownership), growing it as required
+static void AddFilePath(FilePathList *files, char *path)
+{
+    if (files->count >= files->capacity)
+    {
+        unsigned int capacity = (files->capacity > 0)? files->capacity*2 : MAX_FILEPATH_CAPACITY;
+
+        files->paths = (char **)RL_REALLOC(files->paths, capacity*sizeof(char *));
+        memset(files->paths + files->capacity, 0, (capacity - files->capacity)*sizeof(char *));
+        files->capacity = capacity;
+    }
+
+    files->paths[files->count] = path;
+    files->count++;
+}
+
+// Add file watch entry, initializing file watcher if required
+static bool AddFileWatch(const char *path, bool isDirectory, bool implicit)
+{
+    for (int i = 0; i < fileWatchCount; i++)
     {
-        while ((dp = readdir(dir)) != NULL)
+        // Path already watched, explicit watch request overrides implicit one
+        if (strcmp(fileWatches[i].path, path) == 0)
         {
-            if ((strcmp(dp->d_name, ".") != 0) &&
-                (strcmp(dp->d_name, "..") != 0))
-            {
-            #if defined(_WIN32)
-                sprintf(path, "%s\\%s", basePath, dp->d_name);
-            #else
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-            #endif
+            if (!implicit) fileWatches[i].implicit = false;
+            return true;
+        }
+    }
 
-                if (filter != NULL)
-                {
-                    if (IsPathFile(path))
-                    {
-                        if (IsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        if (TextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0)
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                }
-                else
-                {
-                    strcpy(files->paths[files->count], path);
-                    files->count++;
-                }
-            }
+    if (!fileWatcherReady)
+    {
+    #if defined(__linux__)
+        fileWatcherFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fileWatcherFd < 0) TRACELOG(LOG_WARNING, "FILEIO: File watcher could not be initialized, polling files modification time");
+    #endif
+        fileWatcherReady = true;
+    }
+
+    if (fileWatchCount >= fileWatchCapacity)
+    {
+        fileWatchCapacity = (fileWatchCapacity > 0)? fileWatchCapacity*2 : 32;
+        fileWatches = (FileWatch *)RL_REALLOC(fileWatches, fileWatchCapacity*sizeof(FileWatch));
+    }
+
+    FileWatch *watch = &fileWatches[fileWatchCount];
+    int pathSize = (int)strlen(path) + 1;
+
+    watch->path = (char *)RL_MALLOC(pathSize);
+    memcpy(watch->path, path, pathSize);
+    watch->isDirectory = isDirectory;
+    watch->implicit = implicit;
+    watch->wd = -1;
+
+    struct stat info = { 0 };
+    stat(path, &info);
+    watch->modTime = (long)info.st_mtime;
+    watch->size = (long)info.st_size;
+
+#if defined(__linux__)
+    if (fileWatcherFd >= 0)
+    {
+        const unsigned int mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE;
+
+        watch->wd = inotify_add_watch(fileWatcherFd, isDirectory? path : GetDirectoryPath(path), mask);
+        if (watch->wd < 0) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to add file watch, polling modification time", path);
+    }
+#endif
+
+    fileWatchCount++;
+
+    if (!implicit) TRACELOG(LOG_INFO, "FILEIO: [%s] Watching for changes", path);
+
+    return true;
+}
+
+// Add changed filepath to current changes list, duplicates are coalesced
+static void AddFileChange(const char *path)
+{
+    for (unsigned int i = 0; i < fileChanges.count; i++)
+    {
+        if (strcmp(fileChanges.paths[i], path) == 0) return;
+    }
+
+    if (fileChanges.count >= fileChanges.capacity)
+    {
+        fileChanges.capacity = (fileChanges.capacity > 0)? fileChanges.capacity*2 : 32;
+        fileChanges.paths = (char **)RL_REALLOC(fileChanges.paths, fileChanges.capacity*sizeof(char *));
+    }
+
+    int pathSize = (int)strlen(path) + 1;
+    fileChanges.paths[fileChanges.count] = (char *)RL_MALLOC(pathSize);
+    memcpy(fileChanges.paths[fileChanges.count], path, pathSize);
+    fileChanges.count++;
+}
+
+// Async asset loading job
+// NOTE: Previous loading asset is restored, waiting jobs inside a load function can run other loading jobs
+static void LoadAsyncAssetJob(void *userData)
+{
+    AsyncAsset *asset = (AsyncAsset *)userData;
+    AsyncAsset *previous = asyncAssetLoading;
+
+    asyncAssetLoading = asset;
+    bool success = asset->load(asset->data);
+    asyncAssetLoading = previous;
+
+    RL_ATOMIC_CAS(&asset->state, ASSET_STATE_LOADING, success? ASSET_STATE_UPLOADING : ASSET_STATE_FAILED);
+}
+
+// Unload async assets not retrieved and free slots
+// NOTE: Job system must be closed (no asset loading), pending uploads are completed
+// so asset data is unloaded by its module as a retrieved asset would be
+static void CloseAsyncAssets(void)
+{
+    asyncUploadBudget = 0.0f;
+    UpdateAsyncAssets();
+    asyncUploadBudget = ASYNC_UPLOAD_BUDGET;
+
+    rMutexLock(&asyncAssetsMutex);
+
+    for (int i = 0; i < asyncAssetCapacity; i++)
+    {
+        AsyncAsset *asset = asyncAssets[i];
+        if (asset == NULL) continue;
+
+        // Release data of deferred uploads not done (asset failed to load)
+        for (int j = asset->uploadIndex; j < asset->uploadCount; j++)
+        {
+            if (asset->uploads[j].release != NULL) asset->uploads[j].release(asset->uploads[j].data);
         }
 
-        closedir(dir);
+        if (asset->unload != NULL) asset->unload(asset->data);
+
+        RL_FREE(asset->uploads);
+        RL_FREE(asset);
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    RL_FREE(asyncAssets);
+    asyncAssets = NULL;
+    asyncAssetCapacity = 0;
+
+    rMutexUnlock(&asyncAssetsMutex);
 }
 
-// Scan all files and directories recursively from a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *files, const char *filter)
+#if defined(SUPPORT_RESOURCE_TRACKING)
+// Get resource hash, for registry hash table
+// NOTE: 64-bit finalizer mix, GPU objects names are sequential and pointers are aligned
+static unsigned int GetResourceHash(int type, unsigned long long id)
 {
-    char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
+    unsigned long long hash = id ^ ((unsigned long long)type << 56);
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
 
-    if (dir != NULL)
+    return (unsigned int)hash;
+}
+
+// Find resource entry index, or first empty entry index if not registered
+// NOTE: Registry must be locked and not full
+static int FindResourceEntry(int type, unsigned long long id)
+{
+    int mask = resources.capacity - 1;
+    int index = (int)(GetResourceHash(type, id) & mask);
+
+    while ((resources.entries[index].id != 0) && ((resources.entries[index].id != id) || (resources.entries[index].type != type))) index = (index + 1) & mask;
+
+    return index;
+}
+
+// Log resource entry info
+static void TraceLogResourceEntry(int logLevel, ResourceEntry *entry)
+{
+    // NOTE: Audio buffers are identified by address, GPU objects by name
+    if (entry->type >= RESOURCE_SOUND) TRACELOG(logLevel, "    > %s [%p] | CPU: %lli bytes", resourceTypeNames[entry->type], (void *)(uintptr_t)entry->id, entry->cpuBytes);
+    else TRACELOG(logLevel, "    > %s [ID %u] | GPU: %lli bytes", resourceTypeNames[entry->type], (unsigned int)(entry->id & 0xffffffff), entry->gpuBytes);
+}
+
+// Report not unloaded resources and free registry
+static void CloseResourceRegistry(void)
+{
+    rMutexLock(&resourcesMutex);
+
+    if (resources.count > 0)
     {
-        while (((dp = readdir(dir)) != NULL) && (files->count < files->capacity))
+        TRACELOG(LOG_WARNING, "RESOURCES: %i resources not unloaded before closing window", resources.count);
+
+        for (int i = 0; i < MAX_RESOURCE_TYPES; i++)
         {
-            if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
-            {
-                // Construct new path from our base path
-            #if defined(_WIN32)
-                sprintf(path, "%s\\%s", basePath, dp->d_name);
-            #else
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-            #endif
+            ResourceUsage *usage = &resources.usage[i];
+            if (usage->count > 0) TRACELOG(LOG_WARNING, "RESOURCES: %s leaked: %i | CPU: %lli bytes | GPU: %lli bytes", resourceTypeNames[i], usage->count, usage->cpuBytes, usage->gpuBytes);
+        }
 
-                if (IsPathFile(path))
-                {
-                    if (filter != NULL)
-                    {
-                        if (IsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+        for (int i = 0; i < resources.capacity; i++)
+        {
+            if (resources.entries[i].id != 0) TraceLogResourceEntry(LOG_WARNING, &resources.entries[i]);
+        }
+    }
+    else TRACELOG(LOG_INFO, "RESOURCES: All resources unloaded successfully");
 
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
-                }
-                else 
-                {
-                    if ((filter != NULL) && (TextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0))
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
-                    
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
+    RL_FREE(resources.entries);
+    resources = (ResourceRegistry){ 0 };
 
-                    ScanDirectoryFilesRecursively(path, files, filter);
-                }
-            }
+    rMutexUnlock(&resourcesMutex);
+}
+#endif
+
+// Push timestamped input event to queue (if enabled), called by platform backends
+// NOTE: Lock-free, it can be called from any thread, time must be measured with the same clock as GetTime()
+static void PushInputEvent(int type, int device, int code, Vector2 value, double time)
+{
+    if (!RL_ATOMIC_LOAD(&inputEvents.enabled)) return;
+
+    unsigned int position = RL_ATOMIC_LOAD(&inputEvents.head);
+    InputEventSlot *slot = NULL;
+
+    // Claim slot at head position, free slots sequence matches their position
+    while (true)
+    {
+        slot = &inputEvents.slots[position & (MAX_INPUT_EVENTS - 1)];
+        int diff = (int)(RL_ATOMIC_LOAD(&slot->sequence) - position);
+
+        if (diff == 0)
+        {
+            if (RL_ATOMIC_CAS(&inputEvents.head, position, position + 1)) break;
+        }
+        else if (diff < 0)
+        {
+            // Event not read yet, ring is full
+            RL_ATOMIC_ADD(&inputEvents.dropped, 1);
+            return;
         }
 
-        closedir(dir);
+        position = RL_ATOMIC_LOAD(&inputEvents.head);
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    slot->event.time = time;
+    slot->event.type = type;
+    slot->event.device = device;
+    slot->event.code = code;
+    slot->event.value = value;
+
+    // Publish event
+    RL_ATOMIC_ADD(&slot->sequence, 1);
+}
+
+// Pop oldest queued input event, false if queue is empty
+// NOTE: Only one consumer, main thread
+static bool PopInputEvent(InputEvent *event)
+{
+    InputEventSlot *slot = &inputEvents.slots[inputEvents.tail & (MAX_INPUT_EVENTS - 1)];
+
+    if (RL_ATOMIC_LOAD(&slot->sequence) != (inputEvents.tail + 1)) return false;
+
+    *event = slot->event;
+
+    // Release slot for next ring lap
+    RL_ATOMIC_ADD(&slot->sequence, MAX_INPUT_EVENTS - 1);
+    inputEvents.tail++;
+
+    return true;
+}
+
+#if defined(SUPPORT_JOB_SYSTEM)
+// Job system worker thread loop
+static void JobWorkerThread(void *arg)
+{
+    jobWorkerIndex = (int)(intptr_t)arg;
+
+    while (true)
+    {
+        Job job = { 0 };
+
+        if (GetNextJob(&job)) RunJob(&job);
+        else
+        {
+            // No jobs available, sleep until a job is submitted or job system is closed
+            rMutexLock(&jobSystem.sleepMutex);
+            while ((RL_ATOMIC_LOAD(&jobSystem.pendingCount) == 0) && jobSystem.running) rConditionWait(&jobSystem.sleepCondition, &jobSystem.sleepMutex);
+            bool shouldExit = (!jobSystem.running && (RL_ATOMIC_LOAD(&jobSystem.pendingCount) == 0));
+            rMutexUnlock(&jobSystem.sleepMutex);
+
+            if (shouldExit) break;
+        }
+    }
+
+    CloseTempMemory();
+    jobWorkerIndex = -1;
+}
+
+// Push job at the back of a queue
+static void PushJob(JobQueue *queue, Job job)
+{
+    rMutexLock(&queue->mutex);
+
+    if (queue->count == queue->capacity)
+    {
+        // Grow ring buffer, unwrapping queued jobs
+        Job *jobs = (Job *)RL_MALLOC(queue->capacity*2*sizeof(Job));
+        for (int i = 0; i < queue->count; i++) jobs[i] = queue->jobs[(queue->head + i)%queue->capacity];
+
+        RL_FREE(queue->jobs);
+        queue->jobs = jobs;
+        queue->capacity *= 2;
+        queue->head = 0;
+    }
+
+    queue->jobs[(queue->head + queue->count)%queue->capacity] = job;
+    queue->count++;
+
+    rMutexUnlock(&queue->mutex);
+}
+
+// Pop job from the back (owner) or front (steal) of a queue
+static bool PopJob(JobQueue *queue, Job *job, bool back)
+{
+    bool result = false;
+
+    rMutexLock(&queue->mutex);
+
+    if (queue->count > 0)
+    {
+        if (back) *job = queue->jobs[(queue->head + queue->count - 1)%queue->capacity];
+        else
+        {
+            *job = queue->jobs[queue->head];
+            queue->head = (queue->head + 1)%queue->capacity;
+        }
+
+        queue->count--;
+        result = true;
+    }
+
+    rMutexUnlock(&queue->mutex);
+
+    return result;
+}
+
+// Get next job to run: own queue, shared queue, then steal from other workers
+static bool GetNextJob(Job *job)
+{
+    bool result = false;
+    int workerQueueCount = jobSystem.queueCount - 1;
+
+    if (RL_ATOMIC_LOAD(&jobSystem.pendingCount) == 0) return result;
+
+    if (jobWorkerIndex >= 0) result = PopJob(&jobSystem.queues[jobWorkerIndex], job, true);
+
+    // NOTE: Shared queue is the last one, stealing starts from next worker to spread contention
+    for (int i = 0; !result && (i < jobSystem.queueCount); i++)
+    {
+        int index = (i == 0)? workerQueueCount : (jobWorkerIndex + i)%workerQueueCount;
+
+        if (index != jobWorkerIndex) result = PopJob(&jobSystem.queues[index], job, false);
+    }
+
+    if (result) RL_ATOMIC_ADD(&jobSystem.pendingCount, -1);
+
+    return result;
 }
 
+// Run job and update its completion counter
+// NOTE: Every job runs in its own temporary memory scope (RL_TEMP_ALLOC())
+static void RunJob(Job *job)
+{
+    BeginTempMemory();
+    job->callback(job->userData);
+    EndTempMemory();
+
+    if (job->counter != NULL) RL_ATOMIC_ADD(&job->counter->pending, -1);
+}
+
+// Parallel-for range job
+static void ParallelForJob(void *userData)
+{
+    ParallelForRange *range = (ParallelForRange *)userData;
+
+    range->callback(range->start, range->end, range->userData);
+}
+
+// Directory subtree scan job
+static void ScanDirectoryEntryJob(void *userData)
+{
+    DirectoryScanEntry *entry = (DirectoryScanEntry *)userData;
+    rDirectoryScan *scan = OpenDirectoryScan(entry->path, entry->filter, true);
+
+    if (scan != NULL)
+    {
+        // NOTE: Subtree lists start small, a tree with many small directories would
+        // otherwise allocate MAX_FILEPATH_CAPACITY entries per subdirectory before merging
+        entry->files.capacity = DIRECTORY_SCAN_JOB_CAPACITY;
+        entry->files.paths = (char **)RL_CALLOC(entry->files.capacity, sizeof(char *));
+
+        ScanDirectoryFiles(scan, &entry->files);
+        CloseDirectoryScan(scan);
+    }
+}
+#endif // SUPPORT_JOB_SYSTEM
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 // Automation event recording
 // NOTE: Recording is by default done at EndDrawing(), before PollInputEvents()
@@ -3762,8 +5290,8 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
@@ -148,6 +148,16 @@
     #define RL_FREE(p)        free(p)
 #endif
 
+// Resources tracking hooks, called on GPU objects load/unload
+// NOTE: They do nothing by default, the module including the implementation can define them
+// to keep track of live GPU objects, object: TEXTURE, FRAMEBUFFER, DEPTH_TEXTURE, DEPTH_RENDERBUFFER, BUFFER, SHADER
+#ifndef RL_TRACK_RESOURCE
+    #define RL_TRACK_RESOURCE(object, id, size)     ((void)0)
+#endif
+#ifndef RL_UNTRACK_RESOURCE
+    #define RL_UNTRACK_RESOURCE(object, id)         ((void)0)
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -2335,6 +2345,7 @@ void rlglClose(void)
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    RL_UNTRACK_RESOURCE(TEXTURE, RLGL.State.defaultTextureId);
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
 }
@@ -3300,7 +3311,11 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // Unbind current texture
     glBindTexture(GL_TEXTURE_2D, 0);
 
-    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
+    if (id > 0)
+    {
+        RL_TRACK_RESOURCE(TEXTURE, id, mipOffset);
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
+    }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
 
     return id;
@@ -3344,6 +3359,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 
         glBindTexture(GL_TEXTURE_2D, 0);
 
+        RL_TRACK_RESOURCE(DEPTH_TEXTURE, id, width*height*4);    // Estimated 24/32 bits per depth sample
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
     else
@@ -3356,6 +3372,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 
         glBindRenderbuffer(GL_RENDERBUFFER, 0);
 
+        RL_TRACK_RESOURCE(DEPTH_RENDERBUFFER, id, width*height*((RLGL.ExtSupported.maxDepthBits >= 24)? 4 : 2));
         TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
     }
 #endif
@@ -3430,6 +3447,8 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 #endif
 
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+
+    if (id > 0) RL_TRACK_RESOURCE(TEXTURE, id, 6*dataSize);
 #endif
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
@@ -3531,6 +3550,10 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+
+    // NOTE: Depth textures share names with color textures, so any of them could be unloaded here
+    RL_UNTRACK_RESOURCE(TEXTURE, id);
+    RL_UNTRACK_RESOURCE(DEPTH_TEXTURE, id);
 }
 
 // Generate mipmap data for selected texture
@@ -3555,6 +3578,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
         #define MAX(a,b) (((a)>(b))? (a):(b))
 
         *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
+        RL_TRACK_RESOURCE(TEXTURE, id, rlGetPixelDataSize(width, height, format)*4/3);  // Estimated full mipmap chain size
         TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
@@ -3669,6 +3693,8 @@ unsigned int rlLoadFramebuffer(void)
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glGenFramebuffers(1, &fboId);       // Create the framebuffer object
     glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+
+    if (fboId > 0) RL_TRACK_RESOURCE(FRAMEBUFFER, fboId, 0);
 #endif
 
     return fboId;
@@ -3764,14 +3790,23 @@ void rlUnloadFramebuffer(unsigned int id)
     glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
 
     unsigned int depthIdU = (unsigned int)depthId;
-    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    if (depthType == GL_RENDERBUFFER)
+    {
+        glDeleteRenderbuffers(1, &depthIdU);
+        RL_UNTRACK_RESOURCE(DEPTH_RENDERBUFFER, depthIdU);
+    }
+    else if (depthType == GL_TEXTURE)
+    {
+        glDeleteTextures(1, &depthIdU);
+        RL_UNTRACK_RESOURCE(DEPTH_TEXTURE, depthIdU);
+    }
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer.
 
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glDeleteFramebuffers(1, &id);
+    RL_UNTRACK_RESOURCE(FRAMEBUFFER, id);
 
     TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
 #endif
@@ -3788,6 +3823,8 @@ unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
     glGenBuffers(1, &id);
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+
+    if (id > 0) RL_TRACK_RESOURCE(BUFFER, id, size);
 #endif
 
     return id;
@@ -3802,6 +3839,8 @@ unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynami
     glGenBuffers(1, &id);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+
+    if (id > 0) RL_TRACK_RESOURCE(BUFFER, id, size);
 #endif
 
     return id;
@@ -4009,6 +4048,7 @@ void rlUnloadVertexBuffer(unsigned int vboId)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteBuffers(1, &vboId);
+    RL_UNTRACK_RESOURCE(BUFFER, vboId);
     //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
 #endif
 }
@@ -4215,6 +4255,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
         //GLint binarySize = 0;
         //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
 
+        RL_TRACK_RESOURCE(SHADER, program, 0);
         TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
     }
 #endif
@@ -4226,6 +4267,7 @@ void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteProgram(id);
+    RL_UNTRACK_RESOURCE(SHADER, id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
 #endif
@@ -4405,6 +4447,7 @@ unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
         //GLint binarySize = 0;
         //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
 
+        RL_TRACK_RESOURCE(SHADER, program, 0);
         TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
     }
 #else
@@ -4433,6 +4476,8 @@ unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHi
     glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
     if (data == NULL) glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, NULL);    // Clear buffer data to 0
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    if (ssbo > 0) RL_TRACK_RESOURCE(BUFFER, ssbo, size);
 #else
     TRACELOG(RL_LOG_WARNING, "SSBO: SSBO not enabled. Define GRAPHICS_API_OPENGL_43");
 #endif
@@ -4445,6 +4490,7 @@ void rlUnloadShaderBuffer(unsigned int ssboId)
 {
 #if defined(GRAPHICS_API_OPENGL_43)
     glDeleteBuffers(1, &ssboId);
+    RL_UNTRACK_RESOURCE(BUFFER, ssboId);
 #else
     TRACELOG(RL_LOG_WARNING, "SSBO: SSBO not enabled. Define GRAPHICS_API_OPENGL_43");
 #endif
@@ -4941,6 +4987,7 @@ static void rlUnloadShaderDefault(void)
     glDeleteShader(RLGL.State.defaultFShaderId);
 
     glDeleteProgram(RLGL.State.defaultShaderId);
+    RL_UNTRACK_RESOURCE(SHADER, RLGL.State.defaultShaderId);
 
     RL_FREE(RLGL.State.defaultShaderLocs);
 
@@ -115,14 +115,6 @@
     #endif
 #endif
 
-#if defined(_WIN32)
-    #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
-    #define CHDIR _chdir
-#else
-    #include <unistd.h>     // Required for: chdir() (POSIX) [Used in LoadOBJ()]
-    #define CHDIR chdir
-#endif
-
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -136,16 +128,38 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Async model loading data
+typedef struct AsyncModelData {
+    char *fileName;                 // Model file name
+    Model model;                    // Model loaded on worker thread, uploaded on main thread
+} AsyncModelData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static unsigned int instancesVboId = 0;         // Instances transforms VBO, shared by DrawMeshInstanced() calls
+static int instancesVboCapacity = 0;            // Instances transforms VBO capacity (instances)
+#endif
+
+//----------------------------------------------------------------------------------
+// Other Modules Functions Declaration
+//----------------------------------------------------------------------------------
+extern int AddAsyncAsset(void *data, bool (*load)(void *data), void (*upload)(void *data), void (*unload)(void *data)); // [Module: core] Add async asset
+extern void *ReleaseAsyncAsset(int asset, bool (*load)(void *data)); // [Module: core] Release async asset handle, returns asset data
+extern bool IsAsyncAssetLoading(void);      // [Module: core] Check if current thread is loading an async asset (GPU not available)
+extern unsigned int AddAsyncUpload(unsigned int (*upload)(void *data), void (*release)(void *data), void *data); // [Module: core] Add deferred GPU upload
+extern unsigned int GetAsyncUploadId(unsigned int id);  // [Module: core] Get uploaded GPU resource id from placeholder id
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static bool LoadModelAsyncData(void *data);     // Async model load function (worker thread)
+static void UnloadModelAsyncData(void *data);   // Async model unload function, model not retrieved (main thread)
+static void UploadModelAsyncData(void *data);   // Async model upload function (main thread)
+static unsigned int UploadMeshDeferred(void *data); // Deferred mesh upload, for models loaded by async assets
+void UnloadMeshInstancesBuffer(void);           // Unload instances transforms buffer, required by CloseWindow() [Module: core]
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 static Model LoadOBJ(const char *fileName);     // Load OBJ mesh data
 #endif
@@ -165,7 +179,8 @@ static Model LoadM3D(const char *filename);     // Load M3D mesh data
 static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
-static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
+static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount, const char *basePath);  // Process obj materials, textures paths relative to basePath (if not NULL)
+static const char *GetMaterialTexturePath(const char *basePath, const char *texName);     // Get material texture path relative to basePath (if not NULL)
 #endif
 
 //----------------------------------------------------------------------------------
@@ -1114,7 +1129,12 @@ Model LoadModel(const char *fileName)
     if ((model.meshCount != 0) && (model.meshes != NULL))
     {
         // Upload vertex data to GPU (static meshes)
-        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+        // NOTE: Loading an async model, uploads are deferred to main thread (meshes array is not moved)
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            if (IsAsyncAssetLoading()) AddAsyncUpload(UploadMeshDeferred, NULL, &model.meshes[i]);
+            else UploadMesh(&model.meshes[i], false);
+        }
     }
     else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
 
@@ -1132,6 +1152,36 @@ Model LoadModel(const char *fileName)
     return model;
 }
 
+// Load model from files asynchronously, returns async asset handle
+// NOTE: Model is loaded on a worker thread, meshes and material textures are uploaded on main thread at EndDrawing()
+int LoadModelAsync(const char *fileName)
+{
+    AsyncModelData *data = (AsyncModelData *)RL_CALLOC(1, sizeof(AsyncModelData));
+
+    int fileNameSize = (int)strlen(fileName) + 1;
+    data->fileName = (char *)RL_MALLOC(fileNameSize);
+    memcpy(data->fileName, fileName, fileNameSize);
+
+    return AddAsyncAsset(data, LoadModelAsyncData, UploadModelAsyncData, UnloadModelAsyncData);
+}
+
+// Get model from async asset handle (ready or failed), handle is released
+Model GetAssetModel(int asset)
+{
+    Model model = { 0 };
+    AsyncModelData *data = (AsyncModelData *)ReleaseAsyncAsset(asset, LoadModelAsyncData);
+
+    if (data != NULL)
+    {
+        model = data->model;
+
+        RL_FREE(data->fileName);
+        RL_FREE(data);
+    }
+
+    return model;
+}
+
 // Load model from generated mesh
 // WARNING: A shallow copy of mesh is generated, passed by value,
 // as long as struct contains pointers to data and some values, we get a copy
@@ -1658,7 +1708,6 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Instancing required variables
     float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
 
     // Bind shader program
     rlEnableShader(material.shader.id);
@@ -1705,8 +1754,8 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
+    // Create instances buffer (temporary memory)
+    instanceTransforms = (float16 *)RL_TEMP_ALLOC(instances*sizeof(float16));
 
     // Fill buffer with instances transformations as float16 arrays
     for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
@@ -1714,11 +1763,20 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     // Enable mesh VAO to attach new buffer
     rlEnableVertexArray(mesh.vaoId);
 
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData()
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    // Instances VBO is kept between calls and only recreated when it has to grow,
+    // we're transferring all the transform matrices anyway, so glBufferSubData() is used
+    // to avoid creating and destroying a buffer object on every call
+    if (instances > instancesVboCapacity)
+    {
+        if (instancesVboId > 0) rlUnloadVertexBuffer(instancesVboId);
+
+        instancesVboCapacity = (instancesVboCapacity > 0)? instancesVboCapacity : 256;
+        while (instancesVboCapacity < instances) instancesVboCapacity *= 2;
+
+        instancesVboId = rlLoadVertexBuffer(NULL, instancesVboCapacity*sizeof(float16), true);
+    }
+
+    rlUpdateVertexBuffer(instancesVboId, instanceTransforms, instances*sizeof(float16), 0);
 
     // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
     for (unsigned int i = 0; i < 4; i++)
@@ -1891,9 +1949,20 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     // Disable shader program
     rlDisableShader();
 
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+    // Release instance transforms temporary buffer
+    RL_TEMP_FREE(instanceTransforms);
+#endif
+}
+
+// Unload instances transforms buffer used by DrawMeshInstanced()
+// NOTE: Called by CloseWindow() [Module: core], GPU context must be available
+void UnloadMeshInstancesBuffer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (instancesVboId > 0) rlUnloadVertexBuffer(instancesVboId);
+
+    instancesVboId = 0;
+    instancesVboCapacity = 0;
 #endif
 }
 
@@ -2101,7 +2170,8 @@ bool ExportMeshAsCode(Mesh mesh, const char *fileName)
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 // Process obj materials
-static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, int materialCount)
+// NOTE: Textures paths are relative to basePath (if not NULL), absolute paths are kept
+static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, int materialCount, const char *basePath)
 {
     // Init model mats
     for (int m = 0; m < materialCount; m++)
@@ -2116,23 +2186,36 @@ static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, i
         // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
         materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(GetMaterialTexturePath(basePath, mats[m].diffuse_texname));  //char *diffuse_texname; // map_Kd
         else materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(mats[m].diffuse[0]*255.0f), (unsigned char)(mats[m].diffuse[1]*255.0f), (unsigned char)(mats[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
         materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(mats[m].specular_texname);  //char *specular_texname; // map_Ks
+        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(GetMaterialTexturePath(basePath, mats[m].specular_texname));  //char *specular_texname; // map_Ks
         materials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2]*255.0f), 255 }; //float specular[3];
         materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(GetMaterialTexturePath(basePath, mats[m].bump_texname));  //char *bump_texname; // map_bump, bump
         materials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
         materials[m].maps[MATERIAL_MAP_NORMAL].value = mats[m].shininess;
 
         materials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(mats[m].emission[0]*255.0f), (unsigned char)(mats[m].emission[1]*255.0f), (unsigned char)(mats[m].emission[2]*255.0f), 255 }; //float emission[3];
 
-        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(mats[m].displacement_texname);  //char *displacement_texname; // disp
+        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(GetMaterialTexturePath(basePath, mats[m].displacement_texname));  //char *displacement_texname; // disp
     }
 }
+
+// Get material texture path relative to basePath (if not NULL), absolute paths are returned unchanged
+static const char *GetMaterialTexturePath(const char *basePath, const char *texName)
+{
+    const char *path = texName;
+
+    if ((basePath != NULL) && (texName[0] != '/') && (texName[0] != '\\') && !((texName[0] != '\0') && (texName[1] == ':')))
+    {
+        path = TextFormat("%s/%s", basePath, texName);
+    }
+
+    return path;
+}
 #endif
 
 // Load materials from model file
@@ -2152,7 +2235,7 @@ Material *LoadMaterials(const char *fileName, int *materialCount)
         if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
 
         materials = RL_MALLOC(count*sizeof(Material));
-        ProcessMaterialsOBJ(materials, mats, count);
+        ProcessMaterialsOBJ(materials, mats, count, NULL);
 
         tinyobj_materials_free(mats, count);
     }
@@ -4181,6 +4264,71 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Async model load function (worker thread)
+static bool LoadModelAsyncData(void *data)
+{
+    AsyncModelData *modelData = (AsyncModelData *)data;
+
+    modelData->model = LoadModel(modelData->fileName);
+
+    if (modelData->model.meshCount == 0)
+    {
+        // Failed model CPU data is freed, material textures deferred uploads are released by core
+        // NOTE: Material textures ids are placeholders, materials can not be unloaded
+        Model *model = &modelData->model;
+        for (int i = 0; i < model->materialCount; i++) RL_FREE(model->materials[i].maps);
+
+        RL_FREE(model->meshes);
+        RL_FREE(model->materials);
+        RL_FREE(model->meshMaterial);
+        RL_FREE(model->bones);
+        RL_FREE(model->bindPose);
+
+        *model = (Model){ 0 };
+        model->transform = MatrixIdentity();
+    }
+
+    return (modelData->model.meshCount > 0);
+}
+
+// Async model upload function (main thread)
+// NOTE: Meshes and material textures have already been uploaded, placeholder texture ids are resolved
+static void UploadModelAsyncData(void *data)
+{
+    Model *model = &((AsyncModelData *)data)->model;
+
+    for (int i = 0; i < model->materialCount; i++)
+    {
+        if (model->materials[i].maps == NULL) continue;
+
+        for (int j = 0; j < MAX_MATERIAL_MAPS; j++)
+        {
+            model->materials[i].maps[j].texture.id = GetAsyncUploadId(model->materials[i].maps[j].texture.id);
+        }
+    }
+}
+
+// Async model unload function, model not retrieved (main thread)
+static void UnloadModelAsyncData(void *data)
+{
+    AsyncModelData *modelData = (AsyncModelData *)data;
+
+    if (modelData->model.meshCount > 0) UnloadModel(modelData->model);
+
+    RL_FREE(modelData->fileName);
+    RL_FREE(modelData);
+}
+
+// Deferred mesh upload, for models loaded by async assets
+static unsigned int UploadMeshDeferred(void *data)
+{
+    Mesh *mesh = (Mesh *)data;
+
+    UploadMesh(mesh, false);
+
+    return mesh->vaoId;
+}
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
@@ -4231,18 +4379,15 @@ static Model LoadOBJ(const char *fileName)
         return model;
     }
 
-    char currentDir[1024] = { 0 };
-    strcpy(currentDir, GetWorkingDirectory()); // Save current working directory
-    const char* workingDir = GetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
-    if (CHDIR(workingDir) != 0)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
-    }
-
     unsigned int dataSize = (unsigned int)strlen(fileText);
 
+    // NOTE: Material file and textures paths are resolved relative to OBJ directory,
+    // working directory is not changed (OBJ can be loaded on a worker thread by LoadModelAsync())
+    char basePath[MAX_FILEPATH_LENGTH] = { 0 };
+    strncpy(basePath, GetDirectoryPath(fileName), MAX_FILEPATH_LENGTH - 1);
+
     unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-    int ret = tinyobj_parse_obj(&objAttributes, &objShapes, &objShapeCount, &objMaterials, &objMaterialCount, fileText, dataSize, flags);
+    int ret = tinyobj_parse_obj_ex(&objAttributes, &objShapes, &objShapeCount, &objMaterials, &objMaterialCount, fileText, dataSize, flags, basePath);
 
     if (ret != TINYOBJ_SUCCESS)
     {
@@ -4429,20 +4574,17 @@ static Model LoadOBJ(const char *fileName)
         }
     }
 
-    if (objMaterialCount > 0) ProcessMaterialsOBJ(model.materials, objMaterials, objMaterialCount);
+    if (objMaterialCount > 0) ProcessMaterialsOBJ(model.materials, objMaterials, objMaterialCount, basePath);
     else model.materials[0] = LoadMaterialDefault(); // Set default material for the mesh
 
     tinyobj_attrib_free(&objAttributes);
     tinyobj_shapes_free(objShapes, objShapeCount);
     tinyobj_materials_free(objMaterials, objMaterialCount);
 
-    for (int i = 0; i < model.meshCount; i++)
-        UploadMesh(model.meshes + i, true);
-
-    // Restore current working directory
-    if (CHDIR(currentDir) != 0)
+    // NOTE: Loading an async model, meshes upload is deferred by LoadModel()
+    if (!IsAsyncAssetLoading())
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
+        for (int i = 0; i < model.meshCount; i++) UploadMesh(model.meshes + i, true);
     }
 
     return model;
@@ -70,6 +70,7 @@
 #include <string.h>         // Required for: strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
+#include <math.h>           // Required for: floor(), fabs(), signbit() [Used in FormatText()]
 
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
     #if defined(__GNUC__) // GCC and Clang
@@ -119,7 +120,11 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Async font loading data
+typedef struct AsyncFontData {
+    char *fileName;                 // Font file name
+    Font font;                      // Font loaded on worker thread, texture uploaded on main thread
+} AsyncFontData;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -134,7 +139,10 @@ static Font defaultFont = { 0 };
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
-//...
+extern int AddAsyncAsset(void *data, bool (*load)(void *data), void (*upload)(void *data), void (*unload)(void *data)); // [Module: core] Add async asset
+extern void *ReleaseAsyncAsset(int asset, bool (*load)(void *data)); // [Module: core] Release async asset handle, returns asset data
+extern bool IsAsyncAssetLoading(void);      // [Module: core] Check if current thread is loading an async asset (GPU not available)
+extern unsigned int GetAsyncUploadId(unsigned int id);  // [Module: core] Get uploaded GPU resource id from placeholder id
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -145,6 +153,10 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static bool LoadFontAsyncData(void *data);      // Async font load function (worker thread)
+static void UnloadFontAsyncData(void *data);    // Async font unload function, font not retrieved (main thread)
+static int FormatText(char *buffer, int bufferSize, const char *text, va_list args); // Text formatting into buffer, returns formatted text length
+static void UploadFontAsyncData(void *data);    // Async font upload function (main thread)
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -368,7 +380,8 @@ Font LoadFont(const char *fileName)
         if (font.texture.id == 0) TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font texture -> Using default font", fileName);
         else
         {
-            SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);    // By default, we set point filter (the best performance)
+            // NOTE: Loading an async font, texture upload is deferred (uploaded textures default to point filter)
+            if (!IsAsyncAssetLoading()) SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);    // By default, we set point filter (the best performance)
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", FONT_TTF_DEFAULT_SIZE, FONT_TTF_DEFAULT_NUMCHARS);
         }
     }
@@ -376,6 +389,36 @@ Font LoadFont(const char *fileName)
     return font;
 }
 
+// Load font from file asynchronously, returns async asset handle
+// NOTE: Font is loaded and its atlas generated on a worker thread, atlas texture is uploaded on main thread at EndDrawing()
+int LoadFontAsync(const char *fileName)
+{
+    AsyncFontData *data = (AsyncFontData *)RL_CALLOC(1, sizeof(AsyncFontData));
+
+    int fileNameSize = (int)strlen(fileName) + 1;
+    data->fileName = (char *)RL_MALLOC(fileNameSize);
+    memcpy(data->fileName, fileName, fileNameSize);
+
+    return AddAsyncAsset(data, LoadFontAsyncData, UploadFontAsyncData, UnloadFontAsyncData);
+}
+
+// Get font from async asset handle (ready or failed), handle is released
+Font GetAssetFont(int asset)
+{
+    Font font = { 0 };
+    AsyncFontData *data = (AsyncFontData *)ReleaseAsyncAsset(asset, LoadFontAsyncData);
+
+    if (data != NULL)
+    {
+        font = data->font;
+
+        RL_FREE(data->fileName);
+        RL_FREE(data);
+    }
+
+    return font;
+}
+
 // Load Font from TTF or BDF font file with generation parameters
 // NOTE: You can pass an array with desired characters, those characters should be available in the font
 // if array is NULL, default char set is selected 32..126
@@ -528,8 +571,9 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 {
     Font font = { 0 };
 
+    // NOTE: Not using TextToLower() static buffer, fonts can be loaded from job system workers
     char fileExtLower[16] = { 0 };
-    strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
+    for (int i = 0; (i < 16 - 1) && (fileType[i] != '\0'); i++) fileExtLower[i] = (char)tolower((unsigned char)fileType[i]);
 
     font.baseSize = fontSize;
     font.glyphCount = (codepointCount > 0)? codepointCount : 95;
@@ -838,13 +882,8 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
             }
 
             // Copy pixel data from glyph image to atlas
-            for (int y = 0; y < glyphs[i].image.height; y++)
-            {
-                for (int x = 0; x < glyphs[i].image.width; x++)
-                {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                }
-            }
+            Rectangle glyphRec = { (float)offsetX, (float)offsetY, (float)glyphs[i].image.width, (float)glyphs[i].image.height };
+            ImageViewCopy(GetImageViewRec(GetImageView(atlas), glyphRec), GetImageView(glyphs[i].image));
 
             // Fill chars rectangles in atlas info
             recs[i].x = (float)offsetX;
@@ -885,14 +924,8 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
 
             if (rects[i].was_packed)
             {
-                // Copy pixel data from fc.data to atlas
-                for (int y = 0; y < glyphs[i].image.height; y++)
-                {
-                    for (int x = 0; x < glyphs[i].image.width; x++)
-                    {
-                        ((unsigned char *)atlas.data)[(rects[i].y + padding + y)*atlas.width + (rects[i].x + padding + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                    }
-                }
+                // Copy pixel data from glyph image to atlas
+                ImageViewCopy(GetImageViewRec(GetImageView(atlas), recs[i]), GetImageView(glyphs[i].image));
             }
             else TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", i);
         }
@@ -1406,6 +1439,7 @@ unsigned int TextLength(const char *text)
 
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+// NOTE: Buffers are per-thread, TextFormat() can be used from job system workers (i.e. async assets loading)
 const char *TextFormat(const char *text, ...)
 {
 #ifndef MAX_TEXTFORMAT_BUFFERS
@@ -1413,15 +1447,14 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
 
     va_list args;
     va_start(args, text);
-    int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
+    int requiredByteCount = FormatText(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
     va_end(args);
 
     // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occured
@@ -1438,6 +1471,18 @@ const char *TextFormat(const char *text, ...)
     return currentBuffer;
 }
 
+// Formatting of text with variables to 'embed' into provided buffer
+// NOTE: Text is truncated to fit buffer, returned length is the full formatted text length (as snprintf())
+int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...)
+{
+    va_list args;
+    va_start(args, text);
+    int length = FormatText(buffer, bufferSize, text, args);
+    va_end(args);
+
+    return length;
+}
+
 // Get integer value from text
 // NOTE: This function replaces atoi() [stdlib.h]
 int TextToInteger(const char *text)
@@ -1528,30 +1573,29 @@ bool TextIsEqual(const char *text1, const char *text2)
 // Get a piece of a text string
 const char *TextSubtext(const char *text, int position, int length)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-    int textLength = TextLength(text);
+    TextSubtextBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text, position, length);
 
-    if (position >= textLength)
-    {
-        position = textLength - 1;
-        length = 0;
-    }
+    return buffer;
+}
 
-    if (length >= textLength) length = textLength;
+// Get a piece of a text string into provided buffer, returns bytes copied
+int TextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
 
-    // NOTE: Alternative: memcpy(buffer, text + position, length)
+    int textLength = TextLength(text);
 
-    for (int c = 0 ; c < length ; c++)
-    {
-        *(buffer + c) = *(text + position);
-        text++;
-    }
+    if ((position < 0) || (position >= textLength)) length = 0;
+    else if (length > (textLength - position)) length = textLength - position;
+    if (length >= bufferSize) length = bufferSize - 1;
+    if (length < 0) length = 0;
 
-    *(buffer + length) = '\0';
+    if (length > 0) memcpy(buffer, text + position, length);
+    buffer[length] = '\0';
 
-    return buffer;
+    return length;
 }
 
 // Replace text string
@@ -1623,12 +1667,21 @@ char *TextInsert(const char *text, const char *insert, int position)
 }
 
 // Join text strings with delimiter
-// REQUIRES: memset(), memcpy()
 const char *TextJoin(const char **textList, int count, const char *delimiter)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-    char *textPtr = buffer;
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextJoinBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, textList, count, delimiter);
+
+    return buffer;
+}
+
+// Join text strings with delimiter into provided buffer, returns bytes copied
+// NOTE: Text strings not fitting in buffer are skipped
+// REQUIRES: memcpy()
+int TextJoinBuffer(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
 
     int totalLength = 0;
     int delimiterLen = TextLength(delimiter);
@@ -1637,23 +1690,23 @@ const char *TextJoin(const char **textList, int count, const char *delimiter)
     {
         int textLength = TextLength(textList[i]);
 
-        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
+        // Make sure joined text could fit inside buffer
+        if ((totalLength + textLength) < bufferSize)
         {
-            memcpy(textPtr, textList[i], textLength);
+            memcpy(buffer + totalLength, textList[i], textLength);
             totalLength += textLength;
-            textPtr += textLength;
 
-            if ((delimiterLen > 0) && (i < (count - 1)))
+            if ((delimiterLen > 0) && (i < (count - 1)) && ((totalLength + delimiterLen) < bufferSize))
             {
-                memcpy(textPtr, delimiter, delimiterLen);
+                memcpy(buffer + totalLength, delimiter, delimiterLen);
                 totalLength += delimiterLen;
-                textPtr += delimiterLen;
             }
         }
     }
 
-    return buffer;
+    buffer[totalLength] = '\0';
+
+    return totalLength;
 }
 
 // Split string into multiple strings
@@ -1666,8 +1719,8 @@ const char **TextSplit(const char *text, char delimiter, int *count)
     //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
     //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
 
-    static const char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL const char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
     result[0] = buffer;
@@ -1724,45 +1777,73 @@ int TextFindIndex(const char *text, const char *find)
 // TODO: Support UTF-8 diacritics to upper-case, check codepoints
 const char *TextToUpper(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextToUpperBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get upper case version of provided string into provided buffer, returns bytes copied
+// WARNING: Limited functionality, only basic characters set
+int TextToUpperBuffer(char *buffer, int bufferSize, const char *text)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    int i = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        for (; (i < bufferSize - 1) && (text[i] != '\0'); i++)
         {
             if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
             else buffer[i] = text[i];
         }
     }
 
-    return buffer;
+    buffer[i] = '\0';
+
+    return i;
 }
 
 // Get lower case version of provided string
 // WARNING: Limited functionality, only basic characters set
 const char *TextToLower(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    TextToLowerBuffer(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get lower case version of provided string into provided buffer, returns bytes copied
+// WARNING: Limited functionality, only basic characters set
+int TextToLowerBuffer(char *buffer, int bufferSize, const char *text)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    int i = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        for (; (i < bufferSize - 1) && (text[i] != '\0'); i++)
         {
             if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
             else buffer[i] = text[i];
         }
     }
 
-    return buffer;
+    buffer[i] = '\0';
+
+    return i;
 }
 
 // Get Pascal case notation version of provided string
 // WARNING: Limited functionality, only basic characters set
 const char *TextToPascal(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
     if (text != NULL)
@@ -1790,7 +1871,7 @@ const char *TextToPascal(const char *text)
 // WARNING: Limited functionality, only basic characters set
 const char *TextToSnake(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
     if (text != NULL)
@@ -1818,7 +1899,7 @@ const char *TextToSnake(const char *text)
 // WARNING: Limited functionality, only basic characters set
 const char *TextToCamel(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
     if (text != NULL)
@@ -1880,20 +1961,17 @@ int *LoadCodepoints(const char *text, int *count)
     int textLength = TextLength(text);
 
     int codepointSize = 0;
-    int codepointCount = 0;
+    int codepointCount = GetCodepointCount(text);
 
-    // Allocate a big enough buffer to store as many codepoints as text bytes
-    int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+    // Allocate buffer for the actual number of codepoints, no re-allocation required
+    int *codepoints = (int *)RL_CALLOC((codepointCount > 0)? codepointCount : 1, sizeof(int));
 
-    for (int i = 0; i < textLength; codepointCount++)
+    for (int i = 0, k = 0; (i < textLength) && (k < codepointCount); k++)
     {
-        codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
+        codepoints[k] = GetCodepointNext(text + i, &codepointSize);
         i += codepointSize;
     }
 
-    // Re-allocate buffer to the actual number of codepoints loaded
-    codepoints = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
-
     *count = codepointCount;
 
     return codepoints;
@@ -1926,10 +2004,10 @@ int GetCodepointCount(const char *text)
 }
 
 // Encode codepoint into utf8 text (char array length returned as parameter)
-// NOTE: It uses a static array to store UTF-8 bytes
+// NOTE: It uses a static array (per-thread) to store UTF-8 bytes
 const char *CodepointToUTF8(int codepoint, int *utf8Size)
 {
-    static char utf8[6] = { 0 };
+    static RL_THREAD_LOCAL char utf8[6] = { 0 };
     int size = 0;   // Byte size of codepoint
 
     if (codepoint <= 0x7f)
@@ -2134,6 +2212,206 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Async font load function (worker thread)
+static bool LoadFontAsyncData(void *data)
+{
+    AsyncFontData *fontData = (AsyncFontData *)data;
+
+    fontData->font = LoadFont(fontData->fileName);
+
+    return (fontData->font.glyphs != NULL);
+}
+
+// Async font upload function (main thread)
+// NOTE: Atlas texture has already been uploaded, placeholder texture id is resolved
+static void UploadFontAsyncData(void *data)
+{
+    AsyncFontData *fontData = (AsyncFontData *)data;
+
+    fontData->font.texture.id = GetAsyncUploadId(fontData->font.texture.id);
+}
+
+// Async font unload function, font not retrieved (main thread)
+static void UnloadFontAsyncData(void *data)
+{
+    AsyncFontData *fontData = (AsyncFontData *)data;
+
+    if (fontData->font.glyphs != NULL) UnloadFont(fontData->font);
+
+    RL_FREE(fontData->fileName);
+    RL_FREE(fontData);
+}
+
+// Text formatting into buffer, returns formatted text length (as vsnprintf())
+// NOTE: Most common conversions (%d, %i, %u, %c, %s, %f with flags '-' and '0', width and precision)
+// are formatted directly, avoiding locale handling; any other format falls back to vsnprintf()
+static int FormatText(char *buffer, int bufferSize, const char *text, va_list args)
+{
+    static const double scales[10] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+
+    va_list argsCopy;
+    va_copy(argsCopy, args);    // Required in case of fallback to vsnprintf()
+
+    int length = 0;             // Formatted text length, it could be bigger than buffer size
+    int maxLength = bufferSize - 1;
+    bool fallback = (text == NULL);
+
+    for (const char *ptr = text; !fallback && (*ptr != '\0'); ptr++)
+    {
+        if (*ptr != '%')
+        {
+            if (length < maxLength) buffer[length] = *ptr;
+            length++;
+            continue;
+        }
+
+        ptr++;
+
+        // Parse flags, width and precision: %[flags][width][.precision]specifier
+        bool leftAlign = false;
+        bool zeroPad = false;
+        int width = 0;
+        int precision = -1;
+
+        for (;; ptr++)
+        {
+            if (*ptr == '-') leftAlign = true;
+            else if (*ptr == '0') zeroPad = true;
+            else if ((*ptr == '+') || (*ptr == ' ') || (*ptr == '#') || (*ptr == '\'')) fallback = true;
+            else break;
+        }
+
+        while ((*ptr >= '0') && (*ptr <= '9') && (width < 10000)) width = width*10 + (*ptr++ - '0');
+
+        if (*ptr == '.')
+        {
+            ptr++;
+            precision = 0;
+            while ((*ptr >= '0') && (*ptr <= '9') && (precision < 10000)) precision = precision*10 + (*ptr++ - '0');
+        }
+
+        if (fallback) break;
+
+        char number[32] = { 0 };    // Number digits, filled backwards from the end
+        const char *field = NULL;   // Field text to output (before padding)
+        int fieldLength = 0;
+        int signLength = 0;         // Sign is placed before zero padding
+
+        switch (*ptr)
+        {
+            case '%':
+            {
+                if ((width > 0) || (precision >= 0)) fallback = true;
+                else { number[0] = '%'; field = number; fieldLength = 1; }
+            } break;
+            case 'c':
+            {
+                if (zeroPad) fallback = true;
+                else { number[0] = (char)va_arg(args, int); field = number; fieldLength = 1; }
+            } break;
+            case 's':
+            {
+                field = va_arg(args, const char *);
+                if ((field == NULL) || zeroPad) fallback = true;
+                else
+                {
+                    if (precision < 0) fieldLength = (int)strlen(field);
+                    else while ((fieldLength < precision) && (field[fieldLength] != '\0')) fieldLength++;
+                }
+            } break;
+            case 'd':
+            case 'i':
+            case 'u':
+            {
+                if (precision >= 0) { fallback = true; break; }
+
+                unsigned int value = 0;
+                bool negative = false;
+
+                if (*ptr == 'u') value = va_arg(args, unsigned int);
+                else
+                {
+                    int signedValue = va_arg(args, int);
+                    negative = (signedValue < 0);
+                    value = negative? (0u - (unsigned int)signedValue) : (unsigned int)signedValue;
+                }
+
+                int position = sizeof(number);
+                do { number[--position] = '0' + (value%10); value /= 10; } while (value > 0);
+                if (negative) { number[--position] = '-'; signLength = 1; }
+
+                field = number + position;
+                fieldLength = sizeof(number) - position;
+            } break;
+            case 'f':
+            {
+                double value = va_arg(args, double);
+                if (precision < 0) precision = 6;
+
+                // NOTE: Values not representable as integers, infinities and NaNs are left to vsnprintf()
+                if ((precision > 9) || !(fabs(value) < 1e15)) { fallback = true; break; }
+
+                bool negative = signbit(value);
+                value = fabs(value);
+
+                double integerPart = floor(value);
+                double fraction = (value - integerPart)*scales[precision];
+                double fractionPart = floor(fraction + 0.5);
+
+                // Rounding ties are resolved by vsnprintf(), it uses the exact binary value
+                if (fabs(fraction - floor(fraction) - 0.5) < 1e-6) { fallback = true; break; }
+
+                if (fractionPart >= scales[precision])
+                {
+                    integerPart += 1.0;
+                    fractionPart -= scales[precision];
+                }
+
+                unsigned long long integerValue = (unsigned long long)integerPart;
+                unsigned int fractionValue = (unsigned int)fractionPart;
+
+                int position = sizeof(number);
+                if (precision > 0)
+                {
+                    for (int i = 0; i < precision; i++) { number[--position] = '0' + (fractionValue%10); fractionValue /= 10; }
+                    number[--position] = '.';
+                }
+                do { number[--position] = '0' + (integerValue%10); integerValue /= 10; } while (integerValue > 0);
+                if (negative) { number[--position] = '-'; signLength = 1; }
+
+                field = number + position;
+                fieldLength = sizeof(number) - position;
+            } break;
+            default: fallback = true; break;    // Length modifiers and other specifiers
+        }
+
+        if (fallback) break;
+
+        // Output field with padding
+        int padding = (width > fieldLength)? (width - fieldLength) : 0;
+
+        if (zeroPad && !leftAlign && (*ptr != 's') && (*ptr != 'c'))
+        {
+            for (int i = 0; i < signLength; i++, length++) if (length < maxLength) buffer[length] = field[i];
+            for (int i = 0; i < padding; i++, length++) if (length < maxLength) buffer[length] = '0';
+            field += signLength;
+            fieldLength -= signLength;
+            padding = 0;
+        }
+
+        if (!leftAlign) for (int i = 0; i < padding; i++, length++) if (length < maxLength) buffer[length] = ' ';
+        for (int i = 0; i < fieldLength; i++, length++) if (length < maxLength) buffer[length] = field[i];
+        if (leftAlign) for (int i = 0; i < padding; i++, length++) if (length < maxLength) buffer[length] = ' ';
+    }
+
+    if (fallback) length = vsnprintf(buffer, (bufferSize > 0)? bufferSize : 0, (text != NULL)? text : "", argsCopy);
+    else if (bufferSize > 0) buffer[(length < maxLength)? length : maxLength] = '\0';
+
+    va_end(argsCopy);
+
+    return length;
+}
+
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -19,6 +19,7 @@
 *       #define SUPPORT_FILEFORMAT_DDS
 *       #define SUPPORT_FILEFORMAT_PKM
 *       #define SUPPORT_FILEFORMAT_KTX
+*       #define SUPPORT_FILEFORMAT_KTX2
 *       #define SUPPORT_FILEFORMAT_PVR
 *       #define SUPPORT_FILEFORMAT_ASTC
 *           Select desired fileformats to be supported for image data loading. Some of those formats are
@@ -78,6 +79,20 @@
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
+// SIMD instruction sets available for pixel format conversion kernels [Used in ImageFormat()]
+// NOTE: SSE2 is baseline on x86-64, SSSE3 requires compiler flags (e.g. -mssse3), NEON is baseline on AArch64
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RL_SIMD_SSE2
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics
+    #if defined(__SSSE3__)
+        #define RL_SIMD_SSSE3
+        #include <tmmintrin.h>  // Required for: _mm_shuffle_epi8()
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define RL_SIMD_NEON
+    #include <arm_neon.h>       // Required for: NEON intrinsics
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -116,6 +131,9 @@
 #if defined(SUPPORT_FILEFORMAT_KTX)
     #define RL_GPUTEX_SUPPORT_KTX
 #endif
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+    #define RL_GPUTEX_SUPPORT_KTX2
+#endif
 #if defined(SUPPORT_FILEFORMAT_PVR)
     #define RL_GPUTEX_SUPPORT_PVR
 #endif
@@ -161,6 +179,7 @@
 #if (defined(SUPPORT_FILEFORMAT_DDS) || \
      defined(SUPPORT_FILEFORMAT_PKM) || \
      defined(SUPPORT_FILEFORMAT_KTX) || \
+     defined(SUPPORT_FILEFORMAT_KTX2) || \
      defined(SUPPORT_FILEFORMAT_PVR) || \
      defined(SUPPORT_FILEFORMAT_ASTC))
 
@@ -203,6 +222,11 @@
 
     #define STB_IMAGE_WRITE_IMPLEMENTATION
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
+
+    #if defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+        #include "external/sdefl.h"         // Required for: sdeflate_part() [ExportImage(), ExportImageToMemory()], implementation in rcore
+        #define EXPORT_PNG_SDEFL            // PNG exported with parallel sdefl encoder instead of stbi_write_png_to_mem()
+    #endif
 #endif
 
 #if defined(SUPPORT_IMAGE_GENERATION)
@@ -219,7 +243,7 @@
 #endif
 
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
-#include "external/stb_image_resize2.h"     // Required for: stbir_resize_uint8_linear() [ImageResize()]
+#include "external/stb_image_resize2.h"     // Required for: stbir_resize_extended() [ImageResize(), ImageDrawEx()]
 
 #if defined(__GNUC__) // GCC and Clang
     #pragma GCC diagnostic pop
@@ -244,27 +268,472 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_PARALLEL_MIN_PIXELS
+    #define IMAGE_PARALLEL_MIN_PIXELS  (256*256)    // Minimum image pixels to split image processing across job workers
+#endif
+#ifndef IMAGE_CONVOLUTION_FFT_MIN_SIZE
+    #define IMAGE_CONVOLUTION_FFT_MIN_SIZE  19     // Minimum non separable kernel width to apply convolution by FFT tiles
+#endif
+#ifndef IMAGE_PARALLEL_BAND_PIXELS
+    #define IMAGE_PARALLEL_BAND_PIXELS  (16*1024)   // Pixels per rows band processed by a job worker (sized to fit in L2 cache)
+#endif
+#ifndef IMAGE_ATLAS_MAX_SIZE
+    #define IMAGE_ATLAS_MAX_SIZE        4096        // Atlas maximum width and height used by GenImageAtlas() if not provided
+#endif
+#ifndef IMAGE_BATCH_MAX_IN_FLIGHT
+    #define IMAGE_BATCH_MAX_IN_FLIGHT   8           // Maximum images loaded at the same time by LoadImagesBatch() (limits file data and decoding memory)
+#endif
+#ifndef IMAGE_QUANTIZE_REFINE_ITERATIONS
+    #define IMAGE_QUANTIZE_REFINE_ITERATIONS  2     // Palette refinement iterations (k-means) after median cut quantization
+#endif
+#ifndef IMAGE_EXPORT_PNG_LEVEL
+    #define IMAGE_EXPORT_PNG_LEVEL      1           // PNG export default compression level: 0 (fastest) to 8 (smallest, slowest)
+#endif
+
+#define IMAGE_FORMAT_BATCH_PIXELS   256    // Pixels converted per batch by ImageFormat() generic path (Vector4 temporary on stack)
+#define IMAGE_DRAW_BATCH_PIXELS     256    // Pixels blended per batch by ImageDrawEx() for non R8G8B8A8 formats (Color temporary on stack)
+#define IMAGE_PROCESS_BATCH_PIXELS  256    // Pixels processed per batch by ImageProcess(), all operations applied while in L1 cache
+#define IMAGE_TRANSPOSE_TILE_SIZE    16    // Pixels tile size for image transposition (16x16 Color tile: 1KB)
+#define IMAGE_CONVOLUTION_BATCH_PIXELS  256 // Pixels accumulated per batch by ImageKernelConvolution() (Vector4 temporary on stack)
+#define IMAGE_GEN_BATCH_PIXELS      256    // Pixels generated per batch by GenImage*() generators (float temporary on stack)
+#define IMAGE_PALETTE_BATCH_COLORS 1024    // Unique colors mapped to nearest palette color per parallel-for batch
+#define IMAGE_PNG_BLOCK_BYTES  (256*1024)  // Filtered rows bytes compressed per PNG export block (independent deflate stream part)
+#define MIPMAP_FILTER_RADIUS        3.0f   // Kaiser and Lanczos filters radius, in destination pixels
+#define MIPMAP_KAISER_BETA          4.0f   // Kaiser window shape parameter
+#define MIPMAP_TRANSFER_TABLE_SIZE  4096   // sRGB transfer tables intervals, linear interpolated
+#define MIPMAP_ALPHA_HISTOGRAM_BINS 4096   // Alpha histogram bins to find alpha test coverage threshold
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Async texture loading data
+typedef struct AsyncTextureData {
+    char *fileName;                 // Texture file name
+    Image image;                    // Image loaded on worker thread
+    Texture2D texture;              // Texture uploaded on main thread
+} AsyncTextureData;
+
+// Pixel format conversion data, shared by ImageFormat() parallel ranges
+typedef struct ImageFormatData {
+    const void *src;                // Source pixel data
+    void *dst;                      // Destination pixel data
+    int srcFormat;                  // Source pixel format
+    int dstFormat;                  // Destination pixel format
+    int width;                      // Image width, ranges are defined in rows
+} ImageFormatData;
+
+// Image process stage, consecutive per-channel operations are merged into a single lookup table stage
+typedef struct ImageProcessStage {
+    const ImageProcessOp *op;       // Stage operation, NULL for lookup table stage
+    unsigned char table[4][256];    // Channels lookup table (r, g, b, a), only for lookup table stage
+} ImageProcessStage;
+
+// Image process data, shared by ImageProcess() parallel ranges
+typedef struct ImageProcessData {
+    unsigned char *data;            // Image pixel data
+    int format;                     // Image pixel format
+    int width;                      // Image width, ranges are defined in rows
+    int stride;                     // Image row size in bytes (view stride)
+    const ImageProcessStage *stages; // Process stages
+    int stageCount;                 // Process stages count
+} ImageProcessData;
+
+// Image resize data, shared by ImageResize() parallel splits and input rows callback
+typedef struct ImageResizeData {
+    STBIR_RESIZE *resize;           // Resizer, samplers built with splits
+    const unsigned char *src;       // Source pixel data
+    int srcFormat;                  // Source pixel format (converted to R8G8B8A8 by input rows)
+    int srcStride;                  // Source row size in bytes
+    int srcBytesPerPixel;           // Source pixel size in bytes
+} ImageResizeData;
+
+// Image blur data, shared by ImageBlurGaussian() parallel ranges
+typedef struct ImageBlurData {
+    Color *pixels;                  // Rows pixel data, blurred in place
+    int width;                      // Rows width, ranges are defined in rows
+    int radius;                     // Box filter radius
+    float alpha;                    // Box filter end taps weight (0.0f for plain box filter)
+    bool premultiply;               // Premultiply alpha on rows load
+    bool unpremultiply;             // Reverse premultiplied alpha on rows store
+} ImageBlurData;
+
+// Image transposition data, shared by TransposePixelsRange() parallel ranges
+typedef struct ImageTransposeData {
+    const Color *src;               // Source pixel data
+    Color *dst;                     // Destination pixel data (srcHeight x srcWidth)
+    int srcWidth;                   // Source width, destination rows count
+    int srcHeight;                  // Source height, destination rows width
+} ImageTransposeData;
+
+// Image rotation data, shared by ImageRotateEx() parallel ranges
+typedef struct ImageRotateData {
+    const unsigned char *src;       // Source pixel data
+    const Vector4 *srcNormalized;   // Source pixels normalized, NULL for formats with 8-bit channels
+    unsigned char *dst;             // Destination pixel data
+    int srcWidth;                   // Source width
+    int srcHeight;                  // Source height
+    int width;                      // Destination width
+    int height;                     // Destination height, ranges are defined in rows
+    int format;                     // Pixel format
+    int bytesPerPixel;              // Pixel size in bytes
+    int quarterTurns;               // Clockwise 90 degrees turns (1 to 3), 0 for sampled rotation
+    float sinAngle;                 // Rotation angle sine
+    float cosAngle;                 // Rotation angle cosine
+    bool antialias;                 // Antialiased borders: source extended by one transparent/zero pixel
+    bool alpha;                     // Pixel format has alpha channel (last channel)
+} ImageRotateData;
+
+// Image convolution data, shared by ImageKernelConvolution() parallel ranges
+typedef struct ImageConvolutionData {
+    unsigned char *data;            // Image pixel data, results stored in place
+    int format;                     // Image pixel format
+    int width;                      // Image width
+    int height;                     // Image height
+    Vector4 *padded;                // Source pixels normalized, zero padded by kernel width - 1
+    int paddedWidth;                // Padded pixels width
+    int paddedHeight;               // Padded pixels height
+    Vector4 *rows;                  // Horizontal pass results (width x paddedHeight), separable kernels
+    const float *kernel;            // Kernel matrix (kernelWidth x kernelWidth)
+    const float *kernelColumn;      // Kernel column factor, separable kernels
+    const float *kernelRow;         // Kernel row factor, separable kernels
+    int kernelWidth;                // Kernel width
+    const float *twiddles;          // FFT twiddle factors, FFT tiles
+    const float *spectrum;          // Kernel spectrum (fftSize x fftSize), FFT tiles
+    int fftSize;                    // FFT size, FFT tiles
+    int tileSize;                   // Output tile size (fftSize - kernelWidth + 1), FFT tiles
+    int tilesX;                     // Tiles per row, FFT tiles
+    bool clamp;                     // Clamp results to [0..1], formats with 8-bit per channel or less
+} ImageConvolutionData;
+
+// Image drawing data, shared with ImageViewDraw() resize rows callbacks
+typedef struct ImageDrawData {
+    unsigned char *dst;             // Destination pixel data, first drawing pixel
+    int dstStride;                  // Destination row size in bytes
+    int dstFormat;                  // Destination pixel format
+    const unsigned char *src;       // Source pixel data, first rectangle pixel
+    int srcStride;                  // Source row size in bytes
+    int srcBytesPerPixel;           // Source pixel size in bytes
+    int srcFormat;                  // Source pixel format
+    int rowFormat;                  // Drawn rows pixel format (R8G8B8A8 if source is converted for resize)
+    Rectangle visibleRec;           // Resized source visible region (resize rows callbacks)
+    Color tint;                     // Tint applied to source
+    int blendMode;                  // Blend mode: BLEND_ALPHA, BLEND_ALPHA_PREMULTIPLY
+} ImageDrawData;
+
+// Image mipmaps data, shared by ImageMipmapsEx() parallel ranges
+typedef struct ImageMipmapData {
+    const unsigned char *srcData;   // Source level pixel data, base level (NULL for next levels)
+    const Vector4 *src;             // Source level linear pixels (alpha premultiplied), next levels
+    int srcWidth;                   // Source level width
+    int format;                     // Image pixel format
+    unsigned char *dstData;         // Destination level pixel data
+    Vector4 *dst;                   // Destination level linear pixels (alpha premultiplied)
+    int dstWidth;                   // Destination level width, ranges are defined in rows
+    const int *firstX;              // First source pixel per destination column
+    const float *weightsX;          // Filter weights per destination column (dstWidth x tapsX)
+    int tapsX;                      // Filter taps per destination column
+    const int *firstY;              // First source row per destination row
+    const float *weightsY;          // Filter weights per destination row (dstHeight x tapsY)
+    int tapsY;                      // Filter taps per destination row
+    const float *srgbToLinear;      // sRGB to linear transfer table, NULL for linear color data
+    const float *linearToSrgb;      // Linear to sRGB transfer table, NULL for linear color data
+    const float *byteToLinear;      // 8-bit channel value to linear color table (256 entries)
+    float alphaScale;               // Alpha scale applied on store, alpha test coverage preservation
+    float alphaCutoff;              // Alpha test cutoff, alpha test coverage preservation
+    int coverage;                   // Base level pixels with alpha over cutoff (atomic counter)
+    float bias;                     // Rounding bias applied on store (formats truncated on store)
+    bool clamp;                     // Clamp color to [0..1] on store, formats with 8-bit per channel or less
+    bool store;                     // Store destination rows into pixel data while filtering
+} ImageMipmapData;
+
+// Atlas skyline node, horizontal segment of packed area top edge
+typedef struct AtlasSkylineNode {
+    int x;                          // Segment left position
+    int y;                          // Segment top position (packed area height)
+    int width;                      // Segment width
+} AtlasSkylineNode;
+
+// Atlas packer, skyline bottom-left rectangles packer
+typedef struct AtlasPacker {
+    int width;                      // Atlas width
+    int height;                     // Atlas height
+    int nodeCount;                  // Skyline nodes count
+    AtlasSkylineNode *nodes;        // Skyline nodes, left to right (atlas width + 1 capacity)
+} AtlasPacker;
+
+// Atlas entry, image prepared for packing by GenImageAtlas()
+typedef struct AtlasEntry {
+    int index;                      // Source image index
+    Rectangle trim;                 // Source image rectangle to pack (trimmed)
+    int maxSide;                    // Packed cell larger side, sorting key
+    int minSide;                    // Packed cell smaller side, sorting key
+} AtlasEntry;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Image animation decoder, GIF frames decoded one by one (frames composition managed by stb_image)
+typedef struct ImageAnimDecoder {
+    stbi__context context;          // Decoder input context (file data)
+    stbi__gif gif;                  // Decoder state, last decoded frame composed in gif.out
+    const unsigned char *fileData;  // File data
+    int dataSize;                   // File data size
+    int dataSource;                 // File data source: 0-Memory (not owned), 1-Loaded file, 2-Mapped file
+    unsigned char *twoBack;         // Frame composed before last decoded frame (restored by disposal method 3)
+    unsigned char *spare;           // Frame snapshot buffer, swapped with twoBack
+    int decodedFrame;               // Last decoded frame index, -1 if no frame decoded
+    int decodedDelay;               // Last decoded frame delay in milliseconds
+    bool decoded;                   // Last decoded frame not copied to stream frame yet (decoded ahead)
+    JobCounter counter;             // Decode ahead job counter
+} ImageAnimDecoder;
+#endif
+
+// Image batch loading data, shared by LoadImagesBatch() loader jobs
+typedef struct ImageBatchData {
+    const char **fileNames;         // Image files names
+    int count;                      // Images count
+    Image *images;                  // Loaded images, in files order
+    int *results;                   // Images loading results (ImageLoadResult), NULL if not required
+    int next;                       // Next image to load (atomic counter)
+    int loaded;                     // Images loaded successfully (atomic counter)
+} ImageBatchData;
+
+// Image compression data, shared by ImageCompress() parallel ranges
+typedef struct ImageCompressData {
+    const unsigned char *src;       // Source level pixel data
+    int srcFormat;                  // Source pixel format
+    unsigned char *dst;             // Destination level compressed data
+    int format;                     // Compressed pixel format
+    int width;                      // Level width
+    int height;                     // Level height, ranges are defined in 4x4 blocks rows
+    bool highQuality;               // High quality compression, refined blocks fitting
+    const unsigned char (*singleColor)[256][2]; // DXT single color endpoints tables (5-bit and 6-bit channels)
+} ImageCompressData;
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Procedural image generation data, shared by GenImage*() parallel ranges
+// NOTE: Pixels only depend on their position and generator parameters, output does not depend on workers count
+typedef struct ImageGenData {
+    Color *pixels;                  // Generated pixels (R8G8B8A8), NULL if values generated
+    float *values;                  // Generated values (R32), NULL if pixels generated
+    int width;                      // Image width, ranges are defined in rows
+    int height;                     // Image height
+    int gradient;                   // Gradient type: 0-Linear, 1-Radial, 2-Square
+    Color start;                    // Gradient start (or inner) color
+    Color end;                      // Gradient end (or outer) color
+    float params[4];                // Gradient parameters (direction or center, density)
+    unsigned int seed;              // White noise seed
+    int threshold;                  // White noise threshold, pixels with 24-bit hash value below it are white
+    int offsetX;                    // Perlin noise offset X
+    int offsetY;                    // Perlin noise offset Y
+    float scale;                    // Perlin noise scale
+    float lacunarity;               // Perlin noise fbm lacunarity, spacing between successive octaves
+    float gain;                     // Perlin noise fbm gain, relative weighting applied to each successive octave
+    int octaves;                    // Perlin noise fbm octaves
+    const Vector2 *seeds;           // Cellular seeds, one per tile
+    int seedsPerRow;                // Cellular seeds per row
+    int seedsPerCol;                // Cellular seeds per column
+    int tileSize;                   // Cellular tile size
+} ImageGenData;
+#endif
+
+// Color histogram entry, unique color and pixels count
+typedef struct ColorHistogramEntry {
+    Color color;                    // Unique color
+    int count;                      // Pixels count with color
+} ColorHistogramEntry;
+
+// Color histogram, unique colors indexed by open-addressed hash table (packed RGBA key, linear probing)
+typedef struct ColorHistogram {
+    ColorHistogramEntry *entries;   // Unique colors entries, in first appearance order
+    int count;                      // Unique colors count
+    int capacity;                   // Entries capacity
+    int *slots;                     // Hash table slots, entry index or -1 if empty
+    int slotCount;                  // Hash table slots count (power of 2, load factor kept under 0.5)
+} ColorHistogram;
+
+// Palette nearest color search, palette colors sorted by green channel
+typedef struct PaletteSearch {
+    Color *colors;                  // Palette colors, sorted by green channel
+    int *indices;                   // Palette index of sorted colors
+    int count;                      // Palette colors count
+    int start[256];                 // First sorted color with green channel greater or equal than value
+} PaletteSearch;
+
+// Color box, histogram entries range split by median cut quantization
+typedef struct ColorBox {
+    int first;                      // First histogram entry
+    int count;                      // Histogram entries count
+    long long weight;               // Pixels count
+    double error;                   // Squared distance to box mean color, weighted by pixels count
+    int channel;                    // Channel with greater variance: 0-Red, 1-Green, 2-Blue, 3-Alpha
+} ColorBox;
+
+// Palette colors mapping data, shared by MapPaletteColors() and QuantizePalette() parallel ranges
+typedef struct PaletteMapData {
+    const Color *pixels;            // Source pixels
+    int width;                      // Image width, pixels ranges are defined in rows
+    const ColorHistogram *histogram; // Source pixels unique colors
+    const ColorHistogramEntry *entries; // Unique colors entries, entries ranges are defined in entries
+    const PaletteSearch *search;    // Palette nearest color search
+    int *entryIndices;              // Palette index of unique colors entries
+    const Color *palette;           // Palette colors
+    unsigned char *indices;         // Output palette indices, NULL if not required
+    Color *colors;                  // Output palette colors, NULL if not required (can be source pixels)
+} PaletteMapData;
+
+#if defined(EXPORT_PNG_SDEFL)
+// PNG encoding data, shared by EncodePng() parallel blocks
+typedef struct PngEncodeData {
+    const unsigned char *pixels;    // Source pixels (8-bit channels)
+    int width;                      // Image width
+    int height;                     // Image height
+    int channels;                   // Pixel channels (1 to 4)
+    int blockRows;                  // Rows per block, ranges are defined in blocks
+    int blockCount;                 // Blocks count
+    int level;                      // Compression level
+    unsigned char **blocks;         // Blocks deflate data
+    int *blockSizes;                // Blocks deflate data size
+    unsigned int *blockAdlers;      // Blocks filtered data adler32 checksum
+} PngEncodeData;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static int pngCompressionLevel = IMAGE_EXPORT_PNG_LEVEL;   // PNG export compression level, set by SetPngCompressionLevel()
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
 extern void LoadFontDefault(void);          // [Module: text] Loads default font, required by ImageDrawText()
 
+extern int AddAsyncAsset(void *data, bool (*load)(void *data), void (*upload)(void *data), void (*unload)(void *data)); // [Module: core] Add async asset
+extern void *ReleaseAsyncAsset(int asset, bool (*load)(void *data)); // [Module: core] Release async asset handle, returns asset data
+extern bool IsAsyncAssetLoading(void);      // [Module: core] Check if current thread is loading an async asset (GPU not available)
+extern unsigned int AddAsyncUpload(unsigned int (*upload)(void *data), void (*release)(void *data), void *data); // [Module: core] Add deferred GPU upload
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
-static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void GetPixelsNormalized(const void *data, int format, int offset, int count, Vector4 *pixels); // Get pixels range as Vector4 array (float normalized)
+static void SetPixelsNormalized(void *data, int format, int offset, int count, const Vector4 *pixels); // Set pixels range from Vector4 array (float normalized)
+static bool ConvertPixelsDirect(const void *src, int srcFormat, void *dst, int dstFormat, int offset, int count); // Convert pixels range with direct kernel, if available for formats pair
+static void ConvertPixelsRange(int start, int end, void *userData); // Convert image rows range [start, end), ImageFormat() parallel-for callback
+static void ProcessImageRows(int width, int height, ParallelForCallback callback, void *userData); // Run image rows ranges callback, split in rows bands across job workers for large images
+static void ProcessPixels(Color *pixels, int count, const ImageProcessStage *stages, int stageCount); // Apply image process stages to pixels
+static void ProcessPixelsRange(int start, int end, void *userData); // Process image rows range [start, end), ImageProcess() parallel-for callback
+static void ProcessPixelsSpan(const ImageProcessData *process, unsigned char *data, int count); // Process contiguous pixels span, by batches
+static void BlurImageBoxes(Image *image, int radius, float alpha); // Blur image with separable box filter passes, GAUSSIAN_BLUR_ITERATIONS per direction
+static void BlurPixelsRow(const Color *src, Color *dst, int count, int radius, float alpha); // Blur pixels with one box filter pass (end taps weighted by alpha)
+static void BlurPixelsRange(int start, int end, void *userData); // Blur image rows range [start, end), ImageBlurGaussian() parallel-for callback
+static void TransposePixelsRange(int start, int end, void *userData); // Transpose pixels destination rows range [start, end), parallel-for callback
+static inline void CopyPixelsStrided(unsigned char *dst, const unsigned char *src, int srcStep, int count, int bytesPerPixel); // Copy pixels with source step in bytes
+static void RotateQuartersRange(int start, int end, void *userData); // Rotate image by 90 degrees turns, destination rows range [start, end), parallel-for callback
+static void RotateSampledRange(int start, int end, void *userData); // Rotate image by angle, destination rows range [start, end) bilinear sampled, parallel-for callback
+static inline bool IsRotatedInterior(const ImageRotateData *rotate, float baseX, float baseY, int x); // Check rotated destination pixel has all bilinear taps inside source image
+static void SampleRotatedInterior(const ImageRotateData *rotate, float baseX, float baseY, int first, int last, unsigned char *dst); // Sample rotated destination pixels range with all taps inside source image (8-bit channels)
+static void SampleRotatedBorder(const ImageRotateData *rotate, float baseX, float baseY, int first, int last, unsigned char *dst); // Sample rotated destination pixels range near source image borders (8-bit channels)
+static void SampleRotatedNormalized(const ImageRotateData *rotate, float baseX, float baseY, Vector4 *row); // Sample rotated destination row from normalized source pixels
+static void AccumulatePixels(Vector4 *accum, const Vector4 *pixels, int count, float weight); // Accumulate weighted pixels: accum[i] += pixels[i]*weight
+static void StoreConvolutionPixels(ImageConvolutionData *convolution, Vector4 *pixels, int offset, int count); // Store convolution results into image pixels range
+static void LoadConvolutionRowsRange(int start, int end, void *userData); // Load convolution padded rows range [start, end), parallel-for callback
+static void ConvolveRowsRange(int start, int end, void *userData); // Convolve padded rows range [start, end) with kernel row, parallel-for callback
+static void ConvolveColumnsRange(int start, int end, void *userData); // Convolve image rows range [start, end) with kernel column, parallel-for callback
+static void ConvolveDirectRange(int start, int end, void *userData); // Convolve image rows range [start, end) with full kernel, parallel-for callback
+static void ConvolveTilesRange(int start, int end, void *userData); // Convolve image tiles range [start, end) by FFT, parallel-for callback
+static void ComputeFFT(float *data, int size, int stride, const float *twiddles, bool inverse); // Compute in-place radix-2 complex FFT
+static void ComputeFFT2D(float *data, int size, const float *twiddles, bool inverse); // Compute in-place 2D complex FFT (size x size)
+static void ResizeImageSplits(int start, int end, void *userData); // Resize image splits range [start, end), ImageResize() parallel-for callback
+static const void *ResizeImageInput(void *output, const void *input, int count, int x, int y, void *userData); // Resize input rows callback for ImageResize()
+static float GetMipmapFilterWeight(int filter, float x, float scale); // Get mipmap filter weight for source pixel at distance x from destination pixel center
+static int ComputeMipmapWeights(int filter, int srcSize, int dstSize, int *first, float *weights); // Compute mipmap filter weights for one dimension, returns taps per destination pixel
+static inline float GetTransferValue(const float *table, float value); // Get value from transfer table, linear interpolated
+static void LoadMipmapPixels(const ImageMipmapData *mipmap, int offset, int count, Vector4 *pixels); // Load mipmap base level pixels as linear color, alpha premultiplied
+static void StoreMipmapPixels(const ImageMipmapData *mipmap, int offset, int count, const Vector4 *pixels); // Store mipmap level pixels from linear color with alpha premultiplied
+static void FilterMipmapPixels(const Vector4 *src, Vector4 *dst, int count, const int *first, const float *weights, int taps); // Filter mipmap source pixels row (horizontal pass)
+static void FilterMipmapRowsRange(int start, int end, void *userData); // Filter mipmap destination rows range [start, end), ImageMipmapsEx() parallel-for callback
+static void StoreMipmapRowsRange(int start, int end, void *userData); // Store mipmap level rows range [start, end), ImageMipmapsEx() parallel-for callback
+static void CountMipmapCoverageRange(int start, int end, void *userData); // Count base level pixels with alpha over cutoff, ImageMipmapsEx() parallel-for callback
+static float GetMipmapAlphaScale(const Vector4 *pixels, int count, float cutoff, float coverage); // Get mipmap level alpha scale to preserve alpha test coverage
+static void CompressBlocksRange(int start, int end, void *userData); // Compress image blocks rows range [start, end), ImageCompress() parallel-for callback
+static int MatchBlockDXT1(const Color *pixels, int transparent, unsigned short *c0, unsigned short *c1, bool threeColors, unsigned int *indices); // Assign block pixels to nearest DXT1 palette colors
+static void CompressBlockDXT1(const Color *pixels, unsigned char *block, bool alpha, bool highQuality, const unsigned char (*singleColor)[256][2]); // Compress 4x4 pixels block color into DXT1 block
+static int MatchBlockDXT5Alpha(const unsigned char *values, int a0, int a1, unsigned long long *indices); // Assign values to nearest DXT5 alpha palette values
+static void CompressBlockDXT5Alpha(const unsigned char *values, unsigned char *block, bool highQuality); // Compress 16 values into DXT5 alpha block (BC4 block)
+static int FitSubblockETC(const Color *pixels, const int *base, bool exact, int *table, int *indices); // Fit ETC subblock pixels to base color
+static void CompressBlockETC2(const Color *pixels, unsigned char *block, bool planar, bool highQuality); // Compress 4x4 pixels block into ETC2 RGB block (ETC1 compatible if planar disabled)
+static void CompressBlockEAC(const unsigned char *values, unsigned char *block, bool highQuality); // Compress 16 values into ETC2 EAC alpha block
+
+static void CopyImageColors(Image image, Color *pixels);    // Copy image pixel data into a Color array (RGBA - 32bit)
+static void GetPixelsColor(const void *data, int format, int count, Color *colors); // Get pixels colors from pixel data of certain format
+static void SetPixelsColor(void *data, const Color *colors, int count, int format); // Set pixels colors formatted into pixel data of certain format
+static void BlendPixelsAlpha(Color *dst, const Color *src, int count, Color tint); // Blend src pixels into dst pixels with tint (ColorAlphaBlend())
+static void BlendPixelsPremultiplied(Color *dst, const Color *src, int count, Color tint); // Blend premultiplied src pixels into dst pixels with tint
+static void DrawPixelsRow(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int count, Color tint, int blendMode); // Draw src pixels row into dst pixels row
+static const void *ImageDrawResizeInput(void *output, const void *input, int count, int x, int y, void *userData); // Resize input rows callback for ImageViewDraw()
+static void ImageDrawResizeOutput(const void *output, int count, int y, void *userData); // Resize output rows callback for ImageViewDraw()
+
+static AtlasPacker *LoadAtlasPacker(int width, int height);     // Load atlas packer, empty skyline
+static int FitAtlasSkyline(const AtlasPacker *packer, int index, int width, int height); // Get position y to place rectangle at skyline node, -1 if it does not fit
+static void AddAtlasSkyline(AtlasPacker *packer, int index, int y, int width, int height); // Add rectangle placed at skyline node to skyline
+static bool PackAtlasSprite(AtlasPacker *packer, Rectangle trim, int padding, bool allowRotation, AtlasSprite *sprite); // Pack sprite cell (trimmed size plus padding) into atlas
+static void DrawAtlasSprite(ImageAtlas *atlas, Image image, Rectangle trim, AtlasSprite sprite); // Draw sprite pixels into atlas image, borders extruded if required
+static Rectangle GetAtlasTrimRec(Image image, int flags); // Get image rectangle to pack into atlas, empty if image can not be packed
+static int CompareAtlasEntries(const void *a, const void *b); // Compare atlas entries for packing order, larger first
+
+static inline unsigned int GetColorKey(Color color);        // Get color packed RGBA key
+static ColorHistogram LoadColorHistogram(const Color *pixels, int count, bool skipTransparent); // Load pixels unique colors histogram, transparent pixels skipped or counted as BLANK
+static void UnloadColorHistogram(ColorHistogram histogram); // Unload color histogram
+static int GetColorHistogramEntry(const ColorHistogram *histogram, Color color); // Get color histogram entry index, -1 if color not found
+static void ComputeColorBox(const ColorHistogramEntry *entries, ColorBox *box); // Compute color box weight, error and split channel
+static int QuantizePalette(const ColorHistogramEntry *entries, int count, int maxColors, Color *palette); // Quantize unique colors to best palette (median cut), returns palette colors count
+static PaletteSearch *LoadPaletteSearch(const Color *palette, int count); // Load palette nearest color search
+static void UnloadPaletteSearch(PaletteSearch *search);     // Unload palette nearest color search
+static int GetPaletteNearest(const PaletteSearch *search, Color color); // Get palette index of nearest color
+static void MapPaletteColors(const Color *pixels, int width, int height, const Color *palette, int count, bool dither, unsigned char *indices, Color *colors); // Map pixels to nearest palette colors, output indices and/or colors
+static void MapEntriesRange(int start, int end, void *userData); // Map unique colors entries range [start, end) to nearest palette colors, parallel-for callback
+static void MapPixelsRange(int start, int end, void *userData); // Map pixels rows range [start, end) to nearest palette colors, parallel-for callback
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+static ImageAnimStream LoadImageAnimStreamGif(const unsigned char *fileData, int dataSize, int dataSource); // Load image animation stream from GIF data, first frame decoded
+static void ResetImageAnimDecoder(ImageAnimDecoder *decoder);   // Reset image animation decoder to animation start
+static bool DecodeImageAnimFrame(ImageAnimDecoder *decoder);    // Decode next animation frame (first frame after last one)
+static void DecodeImageAnimJob(void *userData);                 // Decode next animation frame job, decode ahead
+static void CopyImageAnimFrame(ImageAnimStream *anim, ImageAnimDecoder *decoder); // Copy decoded frame to stream frame, next frame decoded ahead if possible
+static int GetGifFrameCount(const unsigned char *fileData, int dataSize); // Get GIF frames count, blocks scanned without decoding
+#endif
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenGradientRange(int start, int end, void *userData); // Generate gradient image rows range [start, end), GenImageGradient*() parallel-for callback
+static void GetGradientFactors(const ImageGenData *gen, int x, int y, int count, float *factors); // Get gradient factors for row pixels, clamped to [0.0f..1.0f] range
+static void BlendGradientPixels(const float *factors, int count, Color start, Color end, Color *pixels); // Blend gradient start and end colors by factors into pixels
+static void GenWhiteNoiseRange(int start, int end, void *userData); // Generate white noise image rows range [start, end), GenImageWhiteNoise() parallel-for callback
+static void GenPerlinNoiseRange(int start, int end, void *userData); // Generate perlin noise image rows range [start, end), GenImagePerlinNoise() parallel-for callback
+static void GetPerlinNoiseFbm(const float *x, float y, float z, int count, float lacunarity, float gain, int octaves, float *values); // Get perlin noise fbm values for points along x axis
+#if defined(RL_SIMD_SSE2) || defined(RL_SIMD_NEON)
+static void AddPerlinNoiseOctave(const float *x, float y, float z, int count, float frequency, float amplitude, unsigned char seed, float *values); // Add perlin noise octave for points along x axis (SIMD)
+#endif
+static void GenCellularRange(int start, int end, void *userData); // Generate cellular image rows range [start, end), GenImageCellular() parallel-for callback
+#endif
+
+static void LoadImagesBatchJob(void *userData);            // Load batch images one after another until all images are taken, LoadImagesBatch() loader job
+#if defined(EXPORT_PNG_SDEFL)
+static unsigned char *EncodePng(const unsigned char *pixels, int width, int height, int channels, int level, int *dataSize); // Encode pixels into PNG file data, blocks compressed in parallel
+static unsigned char *WritePngChunk(unsigned char *ptr, const char *type, const unsigned char *data, int size, const unsigned int *crcTable); // Write PNG chunk, returns pointer after chunk
+static void EncodePngBlocksRange(int start, int end, void *userData); // Encode PNG blocks range [start, end), EncodePng() parallel-for callback
+static unsigned int FilterPngRow(const unsigned char *row, const unsigned char *prev, int stride, int bpp, int filter, unsigned char *out); // Filter PNG row, returns filtered values cost
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int size); // Compute adler32 checksum of data
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int size2); // Combine adler32 checksums of consecutive data blocks
+#endif
+static bool LoadTextureAsyncData(void *data);               // Async texture load function (worker thread)
+static void UploadTextureAsyncData(void *data);             // Async texture upload function (main thread)
+static void UnloadTextureAsyncData(void *data);             // Async texture unload function, texture not retrieved (main thread)
+static unsigned int UploadTextureDeferred(void *data);      // Deferred texture upload, for textures loaded by async assets
+static void ReleaseTextureDeferred(void *data);             // Deferred texture release, for async assets failed to load
+#if defined(SUPPORT_FILEFORMAT_DDS) || defined(SUPPORT_FILEFORMAT_KTX2)
+static bool LoadTextureFromMappedFile(const char *fileName, Texture2D *texture); // Load texture from memory-mapped file (DDS, KTX2), returns false if file can not be mapped or parsed
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -418,6 +887,7 @@ Image LoadImageSvg(const char *fileNameOrString, int width, int height)
 //  - Number of frames is returned through 'frames' parameter
 //  - All frames are returned in RGBA format
 //  - Frames delay data is discarded
+// NOTE: Use LoadImageAnimStream() to decode frames on demand (with frames delay)
 Image LoadImageAnim(const char *fileName, int *frames)
 {
     Image image = { 0 };
@@ -496,6 +966,152 @@ Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileDat
     return image;
 }
 
+// Load image animation stream from file, frames decoded on demand
+// NOTE: GIF frames are decoded one by one into a single frame buffer, memory used does not depend on frames count,
+// file data is memory mapped if possible, other image formats are loaded as a single frame animation
+ImageAnimStream LoadImageAnimStream(const char *fileName)
+{
+    ImageAnimStream anim = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (IsFileExtension(fileName, ".gif"))
+    {
+        int dataSize = 0;
+        int dataSource = 2;
+        unsigned char *fileData = rMapFile(fileName, &dataSize);
+
+        if (fileData == NULL)
+        {
+            fileData = LoadFileData(fileName, &dataSize);
+            dataSource = 1;
+        }
+
+        if (fileData != NULL) anim = LoadImageAnimStreamGif(fileData, dataSize, dataSource);
+    }
+#else
+    if (false) { }
+#endif
+    else
+    {
+        anim.frame = LoadImage(fileName);
+
+        if (anim.frame.data != NULL)
+        {
+            ImageFormat(&anim.frame, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            anim.frameCount = 1;
+        }
+    }
+
+    return anim;
+}
+
+// Load image animation stream from memory buffer
+// WARNING: File data is not copied, it must be kept while stream is used
+ImageAnimStream LoadImageAnimStreamFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    ImageAnimStream anim = { 0 };
+
+    // Security check for input data
+    if ((fileType == NULL) || (fileData == NULL) || (dataSize == 0)) return anim;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if ((strcmp(fileType, ".gif") == 0) || (strcmp(fileType, ".GIF") == 0))
+    {
+        anim = LoadImageAnimStreamGif(fileData, dataSize, 0);
+    }
+#else
+    if (false) { }
+#endif
+    else
+    {
+        anim.frame = LoadImageFromMemory(fileType, fileData, dataSize);
+
+        if (anim.frame.data != NULL)
+        {
+            ImageFormat(&anim.frame, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            anim.frameCount = 1;
+        }
+    }
+
+    return anim;
+}
+
+// Check if an image animation stream is ready
+bool IsImageAnimStreamReady(ImageAnimStream anim)
+{
+    return (IsImageReady(anim.frame) && (anim.frameCount > 0));
+}
+
+// Unload image animation stream
+void UnloadImageAnimStream(ImageAnimStream anim)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    ImageAnimDecoder *decoder = (ImageAnimDecoder *)anim.ctxData;
+
+    if (decoder != NULL)
+    {
+        WaitJobCounter(&decoder->counter);
+
+        STBI_FREE(decoder->gif.out);
+        STBI_FREE(decoder->gif.history);
+        STBI_FREE(decoder->gif.background);
+        RL_FREE(decoder->twoBack);
+        RL_FREE(decoder->spare);
+
+        if (decoder->dataSource == 1) UnloadFileData((unsigned char *)decoder->fileData);
+        else if (decoder->dataSource == 2) rUnmapFile((unsigned char *)decoder->fileData, decoder->dataSize);
+
+        RL_FREE(decoder);
+    }
+#endif
+
+    UnloadImage(anim.frame);
+}
+
+// Update image animation stream frame with next frame (loops to first frame after last frame)
+// NOTE: If job system is initialized, next frame is decoded ahead by a job worker
+void UpdateImageAnimStream(ImageAnimStream *anim)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if ((anim == NULL) || (anim->ctxData == NULL)) return;
+
+    ImageAnimDecoder *decoder = (ImageAnimDecoder *)anim->ctxData;
+
+    WaitJobCounter(&decoder->counter);
+
+    if (!decoder->decoded) decoder->decoded = DecodeImageAnimFrame(decoder);
+    if (decoder->decoded) CopyImageAnimFrame(anim, decoder);
+#endif
+}
+
+// Seek image animation stream to frame
+// NOTE: GIF frames are composed from previous frames, seeking backwards decodes frames again from first frame
+void SeekImageAnimStream(ImageAnimStream *anim, int frame)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if ((anim == NULL) || (anim->ctxData == NULL)) return;
+
+    ImageAnimDecoder *decoder = (ImageAnimDecoder *)anim->ctxData;
+
+    if (frame < 0) frame = 0;
+    if (frame >= anim->frameCount) frame = anim->frameCount - 1;
+
+    WaitJobCounter(&decoder->counter);
+
+    if (frame < decoder->decodedFrame) ResetImageAnimDecoder(decoder);
+
+    while (decoder->decodedFrame < frame)
+    {
+        int previousFrame = decoder->decodedFrame;
+
+        // NOTE: Decoding stops if animation restarted (frames count and decodable frames mismatch)
+        if (!DecodeImageAnimFrame(decoder) || (decoder->decodedFrame <= previousFrame)) break;
+    }
+
+    if (decoder->decodedFrame >= 0) CopyImageAnimFrame(anim, decoder);
+#endif
+}
+
 // Load image from memory buffer, fileType refers to extension: i.e. ".png"
 // WARNING: File extension must be provided in lower-case
 Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
@@ -648,6 +1264,12 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
         image.data = rl_load_ktx_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
     }
 #endif
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+    else if ((strcmp(fileType, ".ktx2") == 0) || (strcmp(fileType, ".KTX2") == 0))
+    {
+        image.data = rl_load_ktx2_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
+#endif
 #if defined(SUPPORT_FILEFORMAT_PVR)
     else if ((strcmp(fileType, ".pvr") == 0) || (strcmp(fileType, ".PVR") == 0))
     {
@@ -668,6 +1290,35 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
     return image;
 }
 
+// Load images from files in parallel (job system), images are returned in files order
+// NOTE 1: Images failed to load are empty, results (optional) provides every image loading result (ImageLoadResult)
+// NOTE 2: Images are loaded by loader jobs, one image after another, loaders count is limited by
+// IMAGE_BATCH_MAX_IN_FLIGHT to limit memory used by file data and decoding at the same time
+int LoadImagesBatch(const char **fileNames, int count, Image *images, int *results)
+{
+    if ((fileNames == NULL) || (images == NULL) || (count <= 0)) return 0;
+
+    for (int i = 0; i < count; i++) images[i] = (Image){ 0 };
+
+    ImageBatchData batch = { fileNames, count, images, results, 0, 0 };
+
+    // Loaders run on job workers and calling thread (while waiting for completion)
+    int loaderCount = GetJobWorkerCount() + 1;
+    if (loaderCount > IMAGE_BATCH_MAX_IN_FLIGHT) loaderCount = IMAGE_BATCH_MAX_IN_FLIGHT;
+    if (loaderCount > count) loaderCount = count;
+
+    JobCounter counter = { 0 };
+
+    for (int i = 0; i < loaderCount; i++) SubmitJob(LoadImagesBatchJob, &batch, &counter);
+
+    WaitJobCounter(&counter);
+
+    if (batch.loaded < count) TRACELOG(LOG_WARNING, "IMAGE: Images batch partially loaded (%i images out of %i)", batch.loaded, count);
+    else TRACELOG(LOG_INFO, "IMAGE: Images batch loaded successfully (%i images)", count);
+
+    return batch.loaded;
+}
+
 // Load image from GPU texture data
 // NOTE: Compressed texture formats not supported
 Image LoadImageFromTexture(Texture2D texture)
@@ -736,7 +1387,8 @@ void UnloadImage(Image image)
 }
 
 // Export image data to file
-// NOTE: File format depends on fileName extension
+// NOTE: File format depends on fileName extension, GPU-ready containers (.dds, .ktx, .ktx2) store
+// image data as is, each one requires its SUPPORT_FILEFORMAT_* flag (.dds and .ktx2 enabled by default)
 bool ExportImage(Image image, const char *fileName)
 {
     int result = 0;
@@ -753,7 +1405,7 @@ bool ExportImage(Image image, const char *fileName)
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
+    else if (!IsFileExtension(fileName, ".dds;.ktx;.ktx2;.raw"))    // GPU-ready containers store image data as is
     {
         // NOTE: Getting Color array as RGBA unsigned char values
         imgData = (unsigned char *)LoadImageColors(image);
@@ -764,7 +1416,11 @@ bool ExportImage(Image image, const char *fileName)
     if (IsFileExtension(fileName, ".png"))
     {
         int dataSize = 0;
+#if defined(EXPORT_PNG_SDEFL)
+        unsigned char *fileData = EncodePng((const unsigned char *)imgData, image.width, image.height, channels, pngCompressionLevel, &dataSize);
+#else
         unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
+#endif
         result = SaveFileData(fileName, fileData, dataSize);
         RL_FREE(fileData);
     }
@@ -806,6 +1462,24 @@ bool ExportImage(Image image, const char *fileName)
     {
         result = rl_save_ktx(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
     }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+    else if (IsFileExtension(fileName, ".ktx2"))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = rl_save_ktx2_to_memory(image.data, image.width, image.height, image.format, image.mipmaps, &dataSize);
+        if (fileData != NULL) result = SaveFileData(fileName, fileData, dataSize);
+        RL_FREE(fileData);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (IsFileExtension(fileName, ".dds"))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = rl_save_dds_to_memory(image.data, image.width, image.height, image.format, image.mipmaps, &dataSize);
+        if (fileData != NULL) result = SaveFileData(fileName, fileData, dataSize);
+        RL_FREE(fileData);
+    }
 #endif
     else if (IsFileExtension(fileName, ".raw"))
     {
@@ -843,7 +1517,23 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
+#if defined(EXPORT_PNG_SDEFL)
+        fileData = EncodePng((const unsigned char *)image.data, image.width, image.height, channels, pngCompressionLevel, dataSize);
+#else
         fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+#endif
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    if ((strcmp(fileType, ".dds") == 0) || (strcmp(fileType, ".DDS") == 0))
+    {
+        fileData = rl_save_dds_to_memory(image.data, image.width, image.height, image.format, image.mipmaps, dataSize);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+    if ((strcmp(fileType, ".ktx2") == 0) || (strcmp(fileType, ".KTX2") == 0))
+    {
+        fileData = rl_save_ktx2_to_memory(image.data, image.width, image.height, image.format, image.mipmaps, dataSize);
     }
 #endif
 
@@ -852,6 +1542,16 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
     return fileData;
 }
 
+// Set PNG export compression level: 0 (fastest) to 8 (smallest, slowest)
+// NOTE: Used by ExportImage(), ExportImageToMemory() and TakeScreenshot(), requires SUPPORT_COMPRESSION_API
+void SetPngCompressionLevel(int level)
+{
+    if (level < 0) level = 0;
+    else if (level > 8) level = 8;
+
+    pngCompressionLevel = level;
+}
+
 // Export image as code file (.h) defining an array of bytes
 bool ExportImageAsCode(Image image, const char *fileName)
 {
@@ -943,24 +1643,18 @@ Image GenImageGradientLinear(int width, int height, int direction, Color start,
     float cosDir = cosf(radianDirection);
     float sinDir = sinf(radianDirection);
 
-    for (int i = 0; i < width; i++)
-    {
-        for (int j = 0; j < height; j++)
-        {
-            // Calculate the relative position of the pixel along the gradient direction
-            float pos = (i*cosDir + j*sinDir)/(width*cosDir + height*sinDir);
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.gradient = 0;
+    gen.start = start;
+    gen.end = end;
+    gen.params[0] = cosDir;
+    gen.params[1] = sinDir;
+    gen.params[2] = width*cosDir + height*sinDir;   // Gradient length along direction
 
-            float factor = pos;
-            factor = (factor > 1.0f)? 1.0f : factor;  // Clamp to [0,1]
-            factor = (factor < 0.0f)? 0.0f : factor;  // Clamp to [0,1]
-
-            // Generate the color for this pixel
-            pixels[j*width + i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
-            pixels[j*width + i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
-            pixels[j*width + i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
-            pixels[j*width + i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
-        }
-    }
+    ProcessImageRows(width, height, GenGradientRange, &gen);
 
     Image image = {
         .data = pixels,
@@ -979,25 +1673,19 @@ Image GenImageGradientRadial(int width, int height, float density, Color inner,
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
     float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
-
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.gradient = 1;
+    gen.start = inner;
+    gen.end = outer;
+    gen.params[0] = (float)width/2.0f;              // Center X
+    gen.params[1] = (float)height/2.0f;             // Center Y
+    gen.params[2] = radius*density;                 // Inner color radius
+    gen.params[3] = radius*(1.0f - density);        // Gradient length
 
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    ProcessImageRows(width, height, GenGradientRange, &gen);
 
     Image image = {
         .data = pixels,
@@ -1011,42 +1699,25 @@ Image GenImageGradientRadial(int width, int height, float density, Color inner,
 }
 
 // Generate image: square gradient
+// NOTE: Gradient factor is based on the normalized Manhattan distance from the center,
+// density makes the gradient start from the center when 0, and from the edge when 1
 Image GenImageGradientSquare(int width, int height, float density, Color inner, Color outer)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            // Calculate the Manhattan distance from the center
-            float distX = fabsf(x - centerX);
-            float distY = fabsf(y - centerY);
-
-            // Normalize the distances by the dimensions of the gradient rectangle
-            float normalizedDistX = distX/centerX;
-            float normalizedDistY = distY/centerY;
-
-            // Calculate the total normalized Manhattan distance
-            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.gradient = 2;
+    gen.start = inner;
+    gen.end = outer;
+    gen.params[0] = (float)width/2.0f;              // Center X
+    gen.params[1] = (float)height/2.0f;             // Center Y
+    gen.params[2] = density;
+    gen.params[3] = 1.0f - density;
 
-            // Subtract the density from the manhattanDist, then divide by (1 - density)
-            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
-            float factor = (manhattanDist - density)/(1.0f - density);
-
-            // Clamp the factor between 0 and 1
-            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
-
-            // Blend the colors based on the calculated factor
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    ProcessImageRows(width, height, GenGradientRange, &gen);
 
     Image image = {
         .data = pixels,
@@ -1085,16 +1756,24 @@ Image GenImageChecked(int width, int height, int checksX, int checksY, Color col
 }
 
 // Generate image: white noise
-// NOTE: It requires GetRandomValue(), defined in [rcore]
+// NOTE: It requires GetRandomValue(), defined in [rcore], noise seed is taken from random generator,
+// pixels values are hashed from their position, so SetRandomSeed() sets the generated noise
 Image GenImageWhiteNoise(int width, int height, float factor)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    for (int i = 0; i < width*height; i++)
-    {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
-        else pixels[i] = BLACK;
-    }
+    int threshold = (int)(factor*100.0f);
+    if (threshold < 0) threshold = 0;
+    if (threshold > 100) threshold = 100;
+
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.seed = ((unsigned int)GetRandomValue(0, 0x7fff) << 15) | (unsigned int)GetRandomValue(0, 0x7fff);
+    gen.threshold = (int)(((long long)threshold << 24)/100);   // Scaled to 24-bit hash values
+
+    ProcessImageRows(width, height, GenWhiteNoiseRange, &gen);
 
     Image image = {
         .data = pixels,
@@ -1112,45 +1791,59 @@ Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    float aspectRatio = (float)width / (float)height;
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
+    // Calculate a better perlin noise using fbm (fractal brownian motion)
+    // Typical values to start playing with:
+    //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+    //   gain       =  0.5   -- relative weighting applied to each successive octave
+    //   octaves    =  6     -- number of "octaves" of noise3() to sum
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.offsetX = offsetX;
+    gen.offsetY = offsetY;
+    gen.scale = scale;
+    gen.lacunarity = 2.0f;
+    gen.gain = 0.5f;
+    gen.octaves = 6;
+
+    ProcessImageRows(width, height, GenPerlinNoiseRange, &gen);
 
-            // Apply aspect ratio compensation to wider side
-            if (width > height) nx *= aspectRatio;
-            else ny /= aspectRatio;
-            
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
 
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+    return image;
+}
 
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
+// Generate image: perlin noise heightmap, fbm parameters and float values in [0.0f..1.0f] range
+// NOTE: Generated image format is PIXELFORMAT_UNCOMPRESSED_R32, noise is not quantized to 8-bit
+Image GenImagePerlinNoiseEx(int width, int height, int offsetX, int offsetY, float scale, float lacunarity, float gain, int octaves)
+{
+    float *values = (float *)RL_MALLOC(width*height*sizeof(float));
 
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
+    ImageGenData gen = { 0 };
+    gen.values = values;
+    gen.width = width;
+    gen.height = height;
+    gen.offsetX = offsetX;
+    gen.offsetY = offsetY;
+    gen.scale = scale;
+    gen.lacunarity = lacunarity;
+    gen.gain = gain;
+    gen.octaves = octaves;
 
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    ProcessImageRows(width, height, GenPerlinNoiseRange, &gen);
 
     Image image = {
-        .data = pixels,
+        .data = values,
         .width = width,
         .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .format = PIXELFORMAT_UNCOMPRESSED_R32,
         .mipmaps = 1
     };
 
@@ -1168,6 +1861,7 @@ Image GenImageCellular(int width, int height, int tileSize)
 
     Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
 
+    // NOTE: Seeds are generated sequentially, before pixels generation, to keep random sequence
     for (int i = 0; i < seedCount; i++)
     {
         int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
@@ -1175,39 +1869,16 @@ Image GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (Vector2){ (float)x, (float)y };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.seeds = seeds;
+    gen.seedsPerRow = seedsPerRow;
+    gen.seedsPerCol = seedsPerCol;
+    gen.tileSize = tileSize;
 
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    ProcessImageRows(width, height, GenCellularRange, &gen);
 
     RL_FREE(seeds);
 
@@ -1288,24 +1959,10 @@ Image ImageCopy(Image image)
 }
 
 // Create an image from another image piece
+// NOTE: Rectangle is clamped to image bounds
 Image ImageFromImage(Image image, Rectangle rec)
 {
-    Image result = { 0 };
-
-    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
-
-    result.width = (int)rec.width;
-    result.height = (int)rec.height;
-    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
-    result.format = image.format;
-    result.mipmaps = 1;
-
-    for (int y = 0; y < (int)rec.height; y++)
-    {
-        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
-    }
-
-    return result;
+    return ImageFromView(GetImageViewRec(GetImageView(image), rec));
 }
 
 // Crop an image to area defined by a rectangle
@@ -1315,48 +1972,32 @@ void ImageCrop(Image *image, Rectangle crop)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    // Security checks to validate crop rectangle
-    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
-    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
-    if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
-    if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
-    if ((crop.x > image->width) || (crop.y > image->height))
-    {
-        TRACELOG(LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
-        return;
-    }
-
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-
-        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
+        // NOTE: Crop rectangle is clamped to image bounds by view
+        ImageView view = GetImageViewRec(GetImageView(*image), crop);
 
-        // OPTION 1: Move cropped data line-by-line
-        for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
+        if (view.data == NULL)
         {
-            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
-            offsetSize += ((int)crop.width*bytesPerPixel);
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
+            return;
         }
 
-        /*
-        // OPTION 2: Move cropped data pixel-by-pixel or byte-by-byte
-        for (int y = (int)crop.y; y < (int)(crop.y + crop.height); y++)
-        {
-            for (int x = (int)crop.x; x < (int)(crop.x + crop.width); x++)
-            {
-                //memcpy(croppedData + ((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) croppedData[((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
-        */
+        // Cropped rows are moved in place to the start of image data (a row never overwrites
+        // following source rows), image memory is shrunk once, no new buffer required
+        int rowSize = GetPixelDataSize(view.width, 1, view.format);
+        unsigned char *croppedData = (unsigned char *)image->data;
 
-        RL_FREE(image->data);
-        image->data = croppedData;
-        image->width = (int)crop.width;
-        image->height = (int)crop.height;
+        for (int y = 0; y < view.height; y++) memmove(croppedData + y*rowSize, (unsigned char *)view.data + y*view.stride, rowSize);
+
+        croppedData = (unsigned char *)RL_REALLOC(image->data, rowSize*view.height);
+        if (croppedData != NULL) image->data = croppedData;
+
+        image->width = view.width;
+        image->height = view.height;
+        image->mipmaps = 1;
     }
 }
 
@@ -1370,202 +2011,136 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            // NOTE: Common 8/16/32 bit formats pairs are converted directly (SIMD when available),
+            // other pairs go through normalized Vector4 batches, supporting 8 to 32 bit per channel
+            void *data = RL_MALLOC(GetPixelDataSize(image->width, image->height, newFormat));
+            ImageFormatData conversion = { image->data, data, image->format, newFormat, image->width };
+
+            // Large images are split in rows bands, converted in parallel by job workers
+            ProcessImageRows(image->width, image->height, ConvertPixelsRange, &conversion);
 
             RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
+            image->data = data;
             image->format = newFormat;
 
-            switch (image->format)
+            // In case original image had mipmaps, generate mipmaps for formatted image
+            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+            if (image->mipmaps > 1)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                image->mipmaps = 1;
+            #if defined(SUPPORT_IMAGE_MANIPULATION)
+                if (image->data != NULL) ImageMipmaps(image);
+            #endif
+            }
+        }
+        else if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) ImageCompress(image, newFormat, false);
+        else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
+    }
+}
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+// Compress image data (and mipmaps) to block compressed format
+// NOTE 1: Supported formats: DXT1 (RGB and RGBA), DXT3, DXT5, ETC1, ETC2 and ETC2 EAC
+// NOTE 2: High quality refines blocks fitting (slower), blocks rows are compressed in parallel for large images
+void ImageCompress(Image *image, int format, bool highQuality)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be compressed");
+        return;
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    if ((format < PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format > PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported for compression");
+        return;
+    }
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+    // DXT single color endpoints tables, endpoints with closest 2/3 interpolated value, initialized on first use
+    static unsigned char singleColor[2][256][2] = { 0 };
+    static bool singleColorReady = false;
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+    if (!singleColorReady)
+    {
+        for (int t = 0; t < 2; t++)
+        {
+            int bits = (t == 0)? 5 : 6;
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+            for (int value = 0; value < 256; value++)
+            {
+                int bestError = 0x7fffffff;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                for (int e0 = 0; e0 < (1 << bits); e0++)
                 {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    for (int e1 = 0; e1 < (1 << bits); e1++)
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+                        int x0 = (e0 << (8 - bits)) | (e0 >> (2*bits - 8));
+                        int x1 = (e1 << (8 - bits)) | (e1 >> (2*bits - 8));
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+                        // NOTE: Endpoints distance is added to error, limiting interpolation differences between decoders
+                        int error = 100*abs((2*x0 + x1 + 1)/3 - value) + abs(x0 - x1);
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                        if (error < bestError)
+                        {
+                            bestError = error;
+                            singleColor[t][value][0] = (unsigned char)e0;
+                            singleColor[t][value][1] = (unsigned char)e1;
+                        }
                     }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+                }
+            }
+        }
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+        singleColorReady = true;
+    }
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+    int mipWidth = image->width;
+    int mipHeight = image->height;
+    int mipSize = 0;
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        mipSize += GetPixelDataSize(mipWidth, mipHeight, format);
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+    }
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+    unsigned char *data = (unsigned char *)RL_MALLOC(mipSize);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+    ImageCompressData compress = { 0 };
+    compress.src = (const unsigned char *)image->data;
+    compress.srcFormat = image->format;
+    compress.dst = data;
+    compress.format = format;
+    compress.width = image->width;
+    compress.height = image->height;
+    compress.highQuality = highQuality;
+    compress.singleColor = singleColor;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
-            }
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        int blockRows = (compress.height + 3)/4;
 
-            RL_FREE(pixels);
-            pixels = NULL;
+        // Large levels are split in blocks rows bands, compressed in parallel by job workers
+        if ((compress.width*compress.height) >= IMAGE_PARALLEL_MIN_PIXELS)
+        {
+            int bandRows = IMAGE_PARALLEL_BAND_PIXELS/(compress.width*4);
 
-            // In case original image had mipmaps, generate mipmaps for formatted image
-            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
-            if (image->mipmaps > 1)
-            {
-                image->mipmaps = 1;
-            #if defined(SUPPORT_IMAGE_MANIPULATION)
-                if (image->data != NULL) ImageMipmaps(image);
-            #endif
-            }
+            ParallelFor(blockRows, (bandRows > 0)? bandRows : 1, CompressBlocksRange, &compress);
         }
-        else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
+        else CompressBlocksRange(0, blockRows, &compress);
+
+        compress.src += GetPixelDataSize(compress.width, compress.height, image->format);
+        compress.dst += GetPixelDataSize(compress.width, compress.height, format);
+        compress.width = (compress.width > 1)? compress.width/2 : 1;
+        compress.height = (compress.height > 1)? compress.height/2 : 1;
     }
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = format;
 }
 
 // Create an image from text (default font)
@@ -1817,6 +2392,72 @@ Image ImageFromChannel(Image image, int selectedChannel)
     return result;
 }
 
+// Create an indexed image (GRAYSCALE, palette indices) from image colors nearest to palette colors
+// NOTE: Palette is limited to 256 colors, transparent pixels are mapped to nearest color to BLANK,
+// Floyd-Steinberg dithering diffuses mapping error to neighbour pixels (no dithering for transparent pixels)
+Image ImageIndexed(Image image, const Color *palette, int colorCount, bool dither)
+{
+    Image result = { 0 };
+
+    // Security check to avoid program crash
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (palette == NULL)) return result;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be indexed");
+        return result;
+    }
+
+    if ((colorCount < 1) || (colorCount > 256))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Indexed image palette requires 1 to 256 colors (%i colors provided)", colorCount);
+        return result;
+    }
+
+    Color *pixels = LoadImageColors(image);
+
+    result.data = RL_MALLOC(image.width*image.height);
+    result.width = image.width;
+    result.height = image.height;
+    result.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    result.mipmaps = 1;
+
+    MapPaletteColors(pixels, image.width, image.height, palette, colorCount, dither, (unsigned char *)result.data, NULL);
+
+    UnloadImageColors(pixels);
+
+    return result;
+}
+
+// Create an image (RGBA) from indexed image (GRAYSCALE, palette indices) and palette colors
+// NOTE: Indices out of palette range are set to BLANK
+Image ImageFromIndexed(Image indexed, const Color *palette, int colorCount)
+{
+    Image result = { 0 };
+
+    // Security check to avoid program crash
+    if ((indexed.data == NULL) || (indexed.width == 0) || (indexed.height == 0) || (palette == NULL)) return result;
+
+    if (indexed.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Indexed image requires GRAYSCALE format (palette indices)");
+        return result;
+    }
+
+    const unsigned char *indices = (const unsigned char *)indexed.data;
+    Color *pixels = (Color *)RL_MALLOC(indexed.width*indexed.height*sizeof(Color));
+
+    for (int i = 0; i < indexed.width*indexed.height; i++) pixels[i] = (indices[i] < colorCount)? palette[indices[i]] : BLANK;
+
+    result.data = pixels;
+    result.width = indexed.width;
+    result.height = indexed.height;
+    result.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    result.mipmaps = 1;
+
+    return result;
+}
+
 // Resize and image to new size using Nearest-Neighbor scaling algorithm
 void ImageResizeNN(Image *image,int newWidth,int newHeight)
 {
@@ -1865,50 +2506,65 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    // Check if we can use a fast path on image scaling
-    // It can be for 8 bit per channel images with 1 to 4 channels per pixel
-    if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+        TRACELOG(LOG_WARNING, "IMAGE: Image resize not supported for compressed image formats");
+        return;
+    }
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+    // Check if we can use a fast path on image scaling
+    // It can be for 8 bit per channel images with 1 to 4 channels per pixel,
+    // other formats are converted to R8G8B8A8 by input rows and reformatted once resized
+    int layout = 0;
 
-        RL_FREE(image->data);
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
-    }
-    else
+    switch (image->format)
     {
-        // Get data as Color pixels array to work with it
-        Color *pixels = LoadImageColors(*image);
-        Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: layout = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: layout = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: layout = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: layout = 4; break;
+        default: break;
+    }
+
+    bool convertRequired = (layout == 0);
+    if (convertRequired) layout = 4;
+
+    unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*layout);
+
+    STBIR_RESIZE resize = { 0 };
+    ImageResizeData resizeData = { &resize, (unsigned char *)image->data, image->format,
+        GetPixelDataSize(image->width, 1, image->format), GetPixelDataSize(1, 1, image->format) };
+
+    stbir_resize_init(&resize, image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)layout, STBIR_TYPE_UINT8);
+    stbir_set_user_data(&resize, &resizeData);
+    if (convertRequired) stbir_set_pixel_callbacks(&resize, ResizeImageInput, NULL);
 
-        // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+    // Large images are split in rows bands, resized in parallel by job workers
+    int splits = ((newWidth*newHeight) >= IMAGE_PARALLEL_MIN_PIXELS)? GetJobWorkerCount() + 1 : 1;
+    splits = stbir_build_samplers_with_splits(&resize, splits);
+
+    if (splits > 0)
+    {
+        ParallelFor(splits, 1, ResizeImageSplits, &resizeData);
+        stbir_free_samplers(&resize);
 
         int format = image->format;
 
-        UnloadImageColors(pixels);
         RL_FREE(image->data);
-
         image->data = output;
         image->width = newWidth;
         image->height = newHeight;
-        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-        ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+        if (convertRequired)
+        {
+            image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+        }
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to resize image");
+        RL_FREE(output);
     }
 }
 
@@ -2167,310 +2823,164 @@ void ImageAlphaMask(Image *image, Image alphaMask)
 // Premultiply alpha channel
 void ImageAlphaPremultiply(Image *image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    float alpha = 0.0f;
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        if (pixels[i].a == 0)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-        }
-        else if (pixels[i].a < 255)
-        {
-            alpha = (float)pixels[i].a/255.0f;
-            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
-        }
-    }
+    ImageProcessOp op = { IMAGE_PROCESS_ALPHA_PREMULTIPLY, 0.0f, { 0 }, { 0 } };
 
-    RL_FREE(image->data);
+    ImageProcess(image, &op, 1);
+}
 
-    int format = image->format;
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+// Apply Gaussian blur using a box blur approximation
+// NOTE: GAUSSIAN_BLUR_ITERATIONS box filter passes of radius blurSize, applied on premultiplied alpha colors
+void ImageBlurGaussian(Image *image, int blurSize)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (blurSize <= 0)) return;
 
-    ImageFormat(image, format);
+    BlurImageBoxes(image, blurSize, 0.0f);
 }
 
-// Apply box blur to image
-void ImageBlurGaussian(Image *image, int blurSize)
+// Apply Gaussian blur with exact standard deviation (sigma in pixels)
+// NOTE: GAUSSIAN_BLUR_ITERATIONS extended box filter passes are used (box filter plus fractional weight
+// end taps), combined passes variance matches sigma^2 exactly and cost does not depend on sigma
+void ImageBlurGaussianSigma(Image *image, float sigma)
 {
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (sigma <= 0.0f)) return;
 
-    ImageAlphaPremultiply(image);
+    // Box filter radius with variance under pass variance, end taps weight adds the remaining variance
+    float variance = sigma*sigma/GAUSSIAN_BLUR_ITERATIONS;
+    int radius = (int)floorf(0.5f*sqrtf(12.0f*variance + 1.0f) - 0.5f);
+    float alpha = (2*radius + 1)*(variance - radius*(radius + 1)/3.0f)/(2.0f*((radius + 1)*(radius + 1) - variance));
 
-    Color *pixels = LoadImageColors(*image);
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    BlurImageBoxes(image, radius, alpha);
+}
+
+// Apply custom square convolution kernel to image
+// NOTE: The convolution kernel matrix is expected to be square, kernel is centered on pixel (kernelWidth/2),
+// pixels outside image are zero. Separable kernels (rank 1) are applied as two 1D passes, large kernels use
+// FFT tiles (kernel width >= IMAGE_CONVOLUTION_FFT_MIN_SIZE), other kernels are applied directly.
+// Image is processed as normalized floats, 16-bit and 32-bit formats results are not clamped to [0..1]
+void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
+{
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
+
+    int kernelWidth = (int)sqrtf((float)kernelSize);
 
-    for (int i = 0; i < (image->height*image->width); i++)
+    if (kernelWidth*kernelWidth != kernelSize)
     {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
+        TRACELOG(LOG_WARNING, "IMAGE: Convolution kernel must be square to be applied");
+        return;
     }
 
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+        TRACELOG(LOG_WARNING, "IMAGE: Convolution not supported for compressed image formats");
+        return;
+    }
 
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
+    ImageConvolutionData convolution = { 0 };
+    convolution.data = (unsigned char *)image->data;
+    convolution.format = image->format;
+    convolution.width = image->width;
+    convolution.height = image->height;
+    convolution.paddedWidth = image->width + kernelWidth - 1;
+    convolution.paddedHeight = image->height + kernelWidth - 1;
+    convolution.kernel = kernel;
+    convolution.kernelWidth = kernelWidth;
+    convolution.clamp = (image->format != PIXELFORMAT_UNCOMPRESSED_R32) && (image->format != PIXELFORMAT_UNCOMPRESSED_R32G32B32) &&
+        (image->format != PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) && (image->format != PIXELFORMAT_UNCOMPRESSED_R16) &&
+        (image->format != PIXELFORMAT_UNCOMPRESSED_R16G16B16) && (image->format != PIXELFORMAT_UNCOMPRESSED_R16G16B16A16);
 
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
+    // Check kernel separability: rank 1 kernel is the product of the pivot (max) element column and row
+    float *kernelColumn = (float *)RL_CALLOC(2*kernelWidth, sizeof(float));
+    float *kernelRow = kernelColumn + kernelWidth;
+    bool separable = true;
+    int pivot = 0;
 
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
+    for (int i = 1; i < kernelSize; i++) if (fabsf(kernel[i]) > fabsf(kernel[pivot])) pivot = i;
 
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
+    if (kernel[pivot] != 0.0f)
+    {
+        float tolerance = fabsf(kernel[pivot])*1e-5f;
+
+        for (int i = 0; i < kernelWidth; i++)
+        {
+            kernelColumn[i] = kernel[i*kernelWidth + pivot%kernelWidth];
+            kernelRow[i] = kernel[(pivot/kernelWidth)*kernelWidth + i]/kernel[pivot];
         }
 
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
+        for (int i = 0; (i < kernelSize) && separable; i++)
         {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+            if (fabsf(kernel[i] - kernelColumn[i/kernelWidth]*kernelRow[i%kernelWidth]) > tolerance) separable = false;
+        }
+    }
 
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+    convolution.kernelColumn = kernelColumn;
+    convolution.kernelRow = kernelRow;
 
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+    // Load source pixels as normalized floats, zero padded
+    convolution.padded = (Vector4 *)RL_MALLOC(convolution.paddedWidth*convolution.paddedHeight*sizeof(Vector4));
+    ProcessImageRows(convolution.paddedWidth, convolution.paddedHeight, LoadConvolutionRowsRange, &convolution);
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+    if (separable)
+    {
+        convolution.rows = (Vector4 *)RL_MALLOC(image->width*convolution.paddedHeight*sizeof(Vector4));
+        ProcessImageRows(image->width, convolution.paddedHeight, ConvolveRowsRange, &convolution);
+        ProcessImageRows(image->width, image->height, ConvolveColumnsRange, &convolution);
+        RL_FREE(convolution.rows);
     }
-
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
+    else if (kernelWidth >= IMAGE_CONVOLUTION_FFT_MIN_SIZE)
     {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
-}
-
-// Apply custom square convolution kernel to image
-// NOTE: The convolution kernel matrix is expected to be square
-void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
-{
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
-
-    int kernelWidth = (int)sqrtf((float)kernelSize);
-
-    if (kernelWidth*kernelWidth != kernelSize)
-    {
-        TRACELOG(LOG_WARNING, "IMAGE: Convolution kernel must be square to be applied");
-        return;
-    }
-
-    Color *pixels = LoadImageColors(*image);
-
-    Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
+        // Tiles transform size: power of two, at least 4 times the kernel overlap
+        int fftSize = 64;
+        while (fftSize < 4*(kernelWidth - 1)) fftSize *= 2;
 
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+        convolution.fftSize = fftSize;
+        convolution.tileSize = fftSize - kernelWidth + 1;
+        convolution.tilesX = (image->width + convolution.tileSize - 1)/convolution.tileSize;
 
-    int startRange = 0, endRange = 0;
+        int tilesY = (image->height + convolution.tileSize - 1)/convolution.tileSize;
 
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
+        // Twiddle factors: exp(-2*PI*i*k/fftSize), k < fftSize/2
+        float *twiddles = (float *)RL_MALLOC(fftSize*sizeof(float));
 
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
+        for (int k = 0; k < fftSize/2; k++)
         {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
+            twiddles[2*k] = (float)cos(2.0*PI*k/fftSize);
+            twiddles[2*k + 1] = (float)-sin(2.0*PI*k/fftSize);
+        }
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
+        // Kernel spectrum, kernel placed at tile origin
+        float *spectrum = (float *)RL_CALLOC(2*fftSize*fftSize, sizeof(float));
 
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
+        for (int i = 0; i < kernelWidth; i++)
+        {
+            for (int j = 0; j < kernelWidth; j++) spectrum[2*(i*fftSize + j)] = kernel[i*kernelWidth + j];
+        }
 
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
+        ComputeFFT2D(spectrum, fftSize, twiddles, false);
 
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
+        convolution.twiddles = twiddles;
+        convolution.spectrum = spectrum;
 
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+        ParallelFor(convolution.tilesX*tilesY, 1, ConvolveTilesRange, &convolution);
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
+        RL_FREE(spectrum);
+        RL_FREE(twiddles);
     }
+    else ProcessImageRows(image->width, image->height, ConvolveDirectRange, &convolution);
 
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
+    RL_FREE(convolution.padded);
+    RL_FREE(kernelColumn);
 
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
+    // In case image had mipmaps, regenerate mipmaps from processed image
+    if (image->mipmaps > 1)
+    {
+        image->mipmaps = 1;
+        ImageMipmaps(image);
     }
-
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    ImageFormat(image, format);
 }
 
 // Generate all mipmap levels for a provided image
@@ -2543,6 +3053,177 @@ void ImageMipmaps(Image *image)
     else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
 }
 
+// Generate all mipmap levels for a provided image, each level filtered from previous one
+// NOTE 1: Color is filtered alpha weighted (premultiplied), in linear space for sRGB color data
+// NOTE 2: Alpha cutoff > 0.0f scales levels alpha to preserve base level alpha test coverage (i.e. foliage)
+// NOTE 3: Available mipmap levels are regenerated, mipmaps format is the same as base image
+void ImageMipmapsEx(Image *image, int filter, bool srgb, float alphaCutoff)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps generation not supported for compressed formats");
+        return;
+    }
+
+    if ((filter < MIPMAP_FILTER_BOX) || (filter > MIPMAP_FILTER_LANCZOS)) filter = MIPMAP_FILTER_BOX;
+
+    int mipCount = 1;                   // Required mipmap levels count (including base level)
+    int mipWidth = image->width;        // Base image width
+    int mipHeight = image->height;      // Base image height
+    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);  // Image data size (in bytes)
+
+    // Count mipmap levels required
+    while ((mipWidth != 1) || (mipHeight != 1))
+    {
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+
+        mipCount++;
+        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);
+    }
+
+    if (mipCount == 1) return;
+
+    if (image->mipmaps < mipCount)
+    {
+        void *temp = RL_REALLOC(image->data, mipSize);
+
+        if (temp == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
+
+        image->data = temp;
+    }
+
+    // sRGB transfer tables, initialized on first use
+    static float srgbToLinear[MIPMAP_TRANSFER_TABLE_SIZE + 1] = { 0 };
+    static float linearToSrgb[MIPMAP_TRANSFER_TABLE_SIZE + 1] = { 0 };
+    static bool srgbTablesReady = false;
+
+    if (srgb && !srgbTablesReady)
+    {
+        for (int i = 0; i <= MIPMAP_TRANSFER_TABLE_SIZE; i++)
+        {
+            float value = (float)i/MIPMAP_TRANSFER_TABLE_SIZE;
+
+            srgbToLinear[i] = (value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f);
+            linearToSrgb[i] = (value <= 0.0031308f)? value*12.92f : 1.055f*powf(value, 1.0f/2.4f) - 0.055f;
+        }
+
+        srgbTablesReady = true;
+    }
+
+    bool hasAlpha = (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                    (image->format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+                    (image->format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) ||
+                    (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+                    (image->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) ||
+                    (image->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16);
+    bool floatFormat = (image->format >= PIXELFORMAT_UNCOMPRESSED_R32) && (image->format <= PIXELFORMAT_UNCOMPRESSED_R16G16B16A16);
+    bool byteFormat = (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+                      (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                      (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+                      (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    float byteToLinear[256] = { 0 };
+    for (int i = 0; i < 256; i++) byteToLinear[i] = srgb? GetTransferValue(srgbToLinear, (float)i/255.0f) : (float)i/255.0f;
+
+    ImageMipmapData mipmap = { 0 };
+    mipmap.srcData = (const unsigned char *)image->data;
+    mipmap.srcWidth = image->width;
+    mipmap.format = image->format;
+    mipmap.srgbToLinear = srgb? srgbToLinear : NULL;
+    mipmap.linearToSrgb = srgb? linearToSrgb : NULL;
+    mipmap.byteToLinear = byteToLinear;
+    mipmap.alphaCutoff = alphaCutoff;
+    mipmap.bias = byteFormat? 0.5f/255.0f : 0.0f;
+    mipmap.clamp = !floatFormat;
+
+    // Base level alpha test coverage
+    bool preserveCoverage = hasAlpha && (alphaCutoff > 0.0f) && (alphaCutoff < 1.0f);
+    float coverage = 0.0f;
+
+    if (preserveCoverage)
+    {
+        ProcessImageRows(image->width, image->height, CountMipmapCoverageRange, &mipmap);
+        coverage = (float)mipmap.coverage/((float)image->width*image->height);
+    }
+
+    // Linear pixels of two consecutive levels, next level filtered from previous one
+    int levelWidth = (image->width > 1)? image->width/2 : 1;
+    int levelHeight = (image->height > 1)? image->height/2 : 1;
+    Vector4 *levels[2] = { 0 };
+    levels[0] = (Vector4 *)RL_MALLOC(levelWidth*levelHeight*sizeof(Vector4));
+    levels[1] = (Vector4 *)RL_MALLOC(((levelWidth > 1)? levelWidth/2 : 1)*((levelHeight > 1)? levelHeight/2 : 1)*sizeof(Vector4));
+    int *first = (int *)RL_MALLOC((levelWidth + levelHeight)*sizeof(int));
+
+    unsigned char *levelData = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
+    int srcWidth = image->width;
+    int srcHeight = image->height;
+
+    for (int level = 1; level < mipCount; level++)
+    {
+        int dstWidth = (srcWidth > 1)? srcWidth/2 : 1;
+        int dstHeight = (srcHeight > 1)? srcHeight/2 : 1;
+
+        TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i)", level, dstWidth, dstHeight);
+
+        mipmap.tapsX = ComputeMipmapWeights(filter, srcWidth, dstWidth, NULL, NULL);
+        mipmap.tapsY = ComputeMipmapWeights(filter, srcHeight, dstHeight, NULL, NULL);
+
+        float *weights = (float *)RL_MALLOC((dstWidth*mipmap.tapsX + dstHeight*mipmap.tapsY)*sizeof(float));
+
+        ComputeMipmapWeights(filter, srcWidth, dstWidth, first, weights);
+        ComputeMipmapWeights(filter, srcHeight, dstHeight, first + dstWidth, weights + dstWidth*mipmap.tapsX);
+
+        mipmap.srcData = (level == 1)? (const unsigned char *)image->data : NULL;
+        mipmap.src = levels[level%2];
+        mipmap.srcWidth = srcWidth;
+        mipmap.dstData = levelData;
+        mipmap.dst = levels[(level - 1)%2];
+        mipmap.dstWidth = dstWidth;
+        mipmap.firstX = first;
+        mipmap.weightsX = weights;
+        mipmap.firstY = first + dstWidth;
+        mipmap.weightsY = weights + dstWidth*mipmap.tapsX;
+        mipmap.alphaScale = 1.0f;
+        mipmap.store = !preserveCoverage;
+
+        // NOTE: Rows bands are enlarged for wide filters, source rows are filtered again by every band
+        if ((srcWidth*srcHeight) >= IMAGE_PARALLEL_MIN_PIXELS)
+        {
+            int bandRows = IMAGE_PARALLEL_BAND_PIXELS/dstWidth;
+            if (bandRows < 2*mipmap.tapsY) bandRows = 2*mipmap.tapsY;
+
+            ParallelFor(dstHeight, bandRows, FilterMipmapRowsRange, &mipmap);
+        }
+        else FilterMipmapRowsRange(0, dstHeight, &mipmap);
+
+        if (preserveCoverage)
+        {
+            mipmap.alphaScale = GetMipmapAlphaScale(mipmap.dst, dstWidth*dstHeight, alphaCutoff, coverage);
+            ProcessImageRows(dstWidth, dstHeight, StoreMipmapRowsRange, &mipmap);
+        }
+
+        RL_FREE(weights);
+
+        levelData += GetPixelDataSize(dstWidth, dstHeight, image->format);
+        srcWidth = dstWidth;
+        srcHeight = dstHeight;
+    }
+
+    RL_FREE(first);
+    RL_FREE(levels[1]);
+    RL_FREE(levels[0]);
+
+    image->mipmaps = mipCount;
+}
+
 // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 // NOTE: In case selected bpp do not represent a known 16bit format,
 // dithered data is stored in the LSB part of the unsigned short
@@ -2726,6 +3407,15 @@ void ImageFlipHorizontal(Image *image)
 
 // Rotate image in degrees
 void ImageRotate(Image *image, int degrees)
+{
+    ImageRotateEx(image, (float)degrees, false);
+}
+
+// Rotate image by angle in degrees (clockwise), bilinear sampling
+// NOTE 1: Rotations by multiples of 90 degrees are exact (pixels moved by tiles)
+// NOTE 2: Antialiasing smooths image borders: source pixels are extended by one transparent pixel
+// (formats with alpha) or one zero pixel (formats without alpha) around image
+void ImageRotateEx(Image *image, float degrees, bool antialias)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2734,171 +3424,127 @@ void ImageRotate(Image *image, int degrees)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        float rad = degrees*PI/180.0f;
-        float sinRadius = sinf(rad);
-        float cosRadius = cosf(rad);
+        ImageRotateData rotate = { 0 };
+        rotate.src = (const unsigned char *)image->data;
+        rotate.srcWidth = image->width;
+        rotate.srcHeight = image->height;
+        rotate.format = image->format;
+        rotate.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        rotate.antialias = antialias;
 
-        int width = (int)(fabsf(image->width*cosRadius) + fabsf(image->height*sinRadius));
-        int height = (int)(fabsf(image->height*cosRadius) + fabsf(image->width*sinRadius));
+        float turns = degrees/90.0f;
 
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
+        if (turns == floorf(turns))
+        {
+            // Exact rotation, pixels moved by tiles
+            rotate.quarterTurns = (int)fmodf(turns, 4.0f);
+            if (rotate.quarterTurns < 0) rotate.quarterTurns += 4;
+            if (rotate.quarterTurns == 0) return;
 
-        for (int y = 0; y < height; y++)
+            rotate.width = (rotate.quarterTurns == 2)? image->width : image->height;
+            rotate.height = (rotate.quarterTurns == 2)? image->height : image->width;
+            rotate.dst = (unsigned char *)RL_MALLOC(rotate.width*rotate.height*rotate.bytesPerPixel);
+
+            ProcessImageRows(rotate.width, rotate.height, RotateQuartersRange, &rotate);
+        }
+        else
         {
-            for (int x = 0; x < width; x++)
+            float rad = degrees*PI/180.0f;
+            rotate.sinAngle = sinf(rad);
+            rotate.cosAngle = cosf(rad);
+            rotate.width = (int)(fabsf(image->width*rotate.cosAngle) + fabsf(image->height*rotate.sinAngle));
+            rotate.height = (int)(fabsf(image->height*rotate.cosAngle) + fabsf(image->width*rotate.sinAngle));
+
+            if ((rotate.width == 0) || (rotate.height == 0)) return;
+
+            switch (image->format)
             {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: rotate.alpha = true; break;
+                default: break;
+            }
 
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
-                {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
+            // NOTE: Formats with 8-bit channels are sampled directly (fixed point),
+            // other formats are sampled from pixels converted to normalized values
+            Vector4 *normalized = NULL;
 
-                    float px = oldX - x1;
-                    float py = oldY - y1;
+            if ((image->format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (image->format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+                (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+            {
+                normalized = (Vector4 *)RL_MALLOC(image->width*image->height*sizeof(Vector4));
+                GetPixelsNormalized(image->data, image->format, 0, image->width*image->height, normalized);
+                rotate.srcNormalized = normalized;
+            }
 
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
+            rotate.dst = (unsigned char *)RL_CALLOC(rotate.width*rotate.height, rotate.bytesPerPixel);
 
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+            ProcessImageRows(rotate.width, rotate.height, RotateSampledRange, &rotate);
 
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
-                    }
-                }
-            }
+            RL_FREE(normalized);
         }
 
         RL_FREE(image->data);
-        image->data = rotatedData;
-        image->width = width;
-        image->height = height;
+        image->data = rotate.dst;
+        image->width = rotate.width;
+        image->height = rotate.height;
     }
 }
 
 // Rotate image clockwise 90deg
 void ImageRotateCW(Image *image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
-
-        image->width = height;
-        image->height = width;
-    }
+    ImageRotateEx(image, 90.0f, false);
 }
 
 // Rotate image counter-clockwise 90deg
 void ImageRotateCCW(Image *image)
+{
+    ImageRotateEx(image, -90.0f, false);
+}
+
+// Apply a chain of pixel operations to image in a single pass
+// NOTE: Consecutive per-channel operations (tint, invert, contrast, brightness) are merged into one lookup table,
+// image is processed in rows bands (split across job workers for large images) and pixels batches,
+// all operations are applied to every batch while it is in cache
+void ImageProcess(Image *image, const ImageProcessOp *ops, int count)
 {
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (ops == NULL) || (count <= 0)) return;
 
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
-            }
-        }
+        TRACELOG(LOG_WARNING, "IMAGE: Pixel data processing not supported for compressed image formats");
+        return;
+    }
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
+    ImageViewProcess(GetImageView(*image), ops, count);
 
-        image->width = height;
-        image->height = width;
+    // In case image had mipmaps, regenerate mipmaps from processed image
+    if (image->mipmaps > 1)
+    {
+        image->mipmaps = 1;
+        ImageMipmaps(image);
     }
 }
 
 // Modify image color: tint
 void ImageColorTint(Image *image, Color color)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
-
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
+    ImageProcessOp op = { IMAGE_PROCESS_TINT, 0.0f, color, { 0 } };
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageProcess(image, &op, 1);
 }
 
 // Modify image color: invert
 void ImageColorInvert(Image *image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        pixels[i].r = 255 - pixels[i].r;
-        pixels[i].g = 255 - pixels[i].g;
-        pixels[i].b = 255 - pixels[i].b;
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    ImageProcessOp op = { IMAGE_PROCESS_INVERT, 0.0f, { 0 }, { 0 } };
 
-    ImageFormat(image, format);
+    ImageProcess(image, &op, 1);
 }
 
 // Modify image color: grayscale
@@ -2911,286 +3557,84 @@ void ImageColorGrayscale(Image *image)
 // NOTE: Contrast values between -100 and 100
 void ImageColorContrast(Image *image, float contrast)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (contrast < -100) contrast = -100;
-    if (contrast > 100) contrast = 100;
-
-    contrast = (100.0f + contrast)/100.0f;
-    contrast *= contrast;
+    ImageProcessOp op = { IMAGE_PROCESS_CONTRAST, contrast, { 0 }, { 0 } };
 
-    Color *pixels = LoadImageColors(*image);
+    ImageProcess(image, &op, 1);
+}
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
-
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
-    }
+// Modify image color: brightness
+// NOTE: Brightness values between -255 and 255
+void ImageColorBrightness(Image *image, int brightness)
+{
+    ImageProcessOp op = { IMAGE_PROCESS_BRIGHTNESS, (float)brightness, { 0 }, { 0 } };
 
-    int format = image->format;
-    RL_FREE(image->data);
+    ImageProcess(image, &op, 1);
+}
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+// Modify image color: replace color
+void ImageColorReplace(Image *image, Color color, Color replace)
+{
+    ImageProcessOp op = { IMAGE_PROCESS_REPLACE, 0.0f, color, replace };
 
-    ImageFormat(image, format);
+    ImageProcess(image, &op, 1);
 }
 
-// Modify image color: brightness
-// NOTE: Brightness values between -255 and 255
-void ImageColorBrightness(Image *image, int brightness)
+// Modify image color: quantize to best colors palette (median cut)
+// NOTE: Floyd-Steinberg dithering is optional, image format is kept
+void ImageColorQuantize(Image *image, int maxColors, bool dither)
 {
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (maxColors < 1)) return;
 
-    if (brightness < -255) brightness = -255;
-    if (brightness > 255) brightness = 255;
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be quantized");
+        return;
+    }
 
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "IMAGE: Color quantization only applied to base mipmap level");
+
+    int pixelCount = image->width*image->height;
     Color *pixels = LoadImageColors(*image);
+    ColorHistogram histogram = LoadColorHistogram(pixels, pixelCount, false);
 
-    for (int i = 0; i < image->width*image->height; i++)
+    // NOTE: Image is not modified if its colors already fit in palette
+    if (histogram.count > maxColors)
     {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
+        Color *palette = (Color *)RL_MALLOC(maxColors*sizeof(Color));
+        int paletteCount = QuantizePalette(histogram.entries, histogram.count, maxColors, palette);
+
+        MapPaletteColors(pixels, image->width, image->height, palette, paletteCount, dither, NULL, pixels);
+        SetPixelsColor(image->data, pixels, pixelCount, image->format);
 
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
+        RL_FREE(palette);
+    }
 
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
+    UnloadColorHistogram(histogram);
+    UnloadImageColors(pixels);
+}
 
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
+#endif      // SUPPORT_IMAGE_MANIPULATION
 
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
-    }
+// Load color data from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImageColors();
+Color *LoadImageColors(Image image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL;
 
-    int format = image->format;
-    RL_FREE(image->data);
+    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    CopyImageColors(image, pixels);
 
-    ImageFormat(image, format);
-}
-
-// Modify image color: replace color
-void ImageColorReplace(Image *image, Color color, Color replace)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        if ((pixels[i].r == color.r) &&
-            (pixels[i].g == color.g) &&
-            (pixels[i].b == color.b) &&
-            (pixels[i].a == color.a))
-        {
-            pixels[i].r = replace.r;
-            pixels[i].g = replace.g;
-            pixels[i].b = replace.b;
-            pixels[i].a = replace.a;
-        }
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
-}
-#endif      // SUPPORT_IMAGE_MANIPULATION
-
-// Load color data from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImageColors();
-Color *LoadImageColors(Image image)
-{
-    if ((image.width == 0) || (image.height == 0)) return NULL;
-
-    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
-
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
-
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
-
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
-
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
-
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
-    }
-
-    return pixels;
+    return pixels;
 }
 
 // Load colors palette from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImagePalette()
+// NOTE 1: Memory allocated should be freed using UnloadImagePalette()
+// NOTE 2: Transparent pixels are not considered, colors are in first appearance order,
+// if image has more colors than maxPaletteSize, best colors are quantized from image colors (median cut)
 Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
-
     int palCount = 0;
     Color *palette = NULL;
     Color *pixels = LoadImageColors(image);
@@ -3201,38 +3645,20 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 
         for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
-        for (int i = 0; i < image.width*image.height; i++)
-        {
-            if (pixels[i].a > 0)
-            {
-                bool colorInPalette = false;
-
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
-                {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
-                }
-
-                // Store color if not on the palette
-                if (!colorInPalette)
-                {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+        ColorHistogram histogram = LoadColorHistogram(pixels, image.width*image.height, true);
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
-                    {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
-                    }
-                }
-            }
+        if (histogram.count <= maxPaletteSize)
+        {
+            for (int i = 0; i < histogram.count; i++) palette[i] = histogram.entries[i].color;
+            palCount = histogram.count;
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors (%i colors), palette quantized", maxPaletteSize, histogram.count);
+            palCount = QuantizePalette(histogram.entries, histogram.count, maxPaletteSize, palette);
         }
 
+        UnloadColorHistogram(histogram);
         UnloadImageColors(pixels);
     }
 
@@ -3422,2195 +3848,7804 @@ Color GetImageColor(Image image, int x, int y)
 }
 
 //------------------------------------------------------------------------------------
-// Image drawing functions
+// Image views functions
 //------------------------------------------------------------------------------------
-// Clear image background with given color
-void ImageClearBackground(Image *dst, Color color)
+// Get view of full image pixel data
+// NOTE: Only base mipmap level is referenced, compressed formats are not supported (empty view)
+ImageView GetImageView(Image image)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
-
-    // Fill in first pixel based on image format
-    ImageDrawPixel(dst, 0, 0, color);
+    ImageView view = { 0 };
 
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    if ((image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return view;
 
-    // Repeat the first pixel data throughout the image
-    for (int i = 1; i < dst->width*dst->height; i++)
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, bytesPerPixel);
+        TRACELOG(LOG_WARNING, "IMAGE: Image view not supported for compressed formats");
+        return view;
     }
+
+    view.data = image.data;
+    view.width = image.width;
+    view.height = image.height;
+    view.stride = GetPixelDataSize(image.width, 1, image.format);
+    view.format = image.format;
+
+    return view;
 }
 
-// Draw pixel within an image
-// NOTE: Compressed image formats not supported
-void ImageDrawPixel(Image *dst, int x, int y, Color color)
+// Get view of a rectangle inside another view
+// NOTE: Rectangle is clamped to view bounds, empty view returned if no pixels are left
+ImageView GetImageViewRec(ImageView view, Rectangle rec)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
+    ImageView result = { 0 };
 
-    switch (dst->format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    if ((view.data == NULL) || (view.width <= 0) || (view.height <= 0)) return result;
 
-            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
+    // Rectangle out-of-bounds security checks
+    if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
+    if (rec.y < 0) { rec.height += rec.y; rec.y = 0; }
+    if ((rec.x + rec.width) > view.width) rec.width = view.width - rec.x;
+    if ((rec.y + rec.height) > view.height) rec.height = view.height - rec.y;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    if (((int)rec.width <= 0) || ((int)rec.height <= 0)) return result;
 
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+    result.data = (unsigned char *)view.data + (int)rec.y*view.stride + (int)rec.x*GetPixelDataSize(1, 1, view.format);
+    result.width = (int)rec.width;
+    result.height = (int)rec.height;
+    result.stride = view.stride;
+    result.format = view.format;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    return result;
+}
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+// Create an image from view pixel data, rows packed into a new image
+Image ImageFromView(ImageView view)
+{
+    Image image = { 0 };
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+    if ((view.data == NULL) || (view.width <= 0) || (view.height <= 0)) return image;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    int rowSize = GetPixelDataSize(view.width, 1, view.format);
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+    image.data = RL_MALLOC(rowSize*view.height);
+    image.width = view.width;
+    image.height = view.height;
+    image.mipmaps = 1;
+    image.format = view.format;
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+    if (view.stride == rowSize) memcpy(image.data, view.data, rowSize*view.height);
+    else
+    {
+        for (int y = 0; y < view.height; y++) memcpy((unsigned char *)image.data + y*rowSize, (unsigned char *)view.data + y*view.stride, rowSize);
+    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    return image;
+}
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+// Copy view pixels into another view
+// NOTE: Copied size is the intersection of both views sizes, pixels are converted if formats differ
+void ImageViewCopy(ImageView dst, ImageView src)
+{
+    if ((dst.data == NULL) || (src.data == NULL)) return;
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+    int width = (src.width < dst.width)? src.width : dst.width;
+    int height = (src.height < dst.height)? src.height : dst.height;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
+    if ((width <= 0) || (height <= 0)) return;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
+    if (src.format == dst.format)
+    {
+        int rowSize = GetPixelDataSize(width, 1, src.format);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
+        for (int y = 0; y < height; y++) memcpy((unsigned char *)dst.data + y*dst.stride, (unsigned char *)src.data + y*src.stride, rowSize);
+    }
+    else
+    {
+        Vector4 normalized[IMAGE_PROCESS_BATCH_PIXELS];
+
+        for (int y = 0; y < height; y++)
         {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            const unsigned char *srcRow = (const unsigned char *)src.data + y*src.stride;
+            unsigned char *dstRow = (unsigned char *)dst.data + y*dst.stride;
 
-            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+            if (ConvertPixelsDirect(srcRow, src.format, dstRow, dst.format, 0, width)) continue;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            for (int x = 0; x < width; x += IMAGE_PROCESS_BATCH_PIXELS)
+            {
+                int batchCount = ((width - x) < IMAGE_PROCESS_BATCH_PIXELS)? (width - x) : IMAGE_PROCESS_BATCH_PIXELS;
 
-            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+                GetPixelsNormalized(srcRow, src.format, x, batchCount, normalized);
+                SetPixelsNormalized(dstRow, dst.format, x, batchCount, normalized);
+            }
+        }
+    }
+}
 
-            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
+// Clear view pixels with given color
+void ImageViewClearBackground(ImageView dst, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst.data == NULL) || (dst.width <= 0) || (dst.height <= 0)) return;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    // Fill in first pixel based on view format
+    Image pixel = { dst.data, 1, 1, 1, dst.format };
+    ImageDrawPixel(&pixel, 0, 0, color);
 
-            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+    unsigned char *row = (unsigned char *)dst.data;
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst.format);
+    int rowSize = dst.width*bytesPerPixel;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+    // Repeat the first pixel data throughout the first row, doubling the copied size
+    for (int size = bytesPerPixel; size < rowSize; size *= 2)
+    {
+        memcpy(row + size, row, ((rowSize - size) < size)? (rowSize - size) : size);
+    }
+
+    // Repeat the first row data for all other rows
+    for (int y = 1; y < dst.height; y++) memcpy(row + y*dst.stride, row, rowSize);
+}
+
+// Apply a chain of pixel operations to view pixels in a single pass
+// NOTE: Same processing than ImageProcess(), rows are addressed with view stride
+void ImageViewProcess(ImageView view, const ImageProcessOp *ops, int count)
+{
+    // Security check to avoid program crash
+    if ((view.data == NULL) || (view.width <= 0) || (view.height <= 0) || (ops == NULL) || (count <= 0)) return;
+
+    if ((view.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+        (view.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+        (view.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+
+    if ((view.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+        (view.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
+        (view.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+
+    ImageProcessStage *stages = (ImageProcessStage *)RL_MALLOC(count*sizeof(ImageProcessStage));
+    int stageCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const ImageProcessOp *op = &ops[i];
+
+        if ((op->type == IMAGE_PROCESS_TINT) || (op->type == IMAGE_PROCESS_INVERT) ||
+            (op->type == IMAGE_PROCESS_CONTRAST) || (op->type == IMAGE_PROCESS_BRIGHTNESS))
         {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            // Start a new lookup table stage (identity) if previous stage is not a lookup table
+            if ((stageCount == 0) || (stages[stageCount - 1].op != NULL))
+            {
+                stages[stageCount].op = NULL;
+                for (int c = 0; c < 4; c++) for (int v = 0; v < 256; v++) stages[stageCount].table[c][v] = (unsigned char)v;
+                stageCount++;
+            }
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            unsigned char (*table)[256] = stages[stageCount - 1].table;
+
+            switch (op->type)
+            {
+                case IMAGE_PROCESS_TINT:
+                {
+                    const unsigned char tint[4] = { op->color.r, op->color.g, op->color.b, op->color.a };
+
+                    for (int c = 0; c < 4; c++) for (int v = 0; v < 256; v++) table[c][v] = (unsigned char)(((int)table[c][v]*(int)tint[c])/255);
+
+                } break;
+                case IMAGE_PROCESS_INVERT:
+                {
+                    for (int c = 0; c < 3; c++) for (int v = 0; v < 256; v++) table[c][v] = 255 - table[c][v];
+
+                } break;
+                case IMAGE_PROCESS_CONTRAST:
+                {
+                    float contrast = op->value;
+
+                    if (contrast < -100) contrast = -100;
+                    if (contrast > 100) contrast = 100;
+
+                    contrast = (100.0f + contrast)/100.0f;
+                    contrast *= contrast;
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        for (int v = 0; v < 256; v++)
+                        {
+                            float p = (float)table[c][v]/255.0f;
+                            p -= 0.5f;
+                            p *= contrast;
+                            p += 0.5f;
+                            p *= 255;
+                            if (p < 0) p = 0;
+                            if (p > 255) p = 255;
+
+                            table[c][v] = (unsigned char)p;
+                        }
+                    }
+                } break;
+                case IMAGE_PROCESS_BRIGHTNESS:
+                {
+                    int brightness = (int)op->value;
+
+                    if (brightness < -255) brightness = -255;
+                    if (brightness > 255) brightness = 255;
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        for (int v = 0; v < 256; v++)
+                        {
+                            int p = table[c][v] + brightness;
+
+                            if (p < 0) p = 1;
+                            if (p > 255) p = 255;
+
+                            table[c][v] = (unsigned char)p;
+                        }
+                    }
+                } break;
+                default: break;
+            }
+        }
+        else if ((op->type == IMAGE_PROCESS_GRAYSCALE) || (op->type == IMAGE_PROCESS_REPLACE) || (op->type == IMAGE_PROCESS_ALPHA_PREMULTIPLY))
         {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            stages[stageCount].op = op;
+            stageCount++;
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Process operation type not supported [%i]", op->type);
+    }
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
+    if (stageCount > 0)
+    {
+        ImageProcessData process = { (unsigned char *)view.data, view.format, view.width, view.stride, stages, stageCount };
 
-        } break;
-        default: break;
+        // Large views are split in rows bands, processed in parallel by job workers
+        ProcessImageRows(view.width, view.height, ProcessPixelsRange, &process);
     }
-}
 
-// Draw pixel within an image (Vector version)
-void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
-{
-    ImageDrawPixel(dst, (int)position.x, (int)position.y, color);
+    RL_FREE(stages);
 }
 
-// Draw line within an image
-void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
+// Draw a source view within a destination view with blend mode
+// NOTE: Source view is resized to dstRec size if required, supported blend modes: BLEND_ALPHA and BLEND_ALPHA_PREMULTIPLY
+void ImageViewDraw(ImageView dst, ImageView src, Rectangle dstRec, Color tint, int blendMode)
 {
-    // Calculate differences in coordinates
-    int shortLen = endPosY - startPosY;
-    int longLen = endPosX - startPosX;
-    bool yLonger = false;
+    // Security check to avoid program crash
+    if ((dst.data == NULL) || (dst.width <= 0) || (dst.height <= 0) ||
+        (src.data == NULL) || (src.width <= 0) || (src.height <= 0)) return;
 
-    // Determine if the line is more vertical than horizontal
-    if (abs(shortLen) > abs(longLen))
+    if ((blendMode != BLEND_ALPHA) && (blendMode != BLEND_ALPHA_PREMULTIPLY))
     {
-        // Swap the lengths if the line is more vertical
-        int temp = shortLen;
-        shortLen = longLen;
-        longLen = temp;
-        yLonger = true;
+        TRACELOG(LOG_WARNING, "IMAGE: Blend mode not supported for image drawing, BLEND_ALPHA used");
+        blendMode = BLEND_ALPHA;
     }
 
-    // Initialize variables for drawing loop
-    int endVal = longLen;
-    int sgnInc = 1;
+    Rectangle srcRec = { 0, 0, (float)src.width, (float)src.height };
+    Rectangle resizeRec = { 0 };    // Source rectangle to resize (in case it was required)
+    bool resizeRequired = false;    // Track source resize required
 
-    // Adjust direction increment based on longLen sign
-    if (longLen < 0)
+    // Check if source rectangle needs to be resized to destination rectangle
+    // In that case, source rectangle is resampled while drawing, from here srcRec is defined in resized space
+    if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
     {
-        longLen = -longLen;
-        sgnInc = -1;
-    }
+        if (((int)srcRec.width <= 0) || ((int)srcRec.height <= 0) || ((int)dstRec.width <= 0) || ((int)dstRec.height <= 0)) return;
 
-    // Calculate fixed-point increment for shorter length
-    int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
+        resizeRec = srcRec;
+        srcRec = (Rectangle){ 0, 0, (float)((int)dstRec.width), (float)((int)dstRec.height) };
+        resizeRequired = true;
+    }
 
-    // Draw the line pixel by pixel
-    if (yLonger)
+    // Destination rectangle out-of-bounds security checks
+    if (dstRec.x < 0)
     {
-        // If line is more vertical, iterate over y-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + (j >> 16), startPosY + i, color);
-        }
+        srcRec.x -= dstRec.x;
+        srcRec.width += dstRec.x;
+        dstRec.x = 0;
     }
-    else
+    else if ((dstRec.x + srcRec.width) > dst.width) srcRec.width = dst.width - dstRec.x;
+
+    if (dstRec.y < 0)
     {
-        // If line is more horizontal, iterate over x-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + i, startPosY + (j >> 16), color);
-        }
+        srcRec.y -= dstRec.y;
+        srcRec.height += dstRec.y;
+        dstRec.y = 0;
     }
-}
+    else if ((dstRec.y + srcRec.height) > dst.height) srcRec.height = dst.height - dstRec.y;
 
-// Draw line within an image (Vector version)
-void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
-{
-    // Round start and end positions to nearest integer coordinates
-    int x1 = (int)(start.x + 0.5f);
-    int y1 = (int)(start.y + 0.5f);
-    int x2 = (int)(end.x + 0.5f);
-    int y2 = (int)(end.y + 0.5f);
+    if (dst.width < srcRec.width) srcRec.width = (float)dst.width;
+    if (dst.height < srcRec.height) srcRec.height = (float)dst.height;
 
-    // Draw a vertical line using ImageDrawLine function
-    ImageDrawLine(dst, x1, y1, x2, y2, color);
-}
+    if (((int)srcRec.width <= 0) || ((int)srcRec.height <= 0)) return;
 
-// Draw a line defining thickness within an image
-void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color color)
-{
-    // Round start and end positions to nearest integer coordinates
-    int x1 = (int)(start.x + 0.5f);
-    int y1 = (int)(start.y + 0.5f);
-    int x2 = (int)(end.x + 0.5f);
-    int y2 = (int)(end.y + 0.5f);
+    // Blitting is processed by rows, specialized by format and blend mode:
+    //    [x] Same src/dst format with no alpha blending required -> direct line copy
+    //    [x] R8G8B8A8 src/dst pixels blended in place, other formats converted by batches
+    //    [x] Alpha blending vectorized (SSE2/NEON) for opaque destination pixels
+    //    [x] Resized source is resampled by rows directly into destination (no intermediate image)
+    //    [ ] Support f32bit channels drawing
 
-    // Calculate differences in x and y coordinates
-    int dx = x2 - x1;
-    int dy = y2 - y1;
+    // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and 16-bit equivalents
 
-    // Draw the main line between (x1, y1) and (x2, y2)
-    ImageDrawLine(dst, x1, y1, x2, y2, color);
+    ImageDrawData drawData = { 0 };
+    drawData.dstStride = dst.stride;
+    drawData.dstFormat = dst.format;
+    drawData.dst = (unsigned char *)dst.data + (int)dstRec.y*dst.stride + (int)dstRec.x*GetPixelDataSize(1, 1, dst.format);
+    drawData.srcStride = src.stride;
+    drawData.srcBytesPerPixel = GetPixelDataSize(1, 1, src.format);
+    drawData.srcFormat = src.format;
+    drawData.rowFormat = src.format;
+    drawData.tint = tint;
+    drawData.blendMode = blendMode;
 
-    // Determine if the line is more horizontal or vertical
-    if (dx != 0 && abs(dy/dx) < 1)
+    if (resizeRequired)
     {
-        // Line is more horizontal
-        // Calculate half the width of the line
-        int wy = (thick - 1)*(int)sqrtf((float)(dx*dx + dy*dy))/(2*abs(dx));
+        int layout = 0;
 
-        // Draw additional lines above and below the main line
-        for (int i = 1; i <= wy; i++)
+        switch (src.format)
         {
-            ImageDrawLine(dst, x1, y1 - i, x2, y2 - i, color); // Draw above the main line
-            ImageDrawLine(dst, x1, y1 + i, x2, y2 + i, color); // Draw below the main line
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: layout = 1; break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: layout = 2; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: layout = 3; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: layout = 4; break;
+            default: break;
         }
-    }
-    else if (dy != 0)
-    {
-        // Line is more vertical or perfectly horizontal
-        // Calculate half the width of the line
-        int wx = (thick - 1)*(int)sqrtf((float)(dx*dx + dy*dy))/(2*abs(dy));
 
-        // Draw additional lines to the left and right of the main line
-        for (int i = 1; i <= wx; i++)
+        // NOTE: Formats not supported by resizer are converted to R8G8B8A8 by input rows, resampled colors
+        // are drawn without being quantized back to source format (i.e. R5G5B5A1 source keeps 8-bit alpha)
+        if (layout == 0)
         {
-            ImageDrawLine(dst, x1 - i, y1, x2 - i, y2, color); // Draw left of the main line
-            ImageDrawLine(dst, x1 + i, y1, x2 + i, y2, color); // Draw right of the main line
+            layout = 4;
+            drawData.rowFormat = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
         }
-    }
-}
 
-// Draw circle within an image
-void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color color)
-{
-    int x = 0;
-    int y = radius;
-    int decesionParameter = 3 - 2*radius;
+        drawData.src = (const unsigned char *)src.data;
 
-    while (y >= x)
+        int newWidth = (int)dstRec.width;
+        int newHeight = (int)dstRec.height;
+        drawData.visibleRec = srcRec;
+
+        // NOTE: Full source rectangle is resized, rows are drawn by output callback (rows out of visible region skipped)
+        // WARNING: stb_image_resize2 v2.10 output callback encodes rows in place, corrupting rows of less than
+        // 32 channel values (SIMD tail processing), those narrow images are resized into temporary memory
+        // NOTE: stbir_set_pixel_subrect() is also avoided, it fails on some scaling ratios
+        unsigned char *resized = NULL;
+        if ((newWidth*layout) < 32) resized = (unsigned char *)RL_TEMP_ALLOC(newWidth*newHeight*layout);
+
+        STBIR_RESIZE resize = { 0 };
+        stbir_resize_init(&resize, drawData.src, (int)resizeRec.width, (int)resizeRec.height, drawData.srcStride,
+            resized, newWidth, newHeight, 0, (stbir_pixel_layout)layout, STBIR_TYPE_UINT8);
+        stbir_set_user_data(&resize, &drawData);
+        stbir_set_pixel_callbacks(&resize, (drawData.rowFormat != drawData.srcFormat)? ImageDrawResizeInput : NULL, (resized == NULL)? ImageDrawResizeOutput : NULL);
+
+        if (!stbir_resize_extended(&resize)) TRACELOG(LOG_WARNING, "IMAGE: Failed to resize source image for drawing");
+        else if (resized != NULL)
+        {
+            for (int y = 0; y < newHeight; y++) ImageDrawResizeOutput(resized + y*newWidth*layout, newWidth, y, &drawData);
+        }
+
+        if (resized != NULL) RL_TEMP_FREE(resized);
+    }
+    else
     {
-        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
-        x++;
+        drawData.src = (const unsigned char *)src.data + (int)srcRec.y*src.stride + (int)srcRec.x*drawData.srcBytesPerPixel;
 
-        if (decesionParameter > 0)
+        for (int y = 0; y < (int)srcRec.height; y++)
         {
-            y--;
-            decesionParameter = decesionParameter + 4*(x - y) + 10;
+            DrawPixelsRow(drawData.dst + y*drawData.dstStride, drawData.dstFormat, drawData.src + y*drawData.srcStride, drawData.rowFormat, (int)srcRec.width, tint, blendMode);
         }
-        else decesionParameter = decesionParameter + 4*x + 6;
     }
 }
 
-// Draw circle within an image (Vector version)
-void ImageDrawCircleV(Image* dst, Vector2 center, int radius, Color color)
+//------------------------------------------------------------------------------------
+// Image atlas functions
+//------------------------------------------------------------------------------------
+// Generate atlas: images packed into smallest power-of-two image (up to maxSize)
+// NOTE: Images are packed by larger side first with a skyline bottom-left packer, atlas size is grown
+// (width and height doubled alternately) until all images fit, remaining free space can be filled with ImageAtlasAdd()
+ImageAtlas GenImageAtlas(const Image *images, int imageCount, int maxSize, int padding, int flags)
 {
-    ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
-}
+    ImageAtlas atlas = { 0 };
 
-// Draw circle outline within an image
-void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
-{
-    int x = 0;
-    int y = radius;
-    int decesionParameter = 3 - 2*radius;
+    if ((images == NULL) || (imageCount <= 0)) return atlas;
 
-    while (y >= x)
-    {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
-        x++;
-
-        if (decesionParameter > 0)
-        {
-            y--;
-            decesionParameter = decesionParameter + 4*(x - y) + 10;
-        }
-        else decesionParameter = decesionParameter + 4*x + 6;
-    }
-}
+    if (maxSize <= 0) maxSize = IMAGE_ATLAS_MAX_SIZE;
+    if (padding < 0) padding = 0;
 
-// Draw circle outline within an image (Vector version)
-void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color)
-{
-    ImageDrawCircleLines(dst, (int)center.x, (int)center.y, radius, color);
-}
+    bool allowRotation = ((flags & ATLAS_ALLOW_ROTATION) != 0);
+    AtlasEntry *entries = (AtlasEntry *)RL_MALLOC(imageCount*sizeof(AtlasEntry));
+    int entryCount = 0;
+    long long area = 0;
+    int minSize = 1;
 
-// Draw rectangle within an image
-void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color)
-{
-    ImageDrawRectangleRec(dst, (Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
-}
+    atlas.sprites = (AtlasSprite *)RL_CALLOC(imageCount, sizeof(AtlasSprite));
+    atlas.spriteCount = imageCount;
+    atlas.padding = padding;
+    atlas.flags = flags;
 
-// Draw rectangle within an image (Vector version)
-void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color)
-{
-    ImageDrawRectangle(dst, (int)position.x, (int)position.y, (int)size.x, (int)size.y, color);
-}
+    for (int i = 0; i < imageCount; i++)
+    {
+        Rectangle trim = GetAtlasTrimRec(images[i], flags);
 
-// Draw rectangle within an image
-void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
-{
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+        atlas.sprites[i].offset = (Vector2){ trim.x, trim.y };
+        atlas.sprites[i].size = (Vector2){ (float)images[i].width, (float)images[i].height };
 
-    // Security check to avoid drawing out of bounds in case of bad user data
-    if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
-    if (rec.y < 0) { rec.height += rec.y; rec.y = 0; }
-    if (rec.width < 0) rec.width = 0;
-    if (rec.height < 0) rec.height = 0;
+        // NOTE: Empty or fully transparent (trimmed) images are not packed, sprite rectangle is left empty
+        if (((int)trim.width <= 0) || ((int)trim.height <= 0)) continue;
 
-    // Clamp the size the the image bounds
-    if ((rec.x + rec.width) >= dst->width) rec.width = dst->width - rec.x;
-    if ((rec.y + rec.height) >= dst->height) rec.height = dst->height - rec.y;
+        int cellWidth = (int)trim.width + 2*padding;
+        int cellHeight = (int)trim.height + 2*padding;
 
-    // Check if the rect is even inside the image
-    if ((rec.x >= dst->width) || (rec.y >= dst->height)) return;
-    if (((rec.x + rec.width) <= 0) || (rec.y + rec.height <= 0)) return;
+        entries[entryCount].index = i;
+        entries[entryCount].trim = trim;
+        entries[entryCount].maxSide = (cellWidth > cellHeight)? cellWidth : cellHeight;
+        entries[entryCount].minSide = (cellWidth > cellHeight)? cellHeight : cellWidth;
 
-    int sy = (int)rec.y;
-    int sx = (int)rec.x;
+        area += (long long)cellWidth*cellHeight;
+        if (entries[entryCount].maxSide > minSize) minSize = entries[entryCount].maxSide;
+        entryCount++;
+    }
 
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    qsort(entries, entryCount, sizeof(AtlasEntry), CompareAtlasEntries);
 
-    // Fill in the first pixel of the first row based on image format
-    ImageDrawPixel(dst, sx, sy, color);
+    // Initial atlas size: smallest power-of-two size fitting entries area and larger entry (width >= height)
+    int width = 1;
+    while (((width < minSize) || ((long long)width*width < area)) && (width < maxSize)) width *= 2;
+    if (width > maxSize) width = maxSize;
+    int height = width;
+    if (((height/2) >= minSize) && (((long long)width*(height/2)) >= area)) height /= 2;
 
-    int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
-    unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
+    AtlasPacker *packer = NULL;
+    int failedCount = 0;
 
-    // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x++)
+    while (true)
     {
-        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+        RL_FREE(packer);
+        packer = LoadAtlasPacker(width, height);
+        failedCount = 0;
 
-    // Repeat the first row data for all other rows
-    int bytesPerRow = bytesPerPixel*(int)rec.width;
-    for (int y = 1; y < (int)rec.height; y++)
-    {
-        memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
-    }
-}
+        for (int i = 0; i < entryCount; i++)
+        {
+            AtlasSprite *sprite = &atlas.sprites[entries[i].index];
 
-// Draw rectangle lines within an image
-void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
-{
-    ImageDrawRectangle(dst, (int)rec.x, (int)rec.y, (int)rec.width, thick, color);
-    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
-    ImageDrawRectangle(dst, (int)(rec.x + rec.width - thick), (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
-    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
-}
+            sprite->rec = (Rectangle){ 0 };
+            sprite->rotated = false;
 
-// Draw triangle within an image
-void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
-{
-    // Calculate the 2D bounding box of the triangle
-    // Determine the minimum and maximum x and y coordinates of the triangle vertices
-    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
-    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
-    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
-    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
+            if (!PackAtlasSprite(packer, entries[i].trim, padding, allowRotation, sprite)) failedCount++;
+        }
 
-    // Clamp the bounding box to the image dimensions
-    if (xMin < 0) xMin = 0;
-    if (yMin < 0) yMin = 0;
-    if (xMax > dst->width) xMax = dst->width;
-    if (yMax > dst->height) yMax = dst->height;
+        if (failedCount == 0) break;
 
-    // Check the order of the vertices to determine if it's a front or back face
-    // NOTE: if signedArea is equal to 0, the face is degenerate
-    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
-    bool isBackFace = (signedArea > 0);
+        // Grow atlas, smaller side first
+        if ((height < width) && ((height*2) <= maxSize)) height *= 2;
+        else if ((width*2) <= maxSize) width *= 2;
+        else if ((height*2) <= maxSize) height *= 2;
+        else break;
+    }
 
-    // Barycentric interpolation setup
-    // Calculate the step increments for the barycentric coordinates
-    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
-    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
-    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
+    atlas.image.data = RL_CALLOC(width*height, 4);
+    atlas.image.width = width;
+    atlas.image.height = height;
+    atlas.image.mipmaps = 1;
+    atlas.image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    atlas.packer = packer;
 
-    // If the triangle is a back face, invert the steps
-    if (isBackFace)
+    for (int i = 0; i < entryCount; i++)
     {
-        w1XStep = -w1XStep, w1YStep = -w1YStep;
-        w2XStep = -w2XStep, w2YStep = -w2YStep;
-        w3XStep = -w3XStep, w3YStep = -w3YStep;
-    }
+        AtlasSprite sprite = atlas.sprites[entries[i].index];
 
-    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
-    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
-    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
-    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
+        if (sprite.rec.width > 0) DrawAtlasSprite(&atlas, images[entries[i].index], entries[i].trim, sprite);
+    }
 
-    // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
-    {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+    RL_FREE(entries);
 
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            // If it is then we can draw the pixel with the given color
-            if ((w1 | w2 | w3) >= 0) ImageDrawPixel(dst, x, y, color);
+    if (failedCount > 0) TRACELOG(LOG_WARNING, "IMAGE: Atlas failed to pack %i images, maximum atlas size reached (empty sprites)", failedCount);
 
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+    TRACELOG(LOG_INFO, "IMAGE: Atlas generated successfully (%ix%i | %i images packed)", width, height, entryCount - failedCount);
 
-        // Move to the next row in the bounding box
-        w1Row += w1YStep;
-        w2Row += w2YStep;
-        w3Row += w3YStep;
-    }
+    return atlas;
 }
 
-// Draw triangle with interpolated colors within an image
-void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3)
+// Generate atlas: images loaded from files packed into smallest power-of-two image (up to maxSize)
+// NOTE: Sprites are defined in files order, files failing to load get an empty sprite
+ImageAtlas GenImageAtlasFromFiles(const char **fileNames, int fileCount, int maxSize, int padding, int flags)
 {
-    // Calculate the 2D bounding box of the triangle
-    // Determine the minimum and maximum x and y coordinates of the triangle vertices
-    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
-    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
-    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
-    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
-
-    // Clamp the bounding box to the image dimensions
-    if (xMin < 0) xMin = 0;
-    if (yMin < 0) yMin = 0;
-    if (xMax > dst->width) xMax = dst->width;
-    if (yMax > dst->height) yMax = dst->height;
-
-    // Check the order of the vertices to determine if it's a front or back face
-    // NOTE: if signedArea is equal to 0, the face is degenerate
-    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
-    bool isBackFace = (signedArea > 0);
+    ImageAtlas atlas = { 0 };
 
-    // Barycentric interpolation setup
-    // Calculate the step increments for the barycentric coordinates
-    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
-    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
-    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
+    if ((fileNames == NULL) || (fileCount <= 0)) return atlas;
 
-    // If the triangle is a back face, invert the steps
-    if (isBackFace)
-    {
-        w1XStep = -w1XStep, w1YStep = -w1YStep;
-        w2XStep = -w2XStep, w2YStep = -w2YStep;
-        w3XStep = -w3XStep, w3YStep = -w3YStep;
-    }
+    Image *images = (Image *)RL_CALLOC(fileCount, sizeof(Image));
 
-    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
-    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
-    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
-    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
+    for (int i = 0; i < fileCount; i++) images[i] = LoadImage(fileNames[i]);
 
-    // Calculate the inverse of the sum of the barycentric coordinates for normalization
-    // NOTE 1: Here, we act as if we multiply by 255 the reciprocal, which avoids additional
-    //         calculations in the loop. This is acceptable because we are only interpolating colors.
-    // NOTE 2: This sum remains constant throughout the triangle
-    float wInvSum = 255.0f/(w1Row + w2Row + w3Row);
+    atlas = GenImageAtlas(images, fileCount, maxSize, padding, flags);
 
-    // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
-    {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+    for (int i = 0; i < fileCount; i++) UnloadImage(images[i]);
+    RL_FREE(images);
 
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            if ((w1 | w2 | w3) >= 0)
-            {
-                // Compute the normalized barycentric coordinates
-                unsigned char aW1 = (unsigned char)((float)w1*wInvSum);
-                unsigned char aW2 = (unsigned char)((float)w2*wInvSum);
-                unsigned char aW3 = (unsigned char)((float)w3*wInvSum);
+    return atlas;
+}
 
-                // Interpolate the color using the barycentric coordinates
-                Color finalColor = { 0 };
-                finalColor.r = (c1.r*aW1 + c2.r*aW2 + c3.r*aW3)/255;
-                finalColor.g = (c1.g*aW1 + c2.g*aW2 + c3.g*aW3)/255;
-                finalColor.b = (c1.b*aW1 + c2.b*aW2 + c3.b*aW3)/255;
-                finalColor.a = (c1.a*aW1 + c2.a*aW2 + c3.a*aW3)/255;
+// Load empty atlas of given size, images added with ImageAtlasAdd()
+ImageAtlas LoadImageAtlas(int width, int height, int padding, int flags)
+{
+    ImageAtlas atlas = { 0 };
 
-                // Draw the pixel with the interpolated color
-                ImageDrawPixel(dst, x, y, finalColor);
-            }
+    if ((width <= 0) || (height <= 0)) return atlas;
 
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+    atlas.image.data = RL_CALLOC(width*height, 4);
+    atlas.image.width = width;
+    atlas.image.height = height;
+    atlas.image.mipmaps = 1;
+    atlas.image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    atlas.padding = (padding > 0)? padding : 0;
+    atlas.flags = flags;
+    atlas.packer = LoadAtlasPacker(width, height);
 
-        // Move to the next row in the bounding box
-        w1Row += w1YStep;
-        w2Row += w2YStep;
-        w3Row += w3YStep;
-    }
+    return atlas;
 }
 
-// Draw triangle outline within an image
-void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+// Unload atlas image, sprites and packer data
+void UnloadImageAtlas(ImageAtlas atlas)
 {
-    ImageDrawLine(dst, (int)v1.x, (int)v1.y, (int)v2.x, (int)v2.y, color);
-    ImageDrawLine(dst, (int)v2.x, (int)v2.y, (int)v3.x, (int)v3.y, color);
-    ImageDrawLine(dst, (int)v3.x, (int)v3.y, (int)v1.x, (int)v1.y, color);
+    UnloadImage(atlas.image);
+    RL_FREE(atlas.sprites);
+    RL_FREE(atlas.packer);
 }
 
-// Draw a triangle fan defined by points within an image (first vertex is the center)
-void ImageDrawTriangleFan(Image *dst, Vector2 *points, int pointCount, Color color)
+// Add image to atlas free space, returns sprite index (-1 if it does not fit)
+// NOTE: Fully transparent (trimmed) images are added with an empty sprite rectangle
+int ImageAtlasAdd(ImageAtlas *atlas, Image image)
 {
-    if (pointCount >= 3)
+    if ((atlas == NULL) || (atlas->packer == NULL) || (atlas->image.data == NULL)) return -1;
+    if ((image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return -1;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        for (int i = 1; i < pointCount - 1; i++)
-        {
-            ImageDrawTriangle(dst, points[0], points[i], points[i + 1], color);
-        }
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas packing not supported for compressed formats");
+        return -1;
     }
-}
 
-// Draw a triangle strip defined by points within an image
-void ImageDrawTriangleStrip(Image *dst, Vector2 *points, int pointCount, Color color)
-{
-    if (pointCount >= 3)
+    Rectangle trim = GetAtlasTrimRec(image, atlas->flags);
+    AtlasSprite sprite = { 0 };
+
+    sprite.offset = (Vector2){ trim.x, trim.y };
+    sprite.size = (Vector2){ (float)image.width, (float)image.height };
+
+    if (((int)trim.width > 0) && ((int)trim.height > 0))
     {
-        for (int i = 2; i < pointCount; i++)
+        if (!PackAtlasSprite((AtlasPacker *)atlas->packer, trim, atlas->padding, ((atlas->flags & ATLAS_ALLOW_ROTATION) != 0), &sprite))
         {
-            if ((i%2) == 0) ImageDrawTriangle(dst, points[i], points[i - 2], points[i - 1], color);
-            else ImageDrawTriangle(dst, points[i], points[i - 1], points[i - 2], color);
+            TRACELOG(LOG_WARNING, "IMAGE: Atlas failed to add image, not enough free space");
+            return -1;
         }
+
+        DrawAtlasSprite(atlas, image, trim, sprite);
     }
+
+    AtlasSprite *sprites = (AtlasSprite *)RL_REALLOC(atlas->sprites, (atlas->spriteCount + 1)*sizeof(AtlasSprite));
+    if (sprites == NULL) return -1;
+
+    atlas->sprites = sprites;
+    atlas->sprites[atlas->spriteCount] = sprite;
+    atlas->spriteCount++;
+
+    return atlas->spriteCount - 1;
 }
 
-// Draw an image (source) within an image (destination)
-// NOTE: Color tint is applied to source image
-void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+//------------------------------------------------------------------------------------
+// Image drawing functions
+//------------------------------------------------------------------------------------
+// Clear image background with given color
+void ImageClearBackground(Image *dst, Color color)
 {
     // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
-        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    if (dst->mipmaps > 1) TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
-    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
-    else
-    {
-        Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
+    ImageViewClearBackground(GetImageView(*dst), color);
+}
 
-        // Source rectangle out-of-bounds security checks
-        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
-        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
-        if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
-        if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
+// Draw pixel within an image
+// NOTE: Compressed image formats not supported
+void ImageDrawPixel(Image *dst, int x, int y, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
 
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, we make a copy of source, and we apply all required transform
-        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
+    switch (dst->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
         {
-            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
 
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
+            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
 
-        // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
         {
-            srcRec.x -= dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
-        }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
 
-        if (dstRec.y < 0)
+            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
         {
-            srcRec.y -= dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
-        }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
 
-        // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
-        // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
-        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
-        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
-        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
-        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
 
-        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and 16-bit equivalents
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-        Color colSrc, colDst, blend;
-        bool blendRequired = true;
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
 
-        for (int y = 0; y < (int)srcRec.height; y++)
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
         {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
 
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-                    SetPixelColor(pDst, blend, dst->format);
+            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
 
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
-        }
+            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
+            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
+            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
-    }
-}
+            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
 
-// Draw text (default font) within an image (destination)
-void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
-{
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
-    // Make sure default font is loaded to be used on image text drawing
-    if (GetFontDefault().texture.id == 0) LoadFontDefault();
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-    Vector2 position = { (float)posX, (float)posY };
-    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, 1.0f, color);   // WARNING: Module required: rtext
-#else
-    TRACELOG(LOG_WARNING, "IMAGE: ImageDrawText() requires module: rtext");
-#endif
-}
+            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
 
-// Draw text (custom sprite font) within an image (destination)
-void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
-{
-    Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
-    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
 
-    UnloadImage(imText);
+        } break;
+        default: break;
+    }
 }
 
-//------------------------------------------------------------------------------------
-// Texture loading functions
-//------------------------------------------------------------------------------------
-// Load texture from file into GPU memory (VRAM)
-Texture2D LoadTexture(const char *fileName)
+// Draw pixel within an image (Vector version)
+void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
 {
-    Texture2D texture = { 0 };
-
-    Image image = LoadImage(fileName);
-
-    if (image.data != NULL)
-    {
-        texture = LoadTextureFromImage(image);
-        UnloadImage(image);
-    }
-
-    return texture;
+    ImageDrawPixel(dst, (int)position.x, (int)position.y, color);
 }
 
-// Load a texture from image data
-// NOTE: image is not unloaded, it must be done manually
-Texture2D LoadTextureFromImage(Image image)
+// Draw line within an image
+void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
-    Texture2D texture = { 0 };
+    // Calculate differences in coordinates
+    int shortLen = endPosY - startPosY;
+    int longLen = endPosX - startPosX;
+    bool yLonger = false;
 
-    if ((image.width != 0) && (image.height != 0))
+    // Determine if the line is more vertical than horizontal
+    if (abs(shortLen) > abs(longLen))
     {
-        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+        // Swap the lengths if the line is more vertical
+        int temp = shortLen;
+        shortLen = longLen;
+        longLen = temp;
+        yLonger = true;
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
 
-    texture.width = image.width;
-    texture.height = image.height;
-    texture.mipmaps = image.mipmaps;
-    texture.format = image.format;
+    // Initialize variables for drawing loop
+    int endVal = longLen;
+    int sgnInc = 1;
 
-    return texture;
-}
+    // Adjust direction increment based on longLen sign
+    if (longLen < 0)
+    {
+        longLen = -longLen;
+        sgnInc = -1;
+    }
 
-// Load cubemap from image, multiple image cubemap layouts supported
-TextureCubemap LoadTextureCubemap(Image image, int layout)
-{
-    TextureCubemap cubemap = { 0 };
+    // Calculate fixed-point increment for shorter length
+    int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
 
-    if (layout == CUBEMAP_LAYOUT_AUTO_DETECT)      // Try to automatically guess layout type
+    // Draw the line pixel by pixel
+    if (yLonger)
     {
-        // Check image width/height to determine the type of cubemap provided
-        if (image.width > image.height)
-        {
-            if ((image.width/6) == image.height) { layout = CUBEMAP_LAYOUT_LINE_HORIZONTAL; cubemap.width = image.width/6; }
-            else if ((image.width/4) == (image.height/3)) { layout = CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
-            else if (image.width >= (int)((float)image.height*1.85f)) { layout = CUBEMAP_LAYOUT_PANORAMA; cubemap.width = image.width/4; }
-        }
-        else if (image.height > image.width)
+        // If line is more vertical, iterate over y-axis
+        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
         {
-            if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
-            else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+            // Calculate pixel position and draw it
+            ImageDrawPixel(dst, startPosX + (j >> 16), startPosY + i, color);
         }
     }
     else
     {
-        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL) cubemap.width = image.height/6;
-        if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) cubemap.width = image.width/6;
-        if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR) cubemap.width = image.width/3;
-        if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE) cubemap.width = image.width/4;
-        if (layout == CUBEMAP_LAYOUT_PANORAMA) cubemap.width = image.width/4;
+        // If line is more horizontal, iterate over x-axis
+        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
+        {
+            // Calculate pixel position and draw it
+            ImageDrawPixel(dst, startPosX + i, startPosY + (j >> 16), color);
+        }
     }
+}
 
-    cubemap.height = cubemap.width;
+// Draw line within an image (Vector version)
+void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
+{
+    // Round start and end positions to nearest integer coordinates
+    int x1 = (int)(start.x + 0.5f);
+    int y1 = (int)(start.y + 0.5f);
+    int x2 = (int)(end.x + 0.5f);
+    int y2 = (int)(end.y + 0.5f);
 
-    // Layout provided or already auto-detected
-    if (layout != CUBEMAP_LAYOUT_AUTO_DETECT)
-    {
-        int size = cubemap.width;
+    // Draw a vertical line using ImageDrawLine function
+    ImageDrawLine(dst, x1, y1, x2, y2, color);
+}
 
-        Image faces = { 0 };                // Vertical column image
-        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
+// Draw a line defining thickness within an image
+void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color color)
+{
+    // Round start and end positions to nearest integer coordinates
+    int x1 = (int)(start.x + 0.5f);
+    int y1 = (int)(start.y + 0.5f);
+    int x2 = (int)(end.x + 0.5f);
+    int y2 = (int)(end.y + 0.5f);
 
-        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, (float)size, (float)size };
+    // Calculate differences in x and y coordinates
+    int dx = x2 - x1;
+    int dy = y2 - y1;
 
-        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL)
+    // Draw the main line between (x1, y1) and (x2, y2)
+    ImageDrawLine(dst, x1, y1, x2, y2, color);
+
+    // Determine if the line is more horizontal or vertical
+    if (dx != 0 && abs(dy/dx) < 1)
+    {
+        // Line is more horizontal
+        // Calculate half the width of the line
+        int wy = (thick - 1)*(int)sqrtf((float)(dx*dx + dy*dy))/(2*abs(dx));
+
+        // Draw additional lines above and below the main line
+        for (int i = 1; i <= wy; i++)
         {
-            faces = ImageCopy(image);       // Image data already follows expected convention
+            ImageDrawLine(dst, x1, y1 - i, x2, y2 - i, color); // Draw above the main line
+            ImageDrawLine(dst, x1, y1 + i, x2, y2 + i, color); // Draw below the main line
         }
-        else if (layout == CUBEMAP_LAYOUT_PANORAMA)
-        {
-            // TODO: Convert panorama image to square faces...
-            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
-        }
-        else
-        {
-            if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = (float)size*i;
-            else if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR)
-            {
-                faceRecs[0].x = (float)size; faceRecs[0].y = (float)size;
-                faceRecs[1].x = (float)size; faceRecs[1].y = (float)size*3;
-                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
-                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
-                faceRecs[4].x = 0; faceRecs[4].y = (float)size;
-                faceRecs[5].x = (float)size*2; faceRecs[5].y = (float)size;
-            }
-            else if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE)
-            {
-                faceRecs[0].x = (float)size*2; faceRecs[0].y = (float)size;
-                faceRecs[1].x = 0; faceRecs[1].y = (float)size;
-                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
-                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
-                faceRecs[4].x = (float)size; faceRecs[4].y = (float)size;
-                faceRecs[5].x = (float)size*3; faceRecs[5].y = (float)size;
-            }
-
-            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
-            faces = GenImageColor(size, size*6, MAGENTA);
-            ImageFormat(&faces, image.format);
-
-            // NOTE: Image formatting does not work with compressed textures
-
-            for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
-        }
-
-        // NOTE: Cubemap data is expected to be provided as 6 images in a single data array,
-        // one after the other (that's a vertical image), following convention: +X, -X, +Y, -Y, +Z, -Z
-        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format);
+    }
+    else if (dy != 0)
+    {
+        // Line is more vertical or perfectly horizontal
+        // Calculate half the width of the line
+        int wx = (thick - 1)*(int)sqrtf((float)(dx*dx + dy*dy))/(2*abs(dy));
 
-        if (cubemap.id != 0)
+        // Draw additional lines to the left and right of the main line
+        for (int i = 1; i <= wx; i++)
         {
-            cubemap.format = faces.format;
-            cubemap.mipmaps = 1;
+            ImageDrawLine(dst, x1 - i, y1, x2 - i, y2, color); // Draw left of the main line
+            ImageDrawLine(dst, x1 + i, y1, x2 + i, y2, color); // Draw right of the main line
         }
-        else TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
-
-        UnloadImage(faces);
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
-
-    return cubemap;
 }
 
-// Load texture for rendering (framebuffer)
-// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
-RenderTexture2D LoadRenderTexture(int width, int height)
+// Draw circle within an image
+void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color color)
 {
-    RenderTexture2D target = { 0 };
-
-    target.id = rlLoadFramebuffer(); // Load an empty framebuffer
+    int x = 0;
+    int y = radius;
+    int decesionParameter = 3 - 2*radius;
 
-    if (target.id > 0)
+    while (y >= x)
     {
-        rlEnableFramebuffer(target.id);
-
-        // Create color texture (default to RGBA)
-        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-        target.texture.mipmaps = 1;
-
-        // Create depth renderbuffer/texture
-        target.depth.id = rlLoadTextureDepth(width, height, true);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
-
-        // Attach color texture and depth renderbuffer/texture to FBO
-        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
-        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
-
-        // Check if fbo is complete with attachments (valid)
-        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
+        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
+        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
+        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        x++;
 
-        rlDisableFramebuffer();
+        if (decesionParameter > 0)
+        {
+            y--;
+            decesionParameter = decesionParameter + 4*(x - y) + 10;
+        }
+        else decesionParameter = decesionParameter + 4*x + 6;
     }
-    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
-
-    return target;
 }
 
-// Check if a texture is ready
-bool IsTextureReady(Texture2D texture)
+// Draw circle within an image (Vector version)
+void ImageDrawCircleV(Image* dst, Vector2 center, int radius, Color color)
 {
-    bool result = false;
-
-    // TODO: Validate maximum texture size supported by GPU?
-
-    if ((texture.id > 0) &&         // Validate OpenGL id
-        (texture.width > 0) &&
-        (texture.height > 0) &&     // Validate texture size
-        (texture.format > 0) &&     // Validate texture pixel format
-        (texture.mipmaps > 0)) result = true;     // Validate texture mipmaps (at least 1 for basic mipmap level)
-
-    return result;
+    ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
 }
 
-// Unload texture from GPU memory (VRAM)
-void UnloadTexture(Texture2D texture)
+// Draw circle outline within an image
+void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
 {
-    if (texture.id > 0)
+    int x = 0;
+    int y = radius;
+    int decesionParameter = 3 - 2*radius;
+
+    while (y >= x)
     {
-        rlUnloadTexture(texture.id);
+        ImageDrawPixel(dst, centerX + x, centerY + y, color);
+        ImageDrawPixel(dst, centerX - x, centerY + y, color);
+        ImageDrawPixel(dst, centerX + x, centerY - y, color);
+        ImageDrawPixel(dst, centerX - x, centerY - y, color);
+        ImageDrawPixel(dst, centerX + y, centerY + x, color);
+        ImageDrawPixel(dst, centerX - y, centerY + x, color);
+        ImageDrawPixel(dst, centerX + y, centerY - x, color);
+        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        x++;
 
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+        if (decesionParameter > 0)
+        {
+            y--;
+            decesionParameter = decesionParameter + 4*(x - y) + 10;
+        }
+        else decesionParameter = decesionParameter + 4*x + 6;
     }
 }
 
-// Check if a render texture is ready
-bool IsRenderTextureReady(RenderTexture2D target)
+// Draw circle outline within an image (Vector version)
+void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color)
 {
-    bool result = false;
-
-    if ((target.id > 0) &&                  // Validate OpenGL id
-        IsTextureReady(target.depth) &&     // Validate FBO depth texture/renderbuffer
-        IsTextureReady(target.texture)) result = true;    // Validate FBO texture
-
-    return result;
+    ImageDrawCircleLines(dst, (int)center.x, (int)center.y, radius, color);
 }
 
-// Unload render texture from GPU memory (VRAM)
-void UnloadRenderTexture(RenderTexture2D target)
+// Draw rectangle within an image
+void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color)
 {
-    if (target.id > 0)
-    {
-        if (target.texture.id > 0)
-        {
-            // Color texture attached to FBO is deleted
-            rlUnloadTexture(target.texture.id);
-        }
-
-        // NOTE: Depth texture/renderbuffer is automatically
-        // queried and deleted before deleting framebuffer
-        rlUnloadFramebuffer(target.id);
-    }
+    ImageDrawRectangleRec(dst, (Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
 }
 
-// Update GPU texture with new data
-// NOTE: pixels data must match texture.format
-void UpdateTexture(Texture2D texture, const void *pixels)
+// Draw rectangle within an image (Vector version)
+void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color)
 {
-    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+    ImageDrawRectangle(dst, (int)position.x, (int)position.y, (int)size.x, (int)size.y, color);
 }
 
-// Update GPU texture rectangle with new data
-// NOTE: pixels data must match texture.format
-void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+// Draw rectangle within an image
+void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
 {
-    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    // NOTE: Rectangle is clamped to image bounds by view, out of bounds rectangle gives an empty view
+    ImageViewClearBackground(GetImageViewRec(GetImageView(*dst), rec), color);
 }
 
-//------------------------------------------------------------------------------------
-// Texture configuration functions
-//------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void GenTextureMipmaps(Texture2D *texture)
+// Draw rectangle lines within an image
+void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
 {
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+    ImageDrawRectangle(dst, (int)rec.x, (int)rec.y, (int)rec.width, thick, color);
+    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
+    ImageDrawRectangle(dst, (int)(rec.x + rec.width - thick), (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
+    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
 }
 
-// Set texture scaling filter mode
-void SetTextureFilter(Texture2D texture, int filter)
+// Draw triangle within an image
+void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
-    switch (filter)
-    {
-        case TEXTURE_FILTER_POINT:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+    // Calculate the 2D bounding box of the triangle
+    // Determine the minimum and maximum x and y coordinates of the triangle vertices
+    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
+    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
+    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
+    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
 
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-        } break;
-        case TEXTURE_FILTER_BILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+    // Clamp the bounding box to the image dimensions
+    if (xMin < 0) xMin = 0;
+    if (yMin < 0) yMin = 0;
+    if (xMax > dst->width) xMax = dst->width;
+    if (yMax > dst->height) yMax = dst->height;
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_TRILINEAR:
+    // Check the order of the vertices to determine if it's a front or back face
+    // NOTE: if signedArea is equal to 0, the face is degenerate
+    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
+    bool isBackFace = (signedArea > 0);
+
+    // Barycentric interpolation setup
+    // Calculate the step increments for the barycentric coordinates
+    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
+    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
+    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
+
+    // If the triangle is a back face, invert the steps
+    if (isBackFace)
+    {
+        w1XStep = -w1XStep, w1YStep = -w1YStep;
+        w2XStep = -w2XStep, w2YStep = -w2YStep;
+        w3XStep = -w3XStep, w3YStep = -w3YStep;
+    }
+
+    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
+    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
+    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
+    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
+
+    // Rasterization loop
+    // Iterate through each pixel in the bounding box
+    for (int y = yMin; y <= yMax; y++)
+    {
+        int w1 = w1Row;
+        int w2 = w2Row;
+        int w3 = w3Row;
+
+        for (int x = xMin; x <= xMax; x++)
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+            // Check if the pixel is inside the triangle using barycentric coordinates
+            // If it is then we can draw the pixel with the given color
+            if ((w1 | w2 | w3) >= 0) ImageDrawPixel(dst, x, y, color);
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
+            // Increment the barycentric coordinates for the next pixel
+            w1 += w1XStep;
+            w2 += w2XStep;
+            w3 += w3XStep;
+        }
+
+        // Move to the next row in the bounding box
+        w1Row += w1YStep;
+        w2Row += w2YStep;
+        w3Row += w3YStep;
+    }
+}
+
+// Draw triangle with interpolated colors within an image
+void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3)
+{
+    // Calculate the 2D bounding box of the triangle
+    // Determine the minimum and maximum x and y coordinates of the triangle vertices
+    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
+    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
+    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
+    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
+
+    // Clamp the bounding box to the image dimensions
+    if (xMin < 0) xMin = 0;
+    if (yMin < 0) yMin = 0;
+    if (xMax > dst->width) xMax = dst->width;
+    if (yMax > dst->height) yMax = dst->height;
+
+    // Check the order of the vertices to determine if it's a front or back face
+    // NOTE: if signedArea is equal to 0, the face is degenerate
+    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
+    bool isBackFace = (signedArea > 0);
+
+    // Barycentric interpolation setup
+    // Calculate the step increments for the barycentric coordinates
+    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
+    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
+    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
+
+    // If the triangle is a back face, invert the steps
+    if (isBackFace)
+    {
+        w1XStep = -w1XStep, w1YStep = -w1YStep;
+        w2XStep = -w2XStep, w2YStep = -w2YStep;
+        w3XStep = -w3XStep, w3YStep = -w3YStep;
+    }
+
+    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
+    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
+    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
+    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
+
+    // Calculate the inverse of the sum of the barycentric coordinates for normalization
+    // NOTE 1: Here, we act as if we multiply by 255 the reciprocal, which avoids additional
+    //         calculations in the loop. This is acceptable because we are only interpolating colors.
+    // NOTE 2: This sum remains constant throughout the triangle
+    float wInvSum = 255.0f/(w1Row + w2Row + w3Row);
+
+    // Rasterization loop
+    // Iterate through each pixel in the bounding box
+    for (int y = yMin; y <= yMax; y++)
+    {
+        int w1 = w1Row;
+        int w2 = w2Row;
+        int w3 = w3Row;
+
+        for (int x = xMin; x <= xMax; x++)
+        {
+            // Check if the pixel is inside the triangle using barycentric coordinates
+            if ((w1 | w2 | w3) >= 0)
             {
-                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+                // Compute the normalized barycentric coordinates
+                unsigned char aW1 = (unsigned char)((float)w1*wInvSum);
+                unsigned char aW2 = (unsigned char)((float)w2*wInvSum);
+                unsigned char aW3 = (unsigned char)((float)w3*wInvSum);
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                // Interpolate the color using the barycentric coordinates
+                Color finalColor = { 0 };
+                finalColor.r = (c1.r*aW1 + c2.r*aW2 + c3.r*aW3)/255;
+                finalColor.g = (c1.g*aW1 + c2.g*aW2 + c3.g*aW3)/255;
+                finalColor.b = (c1.b*aW1 + c2.b*aW2 + c3.b*aW3)/255;
+                finalColor.a = (c1.a*aW1 + c2.a*aW2 + c3.a*aW3)/255;
+
+                // Draw the pixel with the interpolated color
+                ImageDrawPixel(dst, x, y, finalColor);
             }
-        } break;
-        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
-        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
-        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
-        default: break;
+
+            // Increment the barycentric coordinates for the next pixel
+            w1 += w1XStep;
+            w2 += w2XStep;
+            w3 += w3XStep;
+        }
+
+        // Move to the next row in the bounding box
+        w1Row += w1YStep;
+        w2Row += w2YStep;
+        w3Row += w3YStep;
     }
 }
 
-// Set texture wrapping mode
-void SetTextureWrap(Texture2D texture, int wrap)
+// Draw triangle outline within an image
+void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
-    switch (wrap)
+    ImageDrawLine(dst, (int)v1.x, (int)v1.y, (int)v2.x, (int)v2.y, color);
+    ImageDrawLine(dst, (int)v2.x, (int)v2.y, (int)v3.x, (int)v3.y, color);
+    ImageDrawLine(dst, (int)v3.x, (int)v3.y, (int)v1.x, (int)v1.y, color);
+}
+
+// Draw a triangle fan defined by points within an image (first vertex is the center)
+void ImageDrawTriangleFan(Image *dst, Vector2 *points, int pointCount, Color color)
+{
+    if (pointCount >= 3)
     {
-        case TEXTURE_WRAP_REPEAT:
-        {
-            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
-        } break;
-        case TEXTURE_WRAP_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
-        } break;
-        case TEXTURE_WRAP_MIRROR_REPEAT:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-        } break;
-        case TEXTURE_WRAP_MIRROR_CLAMP:
+        for (int i = 1; i < pointCount - 1; i++)
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-        } break;
-        default: break;
+            ImageDrawTriangle(dst, points[0], points[i], points[i + 1], color);
+        }
     }
 }
 
-//------------------------------------------------------------------------------------
-// Texture drawing functions
-//------------------------------------------------------------------------------------
-// Draw a texture
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+// Draw a triangle strip defined by points within an image
+void ImageDrawTriangleStrip(Image *dst, Vector2 *points, int pointCount, Color color)
 {
-    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+    if (pointCount >= 3)
+    {
+        for (int i = 2; i < pointCount; i++)
+        {
+            if ((i%2) == 0) ImageDrawTriangle(dst, points[i], points[i - 2], points[i - 1], color);
+            else ImageDrawTriangle(dst, points[i], points[i - 1], points[i - 2], color);
+        }
+    }
 }
 
-// Draw a texture with position defined as Vector2
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+// Draw an image (source) within an image (destination)
+// NOTE: Color tint is applied to source image
+void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
 {
-    DrawTextureEx(texture, position, 0, 1.0f, tint);
+    ImageDrawEx(dst, src, srcRec, dstRec, tint, BLEND_ALPHA);
 }
 
-// Draw a texture with extended parameters
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+// Draw an image (source) within an image (destination) with blend mode
+// NOTE: Color tint is applied to source image, supported blend modes: BLEND_ALPHA and BLEND_ALPHA_PREMULTIPLY (source and destination colors premultiplied)
+void ImageDrawEx(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, int blendMode)
 {
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    Vector2 origin = { 0.0f, 0.0f };
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
+        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
 
-    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+    if (dst->mipmaps > 1) TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    else
+    {
+        // NOTE: Source rectangle is clamped to source image bounds by view, no source data is copied
+        ImageViewDraw(GetImageView(*dst), GetImageViewRec(GetImageView(src), srcRec), dstRec, tint, blendMode);
+    }
 }
 
-// Draw a part of a texture (defined by a rectangle)
-void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+// Draw text (default font) within an image (destination)
+void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
 {
-    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
-    Vector2 origin = { 0.0f, 0.0f };
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
+    // Make sure default font is loaded to be used on image text drawing
+    if (GetFontDefault().texture.id == 0) LoadFontDefault();
 
-    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+    Vector2 position = { (float)posX, (float)posY };
+    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, 1.0f, color);   // WARNING: Module required: rtext
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: ImageDrawText() requires module: rtext");
+#endif
 }
 
-// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
-// NOTE: origin is relative to destination rectangle size
-void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Draw text (custom sprite font) within an image (destination)
+void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
 {
-    // Check if texture is valid
-    if (texture.id > 0)
-    {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+    Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
 
-        bool flipX = false;
+    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
+    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
 
-        if (source.width < 0) { flipX = true; source.width *= -1; }
-        if (source.height < 0) source.y -= source.height;
-        
-        if (dest.width < 0) dest.width *= -1;
-        if (dest.height < 0) dest.height *= -1;
-
-        Vector2 topLeft = { 0 };
-        Vector2 topRight = { 0 };
-        Vector2 bottomLeft = { 0 };
-        Vector2 bottomRight = { 0 };
-
-        // Only calculate rotation if needed
-        if (rotation == 0.0f)
-        {
-            float x = dest.x - origin.x;
-            float y = dest.y - origin.y;
-            topLeft = (Vector2){ x, y };
-            topRight = (Vector2){ x + dest.width, y };
-            bottomLeft = (Vector2){ x, y + dest.height };
-            bottomRight = (Vector2){ x + dest.width, y + dest.height };
-        }
-        else
-        {
-            float sinRotation = sinf(rotation*DEG2RAD);
-            float cosRotation = cosf(rotation*DEG2RAD);
-            float x = dest.x;
-            float y = dest.y;
-            float dx = -origin.x;
-            float dy = -origin.y;
-
-            topLeft.x = x + dx*cosRotation - dy*sinRotation;
-            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
 
-            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
-            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+    UnloadImage(imText);
+}
 
-            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
-            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+//------------------------------------------------------------------------------------
+// Texture loading functions
+//------------------------------------------------------------------------------------
+// Load texture from file into GPU memory (VRAM)
+Texture2D LoadTexture(const char *fileName)
+{
+    Texture2D texture = { 0 };
 
-            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
-            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
-        }
+#if defined(SUPPORT_FILEFORMAT_DDS) || defined(SUPPORT_FILEFORMAT_KTX2)
+    // GPU-ready file formats are uploaded from memory-mapped file data, no intermediate copy required
+    // NOTE: Deferred uploads (async assets loading) require image data, file mapping is not used
+    if (!IsAsyncAssetLoading() && IsFileExtension(fileName, ".dds;.ktx2"))
+    {
+        if (LoadTextureFromMappedFile(fileName, &texture)) return texture;
+    }
+#endif
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+    Image image = LoadImage(fileName);
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    if (image.data != NULL)
+    {
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+    return texture;
+}
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+// Load a texture from image data
+// NOTE: image is not unloaded, it must be done manually
+Texture2D LoadTextureFromImage(Image image)
+{
+    Texture2D texture = { 0 };
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+    if ((image.width != 0) && (image.height != 0))
+    {
+        if (IsAsyncAssetLoading())
+        {
+            // Loading an async asset (i.e. model materials), GPU upload is deferred to main thread,
+            // texture id is a placeholder until the asset is uploaded
+            Image *copy = (Image *)RL_MALLOC(sizeof(Image));
+            *copy = ImageCopy(image);
+            texture.id = AddAsyncUpload(UploadTextureDeferred, ReleaseTextureDeferred, copy);
+        }
+        else texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.mipmaps = image.mipmaps;
+    texture.format = image.format;
 
-        rlEnd();
-        rlSetTexture(0);
+    return texture;
+}
 
-        // NOTE: Vertex position can be transformed using matrices
-        // but the process is way more costly than just calculating
-        // the vertex positions manually, like done above
-        // I leave here the old implementation for educational purposes,
-        // just in case someone wants to do some performance test
-        /*
-        rlSetTexture(texture.id);
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+// Load texture from file asynchronously, returns async asset handle
+// NOTE: Image is loaded on a worker thread, texture is uploaded on main thread at EndDrawing()
+int LoadTextureAsync(const char *fileName)
+{
+    AsyncTextureData *data = (AsyncTextureData *)RL_CALLOC(1, sizeof(AsyncTextureData));
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    int fileNameSize = (int)strlen(fileName) + 1;
+    data->fileName = (char *)RL_MALLOC(fileNameSize);
+    memcpy(data->fileName, fileName, fileNameSize);
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                else rlTexCoord2f(source.x/width, source.y/height);
-                rlVertex2f(0.0f, 0.0f);
+    return AddAsyncAsset(data, LoadTextureAsyncData, UploadTextureAsyncData, UnloadTextureAsyncData);
+}
 
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                rlVertex2f(0.0f, dest.height);
+// Get texture from async asset handle (ready or failed), handle is released
+Texture2D GetAssetTexture(int asset)
+{
+    Texture2D texture = { 0 };
+    AsyncTextureData *data = (AsyncTextureData *)ReleaseAsyncAsset(asset, LoadTextureAsyncData);
 
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                rlVertex2f(dest.width, dest.height);
+    if (data != NULL)
+    {
+        texture = data->texture;
 
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                rlVertex2f(dest.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
-        rlSetTexture(0);
-        */
+        RL_FREE(data->fileName);
+        RL_FREE(data);
     }
+
+    return texture;
 }
 
-// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
-void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Load cubemap from image, multiple image cubemap layouts supported
+TextureCubemap LoadTextureCubemap(Image image, int layout)
 {
-    if (texture.id > 0)
+    TextureCubemap cubemap = { 0 };
+
+    if (layout == CUBEMAP_LAYOUT_AUTO_DETECT)      // Try to automatically guess layout type
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        // Check image width/height to determine the type of cubemap provided
+        if (image.width > image.height)
+        {
+            if ((image.width/6) == image.height) { layout = CUBEMAP_LAYOUT_LINE_HORIZONTAL; cubemap.width = image.width/6; }
+            else if ((image.width/4) == (image.height/3)) { layout = CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
+            else if (image.width >= (int)((float)image.height*1.85f)) { layout = CUBEMAP_LAYOUT_PANORAMA; cubemap.width = image.width/4; }
+        }
+        else if (image.height > image.width)
+        {
+            if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
+            else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+        }
+    }
+    else
+    {
+        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL) cubemap.width = image.height/6;
+        if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) cubemap.width = image.width/6;
+        if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR) cubemap.width = image.width/3;
+        if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE) cubemap.width = image.width/4;
+        if (layout == CUBEMAP_LAYOUT_PANORAMA) cubemap.width = image.width/4;
+    }
 
-        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
-        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+    cubemap.height = cubemap.width;
 
-        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
-        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+    // Layout provided or already auto-detected
+    if (layout != CUBEMAP_LAYOUT_AUTO_DETECT)
+    {
+        int size = cubemap.width;
 
-        bool drawCenter = true;
-        bool drawMiddle = true;
-        float leftBorder = (float)nPatchInfo.left;
-        float topBorder = (float)nPatchInfo.top;
-        float rightBorder = (float)nPatchInfo.right;
-        float bottomBorder = (float)nPatchInfo.bottom;
+        Image faces = { 0 };                // Vertical column image
+        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
 
-        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
-        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, (float)size, (float)size };
+
+        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL)
         {
-            drawCenter = false;
-            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
-            rightBorder = patchWidth - leftBorder;
+            faces = ImageCopy(image);       // Image data already follows expected convention
         }
-
-        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
-        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        else if (layout == CUBEMAP_LAYOUT_PANORAMA)
         {
-            drawMiddle = false;
-            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
-            bottomBorder = patchHeight - topBorder;
+            // TODO: Convert panorama image to square faces...
+            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
         }
+        else
+        {
+            if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = (float)size*i;
+            else if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR)
+            {
+                faceRecs[0].x = (float)size; faceRecs[0].y = (float)size;
+                faceRecs[1].x = (float)size; faceRecs[1].y = (float)size*3;
+                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
+                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
+                faceRecs[4].x = 0; faceRecs[4].y = (float)size;
+                faceRecs[5].x = (float)size*2; faceRecs[5].y = (float)size;
+            }
+            else if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE)
+            {
+                faceRecs[0].x = (float)size*2; faceRecs[0].y = (float)size;
+                faceRecs[1].x = 0; faceRecs[1].y = (float)size;
+                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
+                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
+                faceRecs[4].x = (float)size; faceRecs[4].y = (float)size;
+                faceRecs[5].x = (float)size*3; faceRecs[5].y = (float)size;
+            }
 
-        Vector2 vertA, vertB, vertC, vertD;
-        vertA.x = 0.0f;                             // outer left
-        vertA.y = 0.0f;                             // outer top
-        vertB.x = leftBorder;                       // inner left
-        vertB.y = topBorder;                        // inner top
-        vertC.x = patchWidth  - rightBorder;        // inner right
-        vertC.y = patchHeight - bottomBorder;       // inner bottom
-        vertD.x = patchWidth;                       // outer right
-        vertD.y = patchHeight;                      // outer bottom
+            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
+            faces = GenImageColor(size, size*6, MAGENTA);
+            ImageFormat(&faces, image.format);
 
-        Vector2 coordA, coordB, coordC, coordD;
-        coordA.x = nPatchInfo.source.x/width;
-        coordA.y = nPatchInfo.source.y/height;
-        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
-        coordB.y = (nPatchInfo.source.y + topBorder)/height;
-        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
-        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
-        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
-        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+            // NOTE: Image formatting does not work with compressed textures
 
-        rlSetTexture(texture.id);
+            for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
+        }
 
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
+        // NOTE: Cubemap data is expected to be provided as 6 images in a single data array,
+        // one after the other (that's a vertical image), following convention: +X, -X, +Y, -Y, +Z, -Z
+        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format);
+
+        if (cubemap.id != 0)
+        {
+            cubemap.format = faces.format;
+            cubemap.mipmaps = 1;
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
+
+        UnloadImage(faces);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
+
+    return cubemap;
+}
+
+// Load texture for rendering (framebuffer)
+// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
+RenderTexture2D LoadRenderTexture(int width, int height)
+{
+    RenderTexture2D target = { 0 };
+
+    target.id = rlLoadFramebuffer(); // Load an empty framebuffer
+
+    if (target.id > 0)
+    {
+        rlEnableFramebuffer(target.id);
+
+        // Create color texture (default to RGBA)
+        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        target.texture.mipmaps = 1;
+
+        // Create depth renderbuffer/texture
+        target.depth.id = rlLoadTextureDepth(width, height, true);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+
+        // Attach color texture and depth renderbuffer/texture to FBO
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+        // Check if fbo is complete with attachments (valid)
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+
+        rlDisableFramebuffer();
+    }
+    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+
+    return target;
+}
+
+// Check if a texture is ready
+bool IsTextureReady(Texture2D texture)
+{
+    bool result = false;
+
+    // TODO: Validate maximum texture size supported by GPU?
+
+    if ((texture.id > 0) &&         // Validate OpenGL id
+        (texture.width > 0) &&
+        (texture.height > 0) &&     // Validate texture size
+        (texture.format > 0) &&     // Validate texture pixel format
+        (texture.mipmaps > 0)) result = true;     // Validate texture mipmaps (at least 1 for basic mipmap level)
+
+    return result;
+}
+
+// Unload texture from GPU memory (VRAM)
+void UnloadTexture(Texture2D texture)
+{
+    if (texture.id > 0)
+    {
+        rlUnloadTexture(texture.id);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+    }
+}
+
+// Check if a render texture is ready
+bool IsRenderTextureReady(RenderTexture2D target)
+{
+    bool result = false;
+
+    if ((target.id > 0) &&                  // Validate OpenGL id
+        IsTextureReady(target.depth) &&     // Validate FBO depth texture/renderbuffer
+        IsTextureReady(target.texture)) result = true;    // Validate FBO texture
+
+    return result;
+}
+
+// Unload render texture from GPU memory (VRAM)
+void UnloadRenderTexture(RenderTexture2D target)
+{
+    if (target.id > 0)
+    {
+        if (target.texture.id > 0)
+        {
+            // Color texture attached to FBO is deleted
+            rlUnloadTexture(target.texture.id);
+        }
+
+        // NOTE: Depth texture/renderbuffer is automatically
+        // queried and deleted before deleting framebuffer
+        rlUnloadFramebuffer(target.id);
+    }
+}
+
+// Update GPU texture with new data
+// NOTE: pixels data must match texture.format
+void UpdateTexture(Texture2D texture, const void *pixels)
+{
+    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+}
+
+// Update GPU texture rectangle with new data
+// NOTE: pixels data must match texture.format
+void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+{
+    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+}
+
+// Add image to atlas and update atlas texture sprite region, returns sprite index (-1 if it does not fit)
+// NOTE: Texture must be loaded from atlas image, only new sprite cell (sprite plus padding) is uploaded
+int UpdateTextureAtlas(Texture2D texture, ImageAtlas *atlas, Image image)
+{
+    if ((atlas == NULL) || (texture.width != atlas->image.width) || (texture.height != atlas->image.height) || (texture.format != atlas->image.format))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update atlas, texture does not match atlas image", texture.id);
+        return -1;
+    }
+
+    int index = ImageAtlasAdd(atlas, image);
+
+    if ((index >= 0) && (atlas->sprites[index].rec.width > 0))
+    {
+        Rectangle rec = atlas->sprites[index].rec;
+        Rectangle cell = { rec.x - atlas->padding, rec.y - atlas->padding, rec.width + 2*atlas->padding, rec.height + 2*atlas->padding };
+
+        // NOTE: Cell pixels are packed from atlas image rows, as required by texture update
+        Image region = ImageFromView(GetImageViewRec(GetImageView(atlas->image), cell));
+        UpdateTextureRec(texture, (Rectangle){ cell.x, cell.y, (float)region.width, (float)region.height }, region.data);
+        UnloadImage(region);
+    }
+
+    return index;
+}
+
+//------------------------------------------------------------------------------------
+// Texture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void GenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+}
+
+// Set texture scaling filter mode
+void SetTextureFilter(Texture2D texture, int filter)
+{
+    switch (filter)
+    {
+        case TEXTURE_FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+        } break;
+        case TEXTURE_FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
+        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
+        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void SetTextureWrap(Texture2D texture, int wrap)
+{
+    switch (wrap)
+    {
+        case TEXTURE_WRAP_REPEAT:
+        {
+            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
+        } break;
+        case TEXTURE_WRAP_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+        } break;
+        case TEXTURE_WRAP_MIRROR_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+        } break;
+        case TEXTURE_WRAP_MIRROR_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+        } break;
+        default: break;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Texture drawing functions
+//------------------------------------------------------------------------------------
+// Draw a texture
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a texture with position defined as Vector2
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a texture with extended parameters
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+{
+    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        bool flipX = false;
+
+        if (source.width < 0) { flipX = true; source.width *= -1; }
+        if (source.height < 0) source.y -= source.height;
+        
+        if (dest.width < 0) dest.width *= -1;
+        if (dest.height < 0) dest.height *= -1;
+
+        Vector2 topLeft = { 0 };
+        Vector2 topRight = { 0 };
+        Vector2 bottomLeft = { 0 };
+        Vector2 bottomRight = { 0 };
+
+        // Only calculate rotation if needed
+        if (rotation == 0.0f)
+        {
+            float x = dest.x - origin.x;
+            float y = dest.y - origin.y;
+            topLeft = (Vector2){ x, y };
+            topRight = (Vector2){ x + dest.width, y };
+            bottomLeft = (Vector2){ x, y + dest.height };
+            bottomRight = (Vector2){ x + dest.width, y + dest.height };
+        }
+        else
+        {
+            float sinRotation = sinf(rotation*DEG2RAD);
+            float cosRotation = cosf(rotation*DEG2RAD);
+            float x = dest.x;
+            float y = dest.y;
+            float dx = -origin.x;
+            float dy = -origin.y;
+
+            topLeft.x = x + dx*cosRotation - dy*sinRotation;
+            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+
+            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
+            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+
+            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
+            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+
+            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
+            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+        }
+
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            // Top-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            else rlTexCoord2f(source.x/width, source.y/height);
+            rlVertex2f(topLeft.x, topLeft.y);
+
+            // Bottom-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            rlVertex2f(bottomLeft.x, bottomLeft.y);
+
+            // Bottom-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+
+            // Top-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            rlVertex2f(topRight.x, topRight.y);
+
+        rlEnd();
+        rlSetTexture(0);
+
+        // NOTE: Vertex position can be transformed using matrices
+        // but the process is way more costly than just calculating
+        // the vertex positions manually, like done above
+        // I leave here the old implementation for educational purposes,
+        // just in case someone wants to do some performance test
+        /*
+        rlSetTexture(texture.id);
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                else rlTexCoord2f(source.x/width, source.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                rlVertex2f(0.0f, dest.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                rlVertex2f(dest.width, dest.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                rlVertex2f(dest.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+        rlSetTexture(0);
+        */
+    }
+}
+
+// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
+void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
+        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+
+        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
+        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+
+        bool drawCenter = true;
+        bool drawMiddle = true;
+        float leftBorder = (float)nPatchInfo.left;
+        float topBorder = (float)nPatchInfo.top;
+        float rightBorder = (float)nPatchInfo.right;
+        float bottomBorder = (float)nPatchInfo.bottom;
+
+        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
+        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+        {
+            drawCenter = false;
+            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
+            rightBorder = patchWidth - leftBorder;
+        }
+
+        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
+        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        {
+            drawMiddle = false;
+            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
+            bottomBorder = patchHeight - topBorder;
+        }
+
+        Vector2 vertA, vertB, vertC, vertD;
+        vertA.x = 0.0f;                             // outer left
+        vertA.y = 0.0f;                             // outer top
+        vertB.x = leftBorder;                       // inner left
+        vertB.y = topBorder;                        // inner top
+        vertC.x = patchWidth  - rightBorder;        // inner right
+        vertC.y = patchHeight - bottomBorder;       // inner bottom
+        vertD.x = patchWidth;                       // outer right
+        vertD.y = patchHeight;                      // outer bottom
+
+        Vector2 coordA, coordB, coordC, coordD;
+        coordA.x = nPatchInfo.source.x/width;
+        coordA.y = nPatchInfo.source.y/height;
+        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
+        coordB.y = (nPatchInfo.source.y + topBorder)/height;
+        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
+        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
+        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
+        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+
+        rlSetTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
             rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
             rlTranslatef(-origin.x, -origin.y, 0.0f);
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+
+                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
+                {
+                    // ------------------------------------------------------------
+                    // TOP-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // TOP-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // TOP-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawMiddle)
+                    {
+                        // ------------------------------------------------------------
+                        // MIDDLE-LEFT QUAD
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        if (drawCenter)
+                        {
+                            // MIDDLE-CENTER QUAD
+                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
+                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                        }
+
+                        // MIDDLE-RIGHT QUAD
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+
+                    // ------------------------------------------------------------
+                    // BOTTOM-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // BOTTOM-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                    }
+
+                    // BOTTOM-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+                {
+                    // TOP QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // MIDDLE QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+                    // BOTTOM QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+                {
+                    // LEFT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // CENTER QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // RIGHT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                }
+            rlEnd();
+        rlPopMatrix();
+
+        rlSetTexture(0);
+    }
+}
+
+// Check if two colors are equal
+bool ColorIsEqual(Color col1, Color col2)
+{
+    bool result = false;
+
+    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+
+    return result;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color Fade(Color color, float alpha)
+{
+    Color result = color;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    result.a = (unsigned char)(255.0f*alpha);
+
+    return result;
+}
+
+// Get hexadecimal value for a Color
+int ColorToInt(Color color)
+{
+    int result = 0;
+
+    result = (int)(((unsigned int)color.r << 24) |
+                   ((unsigned int)color.g << 16) |
+                   ((unsigned int)color.b << 8) |
+                    (unsigned int)color.a);
+
+    return result;
+}
+
+// Get color normalized as float [0..1]
+Vector4 ColorNormalize(Color color)
+{
+    Vector4 result;
+
+    result.x = (float)color.r/255.0f;
+    result.y = (float)color.g/255.0f;
+    result.z = (float)color.b/255.0f;
+    result.w = (float)color.a/255.0f;
+
+    return result;
+}
+
+// Get color from normalized values [0..1]
+Color ColorFromNormalized(Vector4 normalized)
+{
+    Color result;
+
+    result.r = (unsigned char)(normalized.x*255.0f);
+    result.g = (unsigned char)(normalized.y*255.0f);
+    result.b = (unsigned char)(normalized.z*255.0f);
+    result.a = (unsigned char)(normalized.w*255.0f);
+
+    return result;
+}
+
+// Get HSV values for a Color
+// NOTE: Hue is returned as degrees [0..360]
+Vector3 ColorToHSV(Color color)
+{
+    Vector3 hsv = { 0 };
+    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    float min, max, delta;
+
+    min = rgb.x < rgb.y? rgb.x : rgb.y;
+    min = min  < rgb.z? min  : rgb.z;
+
+    max = rgb.x > rgb.y? rgb.x : rgb.y;
+    max = max  > rgb.z? max  : rgb.z;
+
+    hsv.z = max;            // Value
+    delta = max - min;
+
+    if (delta < 0.00001f)
+    {
+        hsv.y = 0.0f;
+        hsv.x = 0.0f;       // Undefined, maybe NAN?
+        return hsv;
+    }
+
+    if (max > 0.0f)
+    {
+        // NOTE: If max is 0, this divide would cause a crash
+        hsv.y = (delta/max);    // Saturation
+    }
+    else
+    {
+        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
+        hsv.y = 0.0f;
+        hsv.x = NAN;        // Undefined
+        return hsv;
+    }
+
+    // NOTE: Comparing float values could not work properly
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
+    else
+    {
+        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
+        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+    }
+
+    hsv.x *= 60.0f;     // Convert to degrees
+
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
+
+    return hsv;
+}
+
+
+
+// Get a Color from HSV values
+// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
+// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
+// Hue is provided in degrees: [0..360]
+// Saturation/Value are provided normalized: [0.0f..1.0f]
+Color ColorFromHSV(float hue, float saturation, float value)
+{
+    Color color = { 0, 0, 0, 255 };
+
+    // Red channel
+    float k = fmodf((5.0f + hue/60.0f), 6);
+    float t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Green channel
+    k = fmodf((3.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Blue channel
+    k = fmodf((1.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    return color;
+}
+
+// Get color multiplied with another color
+Color ColorTint(Color color, Color tint)
+{
+    Color result = color;
+
+    unsigned char r = (unsigned char)(((int)color.r*(int)tint.r)/255);
+    unsigned char g = (unsigned char)(((int)color.g*(int)tint.g)/255);
+    unsigned char b = (unsigned char)(((int)color.b*(int)tint.b)/255);
+    unsigned char a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+
+    result.r = r;
+    result.g = g;
+    result.b = b;
+    result.a = a;
+
+    return result;
+}
+
+// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
+Color ColorBrightness(Color color, float factor)
+{
+    Color result = color;
+
+    if (factor > 1.0f) factor = 1.0f;
+    else if (factor < -1.0f) factor = -1.0f;
+
+    float red = (float)color.r;
+    float green = (float)color.g;
+    float blue = (float)color.b;
+
+    if (factor < 0.0f)
+    {
+        factor = 1.0f + factor;
+        red *= factor;
+        green *= factor;
+        blue *= factor;
+    }
+    else
+    {
+        red = (255 - red)*factor + red;
+        green = (255 - green)*factor + green;
+        blue = (255 - blue)*factor + blue;
+    }
+
+    result.r = (unsigned char)red;
+    result.g = (unsigned char)green;
+    result.b = (unsigned char)blue;
+
+    return result;
+}
+
+// Get color with contrast correction
+// NOTE: Contrast values between -1.0f and 1.0f
+Color ColorContrast(Color color, float contrast)
+{
+    Color result = color;
+
+    if (contrast < -1.0f) contrast = -1.0f;
+    else if (contrast > 1.0f) contrast = 1.0f;
+
+    contrast = (1.0f + contrast);
+    contrast *= contrast;
+
+    float pR = (float)color.r/255.0f;
+    pR -= 0.5f;
+    pR *= contrast;
+    pR += 0.5f;
+    pR *= 255;
+    if (pR < 0) pR = 0;
+    else if (pR > 255) pR = 255;
+
+    float pG = (float)color.g/255.0f;
+    pG -= 0.5f;
+    pG *= contrast;
+    pG += 0.5f;
+    pG *= 255;
+    if (pG < 0) pG = 0;
+    else if (pG > 255) pG = 255;
+
+    float pB = (float)color.b/255.0f;
+    pB -= 0.5f;
+    pB *= contrast;
+    pB += 0.5f;
+    pB *= 255;
+    if (pB < 0) pB = 0;
+    else if (pB > 255) pB = 255;
+
+    result.r = (unsigned char)pR;
+    result.g = (unsigned char)pG;
+    result.b = (unsigned char)pB;
+
+    return result;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color ColorAlpha(Color color, float alpha)
+{
+    Color result = color;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    result.a = (unsigned char)(255.0f*alpha);
+
+    return result;
+}
+
+// Get src alpha-blended into dst color with tint
+Color ColorAlphaBlend(Color dst, Color src, Color tint)
+{
+    Color out = WHITE;
+
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+
+//#define COLORALPHABLEND_FLOAT
+#define COLORALPHABLEND_INTEGERS
+#if defined(COLORALPHABLEND_INTEGERS)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
+        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+
+        if (out.a > 0)
+        {
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+        }
+    }
+#endif
+#if defined(COLORALPHABLEND_FLOAT)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        Vector4 fdst = ColorNormalize(dst);
+        Vector4 fsrc = ColorNormalize(src);
+        Vector4 ftint = ColorNormalize(tint);
+        Vector4 fout = { 0 };
+
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+        if (fout.w > 0.0f)
+        {
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+        }
+
+        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+    }
+#endif
+
+    return out;
+}
+
+// Get color lerp interpolation between two colors, factor [0.0f..1.0f]
+Color ColorLerp(Color color1, Color color2, float factor) 
+{ 
+    Color color = { 0 };
+    
+    if (factor < 0.0f) factor = 0.0f;
+    else if (factor > 1.0f) factor = 1.0f;
+
+    color.r = (unsigned char)((1.0f - factor)*color1.r + factor*color2.r);
+    color.g = (unsigned char)((1.0f - factor)*color1.g + factor*color2.g);
+    color.b = (unsigned char)((1.0f - factor)*color1.b + factor*color2.b);
+    color.a = (unsigned char)((1.0f - factor)*color1.a + factor*color2.a);
+
+    return color;
+}
+
+// Get a Color struct from hexadecimal value
+Color GetColor(unsigned int hexValue)
+{
+    Color color;
+
+    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
+    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
+    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
+    color.a = (unsigned char)hexValue & 0xFF;
+
+    return color;
+}
+
+// Get color from a pixel from certain format
+Color GetPixelColor(void *srcPtr, int format)
+{
+    Color color = { 0 };
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
+            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 1) & 0b0000000000011111)*255/31);
+            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
+            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
+            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
+
+        } break;
+        default: break;
+    }
+
+    return color;
+}
+
+// Set pixel color formatted into destination pointer
+void SetPixelColor(void *dstPtr, Color color, int format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+            ((unsigned char *)dstPtr)[1] = color.a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+            ((unsigned char *)dstPtr)[3] = color.a;
+
+        } break;
+        default: break;
+    }
+}
+
+// Get pixel data size in bytes for certain format
+// NOTE: Size can be requested for Image or Texture data
+int GetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    double bytesPerPixel = (double)bpp/8.0;
+    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
+
+    // Most compressed formats works on 4x4 blocks (8x8 for ASTC 8x8), data is stored in full blocks,
+    // textures smaller or not multiple of block size (i.e. mipmaps) require padded blocks
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGBA))
+    {
+        int blockWidth = (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)? 8 : 4;
+
+        dataSize = ((width + blockWidth - 1)/blockWidth)*((height + blockWidth - 1)/blockWidth)*(bpp*blockWidth*blockWidth/8);
+    }
+    else if ((format >= PIXELFORMAT_COMPRESSED_PVRT_RGB) && (width < 4) && (height < 4)) dataSize = 16;
+
+    return dataSize;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Convert half-float (stored as unsigned short) to float
+// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+static float HalfToFloat(unsigned short x)
+{
+    float result = 0.0f;
+
+    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
+    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
+    const float fm = (float)m;
+    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+
+    result = *(float *)&r;
+
+    return result;
+}
+
+// Convert float to half-float (stored as unsigned short)
+static unsigned short FloatToHalf(float x)
+{
+    unsigned short result = 0;
+
+    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+
+    return result;
+}
+
+// Copy image pixel data into a Color array (RGBA - 32bit), pixels must have image.width*image.height elements
+static void CopyImageColors(Image image, Color *pixels)
+{
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[i];
+                    pixels[i].g = ((unsigned char *)image.data)[i];
+                    pixels[i].b = ((unsigned char *)image.data)[i];
+                    pixels[i].a = 255;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k];
+                    pixels[i].b = ((unsigned char *)image.data)[k];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                    pixels[i].a = 255;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                    pixels[i].a = 255;
+
+                    k += 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                {
+                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                    pixels[i].a = 255;
+
+                    k += 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                {
+                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
+
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
+    }
+
+}
+
+// Load batch images one after another until all images are taken, LoadImagesBatch() loader job
+static void LoadImagesBatchJob(void *userData)
+{
+    ImageBatchData *batch = (ImageBatchData *)userData;
+
+    for (int index = RL_ATOMIC_ADD(&batch->next, 1) - 1; index < batch->count; index = RL_ATOMIC_ADD(&batch->next, 1) - 1)
+    {
+        int result = IMAGE_LOAD_FILE_ERROR;
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(batch->fileNames[index], &dataSize);
+
+        if (fileData != NULL)
+        {
+            batch->images[index] = LoadImageFromMemory(GetFileExtension(batch->fileNames[index]), fileData, dataSize);
+            result = (batch->images[index].data != NULL)? IMAGE_LOAD_SUCCESS : IMAGE_LOAD_DECODE_ERROR;
+
+            UnloadFileData(fileData);
+        }
+
+        if (result == IMAGE_LOAD_SUCCESS) RL_ATOMIC_ADD(&batch->loaded, 1);
+        if (batch->results != NULL) batch->results[index] = result;
+    }
+}
+
+// Async texture load function (worker thread)
+static bool LoadTextureAsyncData(void *data)
+{
+    AsyncTextureData *texData = (AsyncTextureData *)data;
+
+    texData->image = LoadImage(texData->fileName);
+
+    return (texData->image.data != NULL);
+}
+
+// Async texture upload function (main thread)
+static void UploadTextureAsyncData(void *data)
+{
+    AsyncTextureData *texData = (AsyncTextureData *)data;
+
+    texData->texture = LoadTextureFromImage(texData->image);
+    UnloadImage(texData->image);
+    texData->image = (Image){ 0 };
+}
+
+// Async texture unload function, texture not retrieved (main thread)
+static void UnloadTextureAsyncData(void *data)
+{
+    AsyncTextureData *texData = (AsyncTextureData *)data;
+
+    UnloadImage(texData->image);
+    if (texData->texture.id > 0) UnloadTexture(texData->texture);
+
+    RL_FREE(texData->fileName);
+    RL_FREE(texData);
+}
+
+// Deferred texture upload, for textures loaded by async assets
+static unsigned int UploadTextureDeferred(void *data)
+{
+    Image *image = (Image *)data;
+
+    unsigned int id = rlLoadTexture(image->data, image->width, image->height, image->format, image->mipmaps);
+
+    UnloadImage(*image);
+    RL_FREE(image);
+
+    return id;
+}
+
+// Deferred texture release, image copy is unloaded without uploading
+static void ReleaseTextureDeferred(void *data)
+{
+    Image *image = (Image *)data;
+
+    UnloadImage(*image);
+    RL_FREE(image);
+}
+
+#if defined(SUPPORT_FILEFORMAT_DDS) || defined(SUPPORT_FILEFORMAT_KTX2)
+// Load texture from memory-mapped file (DDS, KTX2), returns false if file can not be mapped or parsed
+// NOTE: Image data is uploaded directly from file mapping, data requiring reordering
+// (i.e. DDS BGRA pixels, KTX2 mipmap levels) is copied once, no decoding required,
+// on failure LoadTexture() falls back to LoadImage() path (custom loaders and other decoders)
+static bool LoadTextureFromMappedFile(const char *fileName, Texture2D *texture)
+{
+    int dataSize = 0;
+    unsigned char *fileData = rMapFile(fileName, &dataSize);
+
+    if (fileData == NULL) return false;
+
+    Image image = { 0 };
+    const void *data = NULL;
+    void *imageData = NULL;
+
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    if (IsFileExtension(fileName, ".dds"))
+    {
+        data = rl_get_dds_data_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+        if ((data == NULL) && (image.format != 0)) imageData = rl_load_dds_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+    if (IsFileExtension(fileName, ".ktx2"))
+    {
+        data = rl_get_ktx2_data_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+        if ((data == NULL) && (image.format != 0)) imageData = rl_load_ktx2_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
+#endif
+
+    if (imageData != NULL) data = imageData;
+
+    if (data != NULL)
+    {
+        texture->id = rlLoadTexture(data, image.width, image.height, image.format, image.mipmaps);
+        texture->width = image.width;
+        texture->height = image.height;
+        texture->mipmaps = image.mipmaps;
+        texture->format = image.format;
+    }
+
+    RL_FREE(imageData);
+    rUnmapFile(fileData, dataSize);
+
+    return (data != NULL);
+}
+#endif
+
+// Get pixels range as Vector4 array (float normalized)
+// NOTE: Range offset and count are defined in pixels, only uncompressed formats supported
+static void GetPixelsNormalized(const void *data, int format, int offset, int count, Vector4 *pixels)
+{
+    const unsigned char *data8 = (const unsigned char *)data;
+    const unsigned short *data16 = (const unsigned short *)data;
+    const float *data32 = (const float *)data;
+
+    for (int i = 0, p = offset; i < count; i++, p++)
+    {
+        switch (format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                pixels[i].x = (float)data8[p]/255.0f;
+                pixels[i].y = (float)data8[p]/255.0f;
+                pixels[i].z = (float)data8[p]/255.0f;
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                pixels[i].x = (float)data8[p*2]/255.0f;
+                pixels[i].y = (float)data8[p*2]/255.0f;
+                pixels[i].z = (float)data8[p*2]/255.0f;
+                pixels[i].w = (float)data8[p*2 + 1]/255.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = data16[p];
+
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = data16[p];
+
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = data16[p];
+
+                pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                pixels[i].x = (float)data8[p*4]/255.0f;
+                pixels[i].y = (float)data8[p*4 + 1]/255.0f;
+                pixels[i].z = (float)data8[p*4 + 2]/255.0f;
+                pixels[i].w = (float)data8[p*4 + 3]/255.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                pixels[i].x = (float)data8[p*3]/255.0f;
+                pixels[i].y = (float)data8[p*3 + 1]/255.0f;
+                pixels[i].z = (float)data8[p*3 + 2]/255.0f;
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                pixels[i].x = data32[p];
+                pixels[i].y = 0.0f;
+                pixels[i].z = 0.0f;
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                pixels[i].x = data32[p*3];
+                pixels[i].y = data32[p*3 + 1];
+                pixels[i].z = data32[p*3 + 2];
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                pixels[i].x = data32[p*4];
+                pixels[i].y = data32[p*4 + 1];
+                pixels[i].z = data32[p*4 + 2];
+                pixels[i].w = data32[p*4 + 3];
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                pixels[i].x = HalfToFloat(data16[p]);
+                pixels[i].y = 0.0f;
+                pixels[i].z = 0.0f;
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                pixels[i].x = HalfToFloat(data16[p*3]);
+                pixels[i].y = HalfToFloat(data16[p*3 + 1]);
+                pixels[i].z = HalfToFloat(data16[p*3 + 2]);
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                pixels[i].x = HalfToFloat(data16[p*4]);
+                pixels[i].y = HalfToFloat(data16[p*4 + 1]);
+                pixels[i].z = HalfToFloat(data16[p*4 + 2]);
+                pixels[i].w = HalfToFloat(data16[p*4 + 3]);
+
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Set pixels range from Vector4 array (float normalized)
+// NOTE: Range offset and count are defined in pixels, only uncompressed formats supported
+static void SetPixelsNormalized(void *data, int format, int offset, int count, const Vector4 *pixels)
+{
+    unsigned char *data8 = (unsigned char *)data;
+    unsigned short *data16 = (unsigned short *)data;
+    float *data32 = (float *)data;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data8[p] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data8[p*2] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                data8[p*2 + 1] = (unsigned char)(pixels[i].w*255.0f);
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                r = (unsigned char)(round(pixels[i].x*31.0f));
+                g = (unsigned char)(round(pixels[i].y*63.0f));
+                b = (unsigned char)(round(pixels[i].z*31.0f));
+
+                data16[p] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data8[p*3] = (unsigned char)(pixels[i].x*255.0f);
+                data8[p*3 + 1] = (unsigned char)(pixels[i].y*255.0f);
+                data8[p*3 + 2] = (unsigned char)(pixels[i].z*255.0f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+            unsigned char a = 0;
+
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                r = (unsigned char)(round(pixels[i].x*31.0f));
+                g = (unsigned char)(round(pixels[i].y*31.0f));
+                b = (unsigned char)(round(pixels[i].z*31.0f));
+                a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                data16[p] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+            unsigned char a = 0;
+
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                r = (unsigned char)(round(pixels[i].x*15.0f));
+                g = (unsigned char)(round(pixels[i].y*15.0f));
+                b = (unsigned char)(round(pixels[i].z*15.0f));
+                a = (unsigned char)(round(pixels[i].w*15.0f));
+
+                data16[p] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data8[p*4] = (unsigned char)(pixels[i].x*255.0f);
+                data8[p*4 + 1] = (unsigned char)(pixels[i].y*255.0f);
+                data8[p*4 + 2] = (unsigned char)(pixels[i].z*255.0f);
+                data8[p*4 + 3] = (unsigned char)(pixels[i].w*255.0f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data32[p] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data32[p*3] = pixels[i].x;
+                data32[p*3 + 1] = pixels[i].y;
+                data32[p*3 + 2] = pixels[i].z;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data32[p*4] = pixels[i].x;
+                data32[p*4 + 1] = pixels[i].y;
+                data32[p*4 + 2] = pixels[i].z;
+                data32[p*4 + 3] = pixels[i].w;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data16[p] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data16[p*3] = FloatToHalf(pixels[i].x);
+                data16[p*3 + 1] = FloatToHalf(pixels[i].y);
+                data16[p*3 + 2] = FloatToHalf(pixels[i].z);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++)
+            {
+                data16[p*4] = FloatToHalf(pixels[i].x);
+                data16[p*4 + 1] = FloatToHalf(pixels[i].y);
+                data16[p*4 + 2] = FloatToHalf(pixels[i].z);
+                data16[p*4 + 3] = FloatToHalf(pixels[i].w);
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Convert pixels range with direct kernel, if available for formats pair
+// NOTE: Direct kernels avoid the normalized Vector4 intermediate and give same results than generic path:
+// 8-bit to packed 16-bit uses integer rounding (c*max + 127)/255, packed 16-bit to 8-bit uses lookup tables
+// computed with the generic path expressions, returns false if formats pair is not supported
+static bool ConvertPixelsDirect(const void *src, int srcFormat, void *dst, int dstFormat, int offset, int count)
+{
+    bool result = false;
+    int srcChannels = 0;        // Source 8-bit channels, 0 if source is not 8-bit per channel
+
+    switch (srcFormat)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: srcChannels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: srcChannels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: srcChannels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: srcChannels = 4; break;
+        default: break;
+    }
+
+    int i = 0;
+
+    if ((srcChannels > 0) && ((dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)))
+    {
+        // 8-bit to RGB/RGBA 8-bit: channels copy/expand
+        int dstChannels = (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 3;
+        const unsigned char *in = (const unsigned char *)src + offset*srcChannels;
+        unsigned char *out = (unsigned char *)dst + offset*dstChannels;
+
+#if defined(RL_SIMD_SSSE3)
+        // NOTE: 16 bytes are loaded/stored per 4 pixels, extra bytes stay inside range (overwritten by next store)
+        if ((srcChannels == 4) && (dstChannels == 3))
+        {
+            const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+            for (; (i + 6) <= count; i += 4) _mm_storeu_si128((__m128i *)(out + i*3), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + i*4)), shuffle));
+        }
+        else if ((srcChannels == 3) && (dstChannels == 4))
+        {
+            const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+            const __m128i alpha = _mm_set1_epi32((int)0xff000000);
+            for (; (i + 6) <= count; i += 4) _mm_storeu_si128((__m128i *)(out + i*4), _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + i*3)), shuffle), alpha));
+        }
+#elif defined(RL_SIMD_NEON)
+        if ((srcChannels == 4) && (dstChannels == 3))
+        {
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x4_t rgba = vld4q_u8(in + i*4);
+                uint8x16x3_t rgb = { { rgba.val[0], rgba.val[1], rgba.val[2] } };
+                vst3q_u8(out + i*3, rgb);
+            }
+        }
+        else if ((srcChannels == 3) && (dstChannels == 4))
+        {
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x3_t rgb = vld3q_u8(in + i*3);
+                uint8x16x4_t rgba = { { rgb.val[0], rgb.val[1], rgb.val[2], vdupq_n_u8(255) } };
+                vst4q_u8(out + i*4, rgba);
+            }
+        }
+#endif
+        for (; i < count; i++)
+        {
+            const unsigned char *s = in + i*srcChannels;
+            unsigned char *d = out + i*dstChannels;
+
+            if (srcChannels >= 3) { d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; }
+            else { d[0] = s[0]; d[1] = s[0]; d[2] = s[0]; }
+
+            if (dstChannels == 4) d[3] = (srcChannels == 2)? s[1] : ((srcChannels == 4)? s[3] : 255);
+        }
+
+        result = true;
+    }
+    else if ((srcChannels > 0) && ((dstFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (dstFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)))
+    {
+        // 8-bit to grayscale 8-bit: luminance computed with generic path expression
+        int dstChannels = (dstFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)? 2 : 1;
+        const unsigned char *in = (const unsigned char *)src + offset*srcChannels;
+        unsigned char *out = (unsigned char *)dst + offset*dstChannels;
+
+        for (; i < count; i++)
+        {
+            const unsigned char *s = in + i*srcChannels;
+            float r = (float)s[0]/255.0f;
+            float g = (srcChannels >= 3)? (float)s[1]/255.0f : r;
+            float b = (srcChannels >= 3)? (float)s[2]/255.0f : r;
+
+            out[i*dstChannels] = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f);
+            if (dstChannels == 2) out[i*2 + 1] = (srcChannels == 2)? s[1] : ((srcChannels == 4)? s[3] : 255);
+        }
+
+        result = true;
+    }
+    else if ((srcChannels > 0) && ((dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+        (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) || (dstFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)))
+    {
+        // 8-bit to packed 16-bit: channels rounded to target bits, round(c/255*max) == (c*max + 127)/255
+        const unsigned char *in = (const unsigned char *)src + offset*srcChannels;
+        unsigned short *out = (unsigned short *)dst + offset;
+
+#if defined(RL_SIMD_SSE2)
+        if (srcChannels == 4)
+        {
+            // Channels are extended to 16-bit lanes, rounded with (x + 1 + (x >> 8)) >> 8 == x/255 (x < 65535)
+            // and combined by multiply-add with per-channel shift factors, 8 pixels per iteration
+            __m128i scale = _mm_setr_epi16(31, 63, 31, 0, 31, 63, 31, 0);
+            __m128i shift = _mm_setr_epi16(2048, 32, 1, 0, 2048, 32, 1, 0);
+            __m128i alphaBit = _mm_setzero_si128();
+
+            if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+            {
+                scale = _mm_setr_epi16(31, 31, 31, 0, 31, 31, 31, 0);
+                shift = _mm_setr_epi16(2048, 64, 2, 1, 2048, 64, 2, 1);
+                alphaBit = _mm_setr_epi16(0, 0, 0, 1, 0, 0, 0, 1);
+            }
+            else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)
+            {
+                scale = _mm_set1_epi16(15);
+                shift = _mm_setr_epi16(4096, 256, 16, 1, 4096, 256, 16, 1);
+            }
+
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i one = _mm_set1_epi16(1);
+            const __m128i bias = _mm_set1_epi16(127);
+            const __m128i threshold = _mm_set1_epi16(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD);
+            const __m128i signBias32 = _mm_set1_epi32(0x8000);
+            const __m128i signBias16 = _mm_set1_epi16((short)0x8000);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i p0 = _mm_loadu_si128((const __m128i *)(in + i*4));
+                __m128i p1 = _mm_loadu_si128((const __m128i *)(in + i*4 + 16));
+                __m128i channels[4] = { _mm_unpacklo_epi8(p0, zero), _mm_unpackhi_epi8(p0, zero), _mm_unpacklo_epi8(p1, zero), _mm_unpackhi_epi8(p1, zero) };
+                __m128i packed[4] = { 0 };
+
+                for (int k = 0; k < 4; k++)
+                {
+                    __m128i v = _mm_add_epi16(_mm_mullo_epi16(channels[k], scale), bias);
+                    v = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, one), _mm_srli_epi16(v, 8)), 8);
+                    v = _mm_or_si128(v, _mm_and_si128(_mm_cmpgt_epi16(channels[k], threshold), alphaBit));
+                    v = _mm_madd_epi16(v, shift);                       // 32-bit lanes: r|g, b|a, r|g, b|a
+                    v = _mm_add_epi32(v, _mm_srli_epi64(v, 32));        // Pixels values in lanes 0 and 2
+                    packed[k] = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 2, 0));
+                }
+
+                // NOTE: SSE2 only provides signed saturation packing, values are biased to signed range
+                __m128i lo = _mm_sub_epi32(_mm_unpacklo_epi64(packed[0], packed[1]), signBias32);
+                __m128i hi = _mm_sub_epi32(_mm_unpacklo_epi64(packed[2], packed[3]), signBias32);
+                _mm_storeu_si128((__m128i *)(out + i), _mm_add_epi16(_mm_packs_epi32(lo, hi), signBias16));
+            }
+        }
+#elif defined(RL_SIMD_NEON)
+        if (srcChannels == 4)
+        {
+            // Channels deinterleaved and extended to 16-bit lanes, rounded with (x + 1 + (x >> 8)) >> 8 == x/255 (x < 65535),
+            // 16 pixels per iteration
+            unsigned char scale[4] = { 31, 63, 31, 0 };
+            short shift[4] = { 11, 5, 0, 0 };
+
+            if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) { scale[1] = 31; shift[1] = 6; shift[2] = 1; }
+            else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)
+            {
+                scale[0] = 15; scale[1] = 15; scale[2] = 15; scale[3] = 15;
+                shift[0] = 12; shift[1] = 8; shift[2] = 4; shift[3] = 0;
+            }
+
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x4_t rgba = vld4q_u8(in + i*4);
+
+                for (int h = 0; h < 2; h++)
+                {
+                    uint16x8_t value = vdupq_n_u16(0);
+
+                    for (int k = 0; k < 4; k++)
+                    {
+                        uint8x8_t channel = (h == 0)? vget_low_u8(rgba.val[k]) : vget_high_u8(rgba.val[k]);
+                        uint16x8_t v = vmlal_u8(vdupq_n_u16(127), channel, vdup_n_u8(scale[k]));
+                        v = vshrq_n_u16(vaddq_u16(vaddq_u16(v, vdupq_n_u16(1)), vshrq_n_u16(v, 8)), 8);
+                        value = vorrq_u16(value, vshlq_u16(v, vdupq_n_s16(shift[k])));
+                    }
+
+                    if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                    {
+                        uint8x8_t alpha = (h == 0)? vget_low_u8(rgba.val[3]) : vget_high_u8(rgba.val[3]);
+                        value = vorrq_u16(value, vshrq_n_u16(vmovl_u8(vcgt_u8(alpha, vdup_n_u8(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD))), 7));
+                    }
+
+                    vst1q_u16(out + i + h*8, value);
+                }
+            }
+        }
+#endif
+        for (; i < count; i++)
+        {
+            const unsigned char *s = in + i*srcChannels;
+            int r = s[0], g = s[0], b = s[0], a = 255;
+
+            if (srcChannels >= 3) { g = s[1]; b = s[2]; }
+            if (srcChannels == 2) a = s[1];
+            else if (srcChannels == 4) a = s[3];
+
+            if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) out[i] = (unsigned short)(((r*31 + 127)/255) << 11 | ((g*63 + 127)/255) << 5 | ((b*31 + 127)/255));
+            else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) out[i] = (unsigned short)(((r*31 + 127)/255) << 11 | ((g*31 + 127)/255) << 6 | ((b*31 + 127)/255) << 1 | ((a > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0));
+            else out[i] = (unsigned short)(((r*15 + 127)/255) << 12 | ((g*15 + 127)/255) << 8 | ((b*15 + 127)/255) << 4 | ((a*15 + 127)/255));
+        }
+
+        result = true;
+    }
+    else if (((srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) || (srcFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)) &&
+        ((dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)))
+    {
+        // Packed 16-bit to RGB/RGBA 8-bit: lookup tables computed with generic path expressions (truncated)
+        unsigned char lut4[16] = { 0 };
+        unsigned char lut5[32] = { 0 };
+        unsigned char lut6[64] = { 0 };
+
+        for (int k = 0; k < 16; k++) lut4[k] = (unsigned char)((float)k*(1.0f/15)*255.0f);
+        for (int k = 0; k < 32; k++) lut5[k] = (unsigned char)((float)k*(1.0f/31)*255.0f);
+        for (int k = 0; k < 64; k++) lut6[k] = (unsigned char)((float)k*(1.0f/63)*255.0f);
+
+        int dstChannels = (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 3;
+        const unsigned short *in = (const unsigned short *)src + offset;
+        unsigned char *out = (unsigned char *)dst + offset*dstChannels;
+
+        for (; i < count; i++)
+        {
+            unsigned short pixel = in[i];
+            unsigned char *d = out + i*dstChannels;
+            unsigned char a = 255;
+
+            if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+            {
+                d[0] = lut5[pixel >> 11];
+                d[1] = lut6[(pixel >> 5) & 0x3f];
+                d[2] = lut5[pixel & 0x1f];
+            }
+            else if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+            {
+                d[0] = lut5[pixel >> 11];
+                d[1] = lut5[(pixel >> 6) & 0x1f];
+                d[2] = lut5[(pixel >> 1) & 0x1f];
+                a = (pixel & 0x1)? 255 : 0;
+            }
+            else
+            {
+                d[0] = lut4[pixel >> 12];
+                d[1] = lut4[(pixel >> 8) & 0xf];
+                d[2] = lut4[(pixel >> 4) & 0xf];
+                a = lut4[pixel & 0xf];
+            }
+
+            if (dstChannels == 4) d[3] = a;
+        }
+
+        result = true;
+    }
+    else if (((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) ||
+        ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32)))
+    {
+        // 8-bit to 32-bit float, same channels layout: converted per channel
+        int channels = (dstFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)? 4 : 3;
+        const unsigned char *in = (const unsigned char *)src + offset*channels;
+        float *out = (float *)dst + offset*channels;
+        int valueCount = count*channels;
+
+#if defined(RL_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 divisor = _mm_set1_ps(255.0f);
+
+        for (; (i + 16) <= valueCount; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i *)(in + i));
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+            _mm_storeu_ps(out + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), divisor));
+            _mm_storeu_ps(out + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), divisor));
+            _mm_storeu_ps(out + i + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), divisor));
+            _mm_storeu_ps(out + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), divisor));
+        }
+#endif
+        for (; i < valueCount; i++) out[i] = (float)in[i]/255.0f;
+
+        result = true;
+    }
+    else if (((srcFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) ||
+        ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8)))
+    {
+        // 32-bit float to 8-bit, same channels layout: converted per channel (truncated)
+        // NOTE: SIMD path saturates values out of [0.0f..1.0f] range
+        int channels = (srcFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)? 4 : 3;
+        const float *in = (const float *)src + offset*channels;
+        unsigned char *out = (unsigned char *)dst + offset*channels;
+        int valueCount = count*channels;
+
+#if defined(RL_SIMD_SSE2)
+        const __m128 scale = _mm_set1_ps(255.0f);
+
+        for (; (i + 16) <= valueCount; i += 16)
+        {
+            __m128i v0 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in + i), scale));
+            __m128i v1 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in + i + 4), scale));
+            __m128i v2 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in + i + 8), scale));
+            __m128i v3 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in + i + 12), scale));
+
+            _mm_storeu_si128((__m128i *)(out + i), _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+        }
+#endif
+        for (; i < valueCount; i++) out[i] = (unsigned char)(in[i]*255.0f);
+
+        result = true;
+    }
+
+    return result;
+}
+
+// Convert image rows range [start, end), ImageFormat() parallel-for callback
+// NOTE: Formats pairs without direct kernel are converted through normalized Vector4 batches
+static void ConvertPixelsRange(int start, int end, void *userData)
+{
+    ImageFormatData *conversion = (ImageFormatData *)userData;
+    int offset = start*conversion->width;
+    int count = (end - start)*conversion->width;
+
+    if (!ConvertPixelsDirect(conversion->src, conversion->srcFormat, conversion->dst, conversion->dstFormat, offset, count))
+    {
+        Vector4 pixels[IMAGE_FORMAT_BATCH_PIXELS];
+
+        for (int i = 0; i < count; i += IMAGE_FORMAT_BATCH_PIXELS)
+        {
+            int batchCount = ((count - i) < IMAGE_FORMAT_BATCH_PIXELS)? (count - i) : IMAGE_FORMAT_BATCH_PIXELS;
+
+            GetPixelsNormalized(conversion->src, conversion->srcFormat, offset + i, batchCount, pixels);
+            SetPixelsNormalized(conversion->dst, conversion->dstFormat, offset + i, batchCount, pixels);
+        }
+    }
+}
+
+// Run image rows ranges callback, split in rows bands across job workers for large images
+// NOTE: Bands are sized to fit in cache, callback must only access its own rows range
+static void ProcessImageRows(int width, int height, ParallelForCallback callback, void *userData)
+{
+    if ((width*height) >= IMAGE_PARALLEL_MIN_PIXELS)
+    {
+        int bandRows = IMAGE_PARALLEL_BAND_PIXELS/width;
+
+        ParallelFor(height, (bandRows > 0)? bandRows : 1, callback, userData);
+    }
+    else callback(0, height, userData);
+}
+
+// Apply image process stages to pixels
+static void ProcessPixels(Color *pixels, int count, const ImageProcessStage *stages, int stageCount)
+{
+    for (int s = 0; s < stageCount; s++)
+    {
+        const ImageProcessOp *op = stages[s].op;
+
+        if (op == NULL)
+        {
+            const unsigned char (*table)[256] = stages[s].table;
+
+            for (int i = 0; i < count; i++)
+            {
+                pixels[i].r = table[0][pixels[i].r];
+                pixels[i].g = table[1][pixels[i].g];
+                pixels[i].b = table[2][pixels[i].b];
+                pixels[i].a = table[3][pixels[i].a];
+            }
+        }
+        else if (op->type == IMAGE_PROCESS_GRAYSCALE)
+        {
+            // NOTE: Same gray value than ImageFormat() to PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char gray = (unsigned char)((((float)pixels[i].r/255.0f)*0.299f + ((float)pixels[i].g/255.0f)*0.587f + ((float)pixels[i].b/255.0f)*0.114f)*255.0f);
+
+                pixels[i].r = gray;
+                pixels[i].g = gray;
+                pixels[i].b = gray;
+            }
+        }
+        else if (op->type == IMAGE_PROCESS_REPLACE)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                if ((pixels[i].r == op->color.r) &&
+                    (pixels[i].g == op->color.g) &&
+                    (pixels[i].b == op->color.b) &&
+                    (pixels[i].a == op->color.a)) pixels[i] = op->replace;
+            }
+        }
+        else if (op->type == IMAGE_PROCESS_ALPHA_PREMULTIPLY)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                if (pixels[i].a == 0)
+                {
+                    pixels[i].r = 0;
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                }
+                else if (pixels[i].a < 255)
+                {
+                    float alpha = (float)pixels[i].a/255.0f;
+                    pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+                    pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+                    pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+                }
+            }
+        }
+    }
+}
+
+// Process image rows range [start, end), packed rows processed as a single span
+static void ProcessPixelsRange(int start, int end, void *userData)
+{
+    ImageProcessData *process = (ImageProcessData *)userData;
+
+    if (process->stride == GetPixelDataSize(process->width, 1, process->format))
+    {
+        ProcessPixelsSpan(process, process->data + start*process->stride, (end - start)*process->width);
+    }
+    else
+    {
+        for (int y = start; y < end; y++) ProcessPixelsSpan(process, process->data + y*process->stride, process->width);
+    }
+}
+
+// Process contiguous pixels span, pixels processed in place (R8G8B8A8) or by batches
+// NOTE: Batches are written back with the same conversion than ImageFormat() from R8G8B8A8
+static void ProcessPixelsSpan(const ImageProcessData *process, unsigned char *data, int count)
+{
+    if (process->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        Color *pixels = (Color *)data;
+
+        for (int i = 0; i < count; i += IMAGE_PROCESS_BATCH_PIXELS)
+        {
+            ProcessPixels(pixels + i, ((count - i) < IMAGE_PROCESS_BATCH_PIXELS)? (count - i) : IMAGE_PROCESS_BATCH_PIXELS, process->stages, process->stageCount);
+        }
+    }
+    else
+    {
+        int bytesPerPixel = GetPixelDataSize(1, 1, process->format);
+        Color pixels[IMAGE_PROCESS_BATCH_PIXELS];
+        Vector4 normalized[IMAGE_PROCESS_BATCH_PIXELS];
+
+        for (int i = 0; i < count; i += IMAGE_PROCESS_BATCH_PIXELS)
+        {
+            int batchCount = ((count - i) < IMAGE_PROCESS_BATCH_PIXELS)? (count - i) : IMAGE_PROCESS_BATCH_PIXELS;
+            unsigned char *batch = data + i*bytesPerPixel;
+
+            GetPixelsColor(batch, process->format, batchCount, pixels);
+            ProcessPixels(pixels, batchCount, process->stages, process->stageCount);
+
+            if (!ConvertPixelsDirect(pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, batch, process->format, 0, batchCount))
+            {
+                GetPixelsNormalized(pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 0, batchCount, normalized);
+                SetPixelsNormalized(batch, process->format, 0, batchCount, normalized);
+            }
+        }
+    }
+}
+
+// Blur image with separable box filter passes (GAUSSIAN_BLUR_ITERATIONS per direction), on premultiplied alpha colors
+// NOTE: Image is blurred by rows, transposed and blurred by rows again (cache friendly vertical pass),
+// rows are split across job workers for large images
+static void BlurImageBoxes(Image *image, int radius, float alpha)
+{
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Image blur not supported for compressed image formats");
+        return;
+    }
+
+    int format = image->format;
+    int mipmaps = image->mipmaps;
+
+    image->mipmaps = 1;     // Mipmaps regenerated once blurred
+    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    Color *pixels = (Color *)image->data;
+    Color *transposed = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+
+    // Horizontal passes, alpha premultiplied on rows load
+    ImageBlurData blur = { pixels, image->width, radius, alpha, true, false };
+    ProcessImageRows(image->width, image->height, BlurPixelsRange, &blur);
+
+    ImageTransposeData transpose = { pixels, transposed, image->width, image->height };
+    ProcessImageRows(image->height, image->width, TransposePixelsRange, &transpose);
+
+    // Vertical passes (transposed image rows), alpha reversed on rows store
+    blur = (ImageBlurData){ transposed, image->height, radius, alpha, false, true };
+    ProcessImageRows(image->height, image->width, BlurPixelsRange, &blur);
+
+    transpose = (ImageTransposeData){ transposed, pixels, image->height, image->width };
+    ProcessImageRows(image->width, image->height, TransposePixelsRange, &transpose);
+
+    RL_FREE(transposed);
+
+    ImageFormat(image, format);
+
+    if (mipmaps > 1) ImageMipmaps(image);
+}
+
+// Blur pixels with one box filter pass: window [x - radius, x + radius] plus end taps weighted by alpha
+// NOTE: Window is clipped to row limits and normalized by the weight of valid pixels, window sums are
+// updated incrementally (running sums), channels are processed together (SIMD when available)
+static void BlurPixelsRow(const Color *src, Color *dst, int count, int radius, float alpha)
+{
+    int last = count - 1;
+    int interiorEnd = count - radius - 1;       // Interior pixels (window and end taps inside row): (radius, interiorEnd)
+    float interiorScale = 1.0f/((float)(2*radius + 1) + 2.0f*alpha);
+
+#if defined(RL_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 alphaScale = _mm_set1_ps(alpha);
+    #define BLUR_LOAD(color) _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)((color).r | ((color).g << 8) | ((color).b << 16) | ((unsigned int)(color).a << 24))), zero), zero)
+
+    __m128i sum = zero;
+    for (int i = 0; (i <= radius) && (i <= last); i++) sum = _mm_add_epi32(sum, BLUR_LOAD(src[i]));
+
+    for (int x = 0; x < count; x++)
+    {
+        __m128i right = zero;
+        __m128 value = _mm_cvtepi32_ps(sum);
+        __m128 scale = _mm_set1_ps(interiorScale);
+
+        if ((x > radius) && (x < interiorEnd))
+        {
+            right = BLUR_LOAD(src[x + radius + 1]);
+
+            if (alpha > 0.0f) value = _mm_add_ps(value, _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(BLUR_LOAD(src[x - radius - 1]), right)), alphaScale));
+
+            sum = _mm_sub_epi32(_mm_add_epi32(sum, right), BLUR_LOAD(src[x - radius]));
+        }
+        else
+        {
+            // Edge pixels: window clipped to row, weight of valid pixels computed
+            int first = x - radius;
+            int end = x + radius;
+            int windowCount = ((end < last)? end : last) - ((first > 0)? first : 0) + 1;
+            __m128i taps = zero;
+            float weight = (float)windowCount;
+
+            if ((end + 1) <= last) right = BLUR_LOAD(src[end + 1]);
+
+            if (alpha > 0.0f)
+            {
+                if ((first - 1) >= 0) { taps = BLUR_LOAD(src[first - 1]); weight += alpha; }
+                if ((end + 1) <= last) { taps = _mm_add_epi32(taps, right); weight += alpha; }
+                value = _mm_add_ps(value, _mm_mul_ps(_mm_cvtepi32_ps(taps), alphaScale));
+            }
+
+            scale = _mm_set1_ps(1.0f/weight);
+            sum = _mm_add_epi32(sum, right);
+            if (first >= 0) sum = _mm_sub_epi32(sum, BLUR_LOAD(src[first]));
+        }
+
+        __m128i result = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), half));
+        result = _mm_packs_epi32(result, result);
+        int packed = _mm_cvtsi128_si32(_mm_packus_epi16(result, result));
+        memcpy(&dst[x], &packed, sizeof(Color));
+    }
+
+    #undef BLUR_LOAD
+#elif defined(RL_SIMD_NEON)
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t alphaScale = vdupq_n_f32(alpha);
+    #define BLUR_LOAD(color) vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32((color).r | ((color).g << 8) | ((color).b << 16) | ((unsigned int)(color).a << 24)))))))
+
+    int32x4_t sum = vdupq_n_s32(0);
+    for (int i = 0; (i <= radius) && (i <= last); i++) sum = vaddq_s32(sum, BLUR_LOAD(src[i]));
+
+    for (int x = 0; x < count; x++)
+    {
+        int32x4_t right = vdupq_n_s32(0);
+        float32x4_t value = vcvtq_f32_s32(sum);
+        float32x4_t scale = vdupq_n_f32(interiorScale);
+
+        if ((x > radius) && (x < interiorEnd))
+        {
+            right = BLUR_LOAD(src[x + radius + 1]);
+
+            if (alpha > 0.0f) value = vaddq_f32(value, vmulq_f32(vcvtq_f32_s32(vaddq_s32(BLUR_LOAD(src[x - radius - 1]), right)), alphaScale));
+
+            sum = vsubq_s32(vaddq_s32(sum, right), BLUR_LOAD(src[x - radius]));
+        }
+        else
+        {
+            // Edge pixels: window clipped to row, weight of valid pixels computed
+            int first = x - radius;
+            int end = x + radius;
+            int windowCount = ((end < last)? end : last) - ((first > 0)? first : 0) + 1;
+            int32x4_t taps = vdupq_n_s32(0);
+            float weight = (float)windowCount;
+
+            if ((end + 1) <= last) right = BLUR_LOAD(src[end + 1]);
+
+            if (alpha > 0.0f)
+            {
+                if ((first - 1) >= 0) { taps = BLUR_LOAD(src[first - 1]); weight += alpha; }
+                if ((end + 1) <= last) { taps = vaddq_s32(taps, right); weight += alpha; }
+                value = vaddq_f32(value, vmulq_f32(vcvtq_f32_s32(taps), alphaScale));
+            }
+
+            scale = vdupq_n_f32(1.0f/weight);
+            sum = vaddq_s32(sum, right);
+            if (first >= 0) sum = vsubq_s32(sum, BLUR_LOAD(src[first]));
+        }
+
+        uint16x4_t result = vmovn_u32(vcvtq_u32_f32(vaddq_f32(vmulq_f32(value, scale), half)));
+        uint32_t packed = vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(result, result))), 0);
+        memcpy(&dst[x], &packed, sizeof(Color));
+    }
+
+    #undef BLUR_LOAD
+#else
+    int sum[4] = { 0 };
+    for (int i = 0; (i <= radius) && (i <= last); i++)
+    {
+        sum[0] += src[i].r;
+        sum[1] += src[i].g;
+        sum[2] += src[i].b;
+        sum[3] += src[i].a;
+    }
+
+    for (int x = 0; x < count; x++)
+    {
+        int first = x - radius;
+        int end = x + radius;
+        int windowCount = ((end < last)? end : last) - ((first > 0)? first : 0) + 1;
+        float value[4] = { (float)sum[0], (float)sum[1], (float)sum[2], (float)sum[3] };
+        float weight = (float)windowCount;
+
+        if (alpha > 0.0f)
+        {
+            int taps[4] = { 0 };
+
+            if ((first - 1) >= 0) { taps[0] = src[first - 1].r; taps[1] = src[first - 1].g; taps[2] = src[first - 1].b; taps[3] = src[first - 1].a; weight += alpha; }
+            if ((end + 1) <= last) { taps[0] += src[end + 1].r; taps[1] += src[end + 1].g; taps[2] += src[end + 1].b; taps[3] += src[end + 1].a; weight += alpha; }
+
+            for (int c = 0; c < 4; c++) value[c] = value[c] + (float)taps[c]*alpha;
+        }
+
+        float scale = ((x > radius) && (x < interiorEnd))? interiorScale : 1.0f/weight;
+
+        dst[x].r = (unsigned char)(value[0]*scale + 0.5f);
+        dst[x].g = (unsigned char)(value[1]*scale + 0.5f);
+        dst[x].b = (unsigned char)(value[2]*scale + 0.5f);
+        dst[x].a = (unsigned char)(value[3]*scale + 0.5f);
+
+        if ((end + 1) <= last)
+        {
+            sum[0] += src[end + 1].r;
+            sum[1] += src[end + 1].g;
+            sum[2] += src[end + 1].b;
+            sum[3] += src[end + 1].a;
+        }
+
+        if (first >= 0)
+        {
+            sum[0] -= src[first].r;
+            sum[1] -= src[first].g;
+            sum[2] -= src[first].b;
+            sum[3] -= src[first].a;
+        }
+    }
+#endif
+}
+
+// Blur image rows range [start, end), ImageBlurGaussian() parallel-for callback
+static void BlurPixelsRange(int start, int end, void *userData)
+{
+    ImageBlurData *blur = (ImageBlurData *)userData;
+
+    // Rows are blurred between two row buffers, results stored back into image rows
+    Color *rows = (Color *)RL_MALLOC(2*blur->width*sizeof(Color));
+
+    for (int y = start; y < end; y++)
+    {
+        Color *pixels = blur->pixels + y*blur->width;
+        Color *src = rows;
+        Color *dst = rows + blur->width;
+
+        if (blur->premultiply)
+        {
+            for (int x = 0; x < blur->width; x++)
+            {
+                int a = pixels[x].a;
+                int r = pixels[x].r*a + 128;
+                int g = pixels[x].g*a + 128;
+                int b = pixels[x].b*a + 128;
+
+                src[x] = (Color){ (unsigned char)((r + (r >> 8)) >> 8), (unsigned char)((g + (g >> 8)) >> 8), (unsigned char)((b + (b >> 8)) >> 8), (unsigned char)a };
+            }
+        }
+        else memcpy(src, pixels, blur->width*sizeof(Color));
+
+        for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+        {
+            BlurPixelsRow(src, dst, blur->width, blur->radius, blur->alpha);
+
+            Color *temp = src;
+            src = dst;
+            dst = temp;
+        }
+
+        if (blur->unpremultiply)
+        {
+            for (int x = 0; x < blur->width; x++)
+            {
+                if (src[x].a == 0) pixels[x] = (Color){ 0, 0, 0, 0 };
+                else
+                {
+                    float scale = 255.0f/(float)src[x].a;
+
+                    pixels[x].r = (unsigned char)((float)src[x].r*scale + 0.5f);
+                    pixels[x].g = (unsigned char)((float)src[x].g*scale + 0.5f);
+                    pixels[x].b = (unsigned char)((float)src[x].b*scale + 0.5f);
+                    pixels[x].a = src[x].a;
+                }
+            }
+        }
+        else memcpy(pixels, src, blur->width*sizeof(Color));
+    }
+
+    RL_FREE(rows);
+}
+
+// Transpose pixels destination rows range [start, end) (source columns)
+// NOTE: Pixels are transposed by tiles, keeping source and destination lines in cache
+static void TransposePixelsRange(int start, int end, void *userData)
+{
+    ImageTransposeData *transpose = (ImageTransposeData *)userData;
+    const Color *src = transpose->src;
+    Color *dst = transpose->dst;
+    int srcWidth = transpose->srcWidth;
+    int srcHeight = transpose->srcHeight;
+
+    for (int tileY = start; tileY < end; tileY += IMAGE_TRANSPOSE_TILE_SIZE)
+    {
+        int tileEndY = ((tileY + IMAGE_TRANSPOSE_TILE_SIZE) < end)? (tileY + IMAGE_TRANSPOSE_TILE_SIZE) : end;
+
+        for (int tileX = 0; tileX < srcHeight; tileX += IMAGE_TRANSPOSE_TILE_SIZE)
+        {
+            int tileEndX = ((tileX + IMAGE_TRANSPOSE_TILE_SIZE) < srcHeight)? (tileX + IMAGE_TRANSPOSE_TILE_SIZE) : srcHeight;
+
+            for (int y = tileY; y < tileEndY; y++)
+            {
+                for (int x = tileX; x < tileEndX; x++) dst[y*srcHeight + x] = src[x*srcWidth + y];
+            }
+        }
+    }
+}
+
+// Copy pixels with source step in bytes, specialized for common pixel sizes
+static inline void CopyPixelsStrided(unsigned char *dst, const unsigned char *src, int srcStep, int count, int bytesPerPixel)
+{
+    switch (bytesPerPixel)
+    {
+        case 1: for (int i = 0; i < count; i++, src += srcStep) dst[i] = *src; break;
+        case 2: for (int i = 0; i < count; i++, src += srcStep) memcpy(dst + i*2, src, 2); break;
+        case 4: for (int i = 0; i < count; i++, src += srcStep) memcpy(dst + i*4, src, 4); break;
+        default: for (int i = 0; i < count; i++, src += srcStep) memcpy(dst + i*bytesPerPixel, src, bytesPerPixel); break;
+    }
+}
+
+// Rotate image by 90 degrees turns, destination rows range [start, end)
+// NOTE: Quarter turns are transpositions, pixels are moved by tiles keeping source and destination lines in cache
+static void RotateQuartersRange(int start, int end, void *userData)
+{
+    ImageRotateData *rotate = (ImageRotateData *)userData;
+    int bytesPerPixel = rotate->bytesPerPixel;
+    int srcStride = rotate->srcWidth*bytesPerPixel;
+    int dstStride = rotate->width*bytesPerPixel;
+
+    if (rotate->quarterTurns == 2)
+    {
+        // Destination rows are source rows reversed
+        for (int y = start; y < end; y++)
+        {
+            const unsigned char *src = rotate->src + (rotate->srcHeight - 1 - y)*srcStride + (rotate->srcWidth - 1)*bytesPerPixel;
+
+            CopyPixelsStrided(rotate->dst + y*dstStride, src, -bytesPerPixel, rotate->width, bytesPerPixel);
+        }
+
+        return;
+    }
+
+    // Destination rows are source columns: read bottom-up for clockwise turn, top-down for counter-clockwise turn
+    int srcStep = (rotate->quarterTurns == 1)? -srcStride : srcStride;
+
+    for (int tileY = start; tileY < end; tileY += IMAGE_TRANSPOSE_TILE_SIZE)
+    {
+        int tileEndY = ((tileY + IMAGE_TRANSPOSE_TILE_SIZE) < end)? (tileY + IMAGE_TRANSPOSE_TILE_SIZE) : end;
+
+        for (int tileX = 0; tileX < rotate->width; tileX += IMAGE_TRANSPOSE_TILE_SIZE)
+        {
+            int count = ((tileX + IMAGE_TRANSPOSE_TILE_SIZE) < rotate->width)? IMAGE_TRANSPOSE_TILE_SIZE : (rotate->width - tileX);
+            int srcRow = (rotate->quarterTurns == 1)? (rotate->srcHeight - 1 - tileX) : tileX;
+
+            for (int y = tileY; y < tileEndY; y++)
+            {
+                int srcColumn = (rotate->quarterTurns == 1)? y : (rotate->srcWidth - 1 - y);
+
+                CopyPixelsStrided(rotate->dst + y*dstStride + tileX*bytesPerPixel, rotate->src + srcRow*srcStride + srcColumn*bytesPerPixel, srcStep, count, bytesPerPixel);
+            }
+        }
+    }
+}
+
+// Rotate image by angle, destination rows range [start, end) bilinear sampled
+// NOTE: Destination rows are split in spans: pixels with all bilinear taps inside source image
+// are sampled by a tight loop, border pixels are sampled with taps clamped or extended for antialiasing
+static void RotateSampledRange(int start, int end, void *userData)
+{
+    ImageRotateData *rotate = (ImageRotateData *)userData;
+    int bytesPerPixel = rotate->bytesPerPixel;
+    Vector4 *row = (rotate->srcNormalized != NULL)? (Vector4 *)RL_MALLOC(rotate->width*sizeof(Vector4)) : NULL;
+
+    for (int y = start; y < end; y++)
+    {
+        // Source coordinates for destination pixel x: (baseX + x*cos, baseY - x*sin)
+        float baseX = (y - rotate->height/2.0f)*rotate->sinAngle - (rotate->width/2.0f)*rotate->cosAngle + rotate->srcWidth/2.0f;
+        float baseY = (y - rotate->height/2.0f)*rotate->cosAngle + (rotate->width/2.0f)*rotate->sinAngle + rotate->srcHeight/2.0f;
+
+        if (row != NULL)
+        {
+            SampleRotatedNormalized(rotate, baseX, baseY, row);
+            SetPixelsNormalized(rotate->dst, rotate->format, y*rotate->width, rotate->width, row);
+            continue;
+        }
+
+        // Interior span [first, last): source coordinates in [0, srcSize - 1) range,
+        // estimated from coordinates line and shrunk to pixels verified inside
+        float first = 0.0f;
+        float last = (float)rotate->width;
+        float bases[2] = { baseX, baseY };
+        float steps[2] = { rotate->cosAngle, -rotate->sinAngle };
+        int sizes[2] = { rotate->srcWidth, rotate->srcHeight };
+
+        for (int axis = 0; axis < 2; axis++)
+        {
+            if (steps[axis] != 0.0f)
+            {
+                float t0 = (0.0f - bases[axis])/steps[axis];
+                float t1 = ((sizes[axis] - 1) - bases[axis])/steps[axis];
+
+                if (t0 > t1) { float t = t0; t0 = t1; t1 = t; }
+                if (t0 > first) first = t0;
+                if (t1 < last) last = t1;
+            }
+            else if ((bases[axis] < 0.0f) || (bases[axis] >= (sizes[axis] - 1))) last = first;
+        }
+
+        int spanFirst = (first < last)? (int)ceilf(first) : 0;
+        int spanLast = (first < last)? (int)ceilf(last) : 0;
+
+        if (spanLast > rotate->width) spanLast = rotate->width;
+
+        while ((spanFirst < spanLast) && !IsRotatedInterior(rotate, baseX, baseY, spanFirst)) spanFirst++;
+        while ((spanLast > spanFirst) && !IsRotatedInterior(rotate, baseX, baseY, spanLast - 1)) spanLast--;
+        if (spanFirst == spanLast) spanFirst = spanLast = rotate->width;
+
+        unsigned char *dst = rotate->dst + y*rotate->width*bytesPerPixel;
+
+        SampleRotatedBorder(rotate, baseX, baseY, 0, spanFirst, dst);
+        SampleRotatedInterior(rotate, baseX, baseY, spanFirst, spanLast, dst);
+        SampleRotatedBorder(rotate, baseX, baseY, spanLast, rotate->width, dst);
+    }
+
+    RL_FREE(row);
+}
+
+// Check rotated destination pixel has all bilinear taps inside source image
+static inline bool IsRotatedInterior(const ImageRotateData *rotate, float baseX, float baseY, int x)
+{
+    float u = baseX + x*rotate->cosAngle;
+    float v = baseY - x*rotate->sinAngle;
+
+    return ((u >= 0.0f) && (u < (rotate->srcWidth - 1)) && (v >= 0.0f) && (v < (rotate->srcHeight - 1)));
+}
+
+// Sample rotated destination pixels range [first, last) with all bilinear taps inside source image (8-bit channels)
+static void SampleRotatedInterior(const ImageRotateData *rotate, float baseX, float baseY, int first, int last, unsigned char *dst)
+{
+    int srcWidth = rotate->srcWidth;
+    int bytesPerPixel = rotate->bytesPerPixel;
+
+    for (int x = first; x < last; x++)
+    {
+        float u = baseX + x*rotate->cosAngle;
+        float v = baseY - x*rotate->sinAngle;
+        int x1 = (int)u;
+        int y1 = (int)v;
+        int fx = (int)((u - x1)*128.0f + 0.5f);
+        int fy = (int)((v - y1)*128.0f + 0.5f);
+        const unsigned char *src = rotate->src + (y1*srcWidth + x1)*bytesPerPixel;
+
+#if defined(RL_SIMD_SSE2)
+        if (bytesPerPixel == 4)
+        {
+            // Tap pairs loaded per source row, channels interleaved as 16-bit pairs: r1 r2 g1 g2 b1 b2 a1 a2
+            __m128i zero = _mm_setzero_si128();
+            __m128i top = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)src), zero);
+            __m128i bottom = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(src + srcWidth*4)), zero);
+
+            top = _mm_unpacklo_epi16(top, _mm_srli_si128(top, 8));
+            bottom = _mm_unpacklo_epi16(bottom, _mm_srli_si128(bottom, 8));
+
+            __m128i sum = _mm_add_epi32(_mm_madd_epi16(top, _mm_set1_epi32(((fx*(128 - fy)) << 16) | ((128 - fx)*(128 - fy)))),
+                _mm_madd_epi16(bottom, _mm_set1_epi32(((fx*fy) << 16) | ((128 - fx)*fy))));
+            sum = _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << 13)), 14);
+            sum = _mm_packs_epi32(sum, sum);
+
+            int value = _mm_cvtsi128_si32(_mm_packus_epi16(sum, sum));
+            memcpy(dst + x*4, &value, 4);
+            continue;
+        }
+#elif defined(RL_SIMD_NEON)
+        if (bytesPerPixel == 4)
+        {
+            // Tap pairs loaded per source row, widened to 16-bit: low half first tap, high half second tap
+            uint16x8_t top = vmovl_u8(vld1_u8(src));
+            uint16x8_t bottom = vmovl_u8(vld1_u8(src + srcWidth*4));
+
+            uint32x4_t sum = vmull_n_u16(vget_low_u16(top), (uint16_t)((128 - fx)*(128 - fy)));
+            sum = vmlal_n_u16(sum, vget_high_u16(top), (uint16_t)(fx*(128 - fy)));
+            sum = vmlal_n_u16(sum, vget_low_u16(bottom), (uint16_t)((128 - fx)*fy));
+            sum = vmlal_n_u16(sum, vget_high_u16(bottom), (uint16_t)(fx*fy));
+
+            uint16x4_t value = vrshrn_n_u32(sum, 14);
+            uint8x8_t bytes = vmovn_u16(vcombine_u16(value, value));
+            vst1_lane_u32((uint32_t *)(dst + x*4), vreinterpret_u32_u8(bytes), 0);
+            continue;
+        }
+#endif
+        const unsigned char *below = src + srcWidth*bytesPerPixel;
+
+        for (int c = 0; c < bytesPerPixel; c++)
+        {
+            int top = src[c]*(128 - fx) + src[bytesPerPixel + c]*fx;
+            int bottom = below[c]*(128 - fx) + below[bytesPerPixel + c]*fx;
+
+            dst[x*bytesPerPixel + c] = (unsigned char)((top*(128 - fy) + bottom*fy + (1 << 13)) >> 14);
+        }
+    }
+}
+
+// Sample rotated destination pixels range [first, last) near source image borders (8-bit channels)
+// NOTE: Taps outside source image are clamped to image border, or transparent/zero for antialiasing
+static void SampleRotatedBorder(const ImageRotateData *rotate, float baseX, float baseY, int first, int last, unsigned char *dst)
+{
+    int srcWidth = rotate->srcWidth;
+    int srcHeight = rotate->srcHeight;
+    int bytesPerPixel = rotate->bytesPerPixel;
+    int alphaChannel = rotate->alpha? (bytesPerPixel - 1) : -1;
+    float minCoord = rotate->antialias? -1.0f : 0.0f;
+
+    for (int x = first; x < last; x++)
+    {
+        float u = baseX + x*rotate->cosAngle;
+        float v = baseY - x*rotate->sinAngle;
+
+        if ((u < minCoord) || (u >= srcWidth) || (v < minCoord) || (v >= srcHeight)) continue;
+
+        int x1 = (u < 0.0f)? -1 : (int)u;
+        int y1 = (v < 0.0f)? -1 : (int)v;
+        int fx = (int)((u - x1)*128.0f + 0.5f);
+        int fy = (int)((v - y1)*128.0f + 0.5f);
+        int weights[4] = { (128 - fx)*(128 - fy), fx*(128 - fy), (128 - fx)*fy, fx*fy };
+        int sum[4] = { 0 };
+
+        for (int t = 0; t < 4; t++)
+        {
+            int tapX = x1 + (t & 1);
+            int tapY = y1 + (t >> 1);
+            int clampedX = (tapX < 0)? 0 : ((tapX >= srcWidth)? (srcWidth - 1) : tapX);
+            int clampedY = (tapY < 0)? 0 : ((tapY >= srcHeight)? (srcHeight - 1) : tapY);
+            bool outside = rotate->antialias && ((clampedX != tapX) || (clampedY != tapY));
+
+            if (outside && (alphaChannel < 0)) continue;
+
+            const unsigned char *src = rotate->src + (clampedY*srcWidth + clampedX)*bytesPerPixel;
+
+            for (int c = 0; c < bytesPerPixel; c++)
+            {
+                if (!outside || (c != alphaChannel)) sum[c] += src[c]*weights[t];
+            }
+        }
+
+        for (int c = 0; c < bytesPerPixel; c++) dst[x*bytesPerPixel + c] = (unsigned char)((sum[c] + (1 << 13)) >> 14);
+    }
+}
+
+// Sample rotated destination row from normalized source pixels (formats not 8-bit per channel)
+// NOTE: Taps outside source image are clamped to image border, or transparent/zero for antialiasing
+static void SampleRotatedNormalized(const ImageRotateData *rotate, float baseX, float baseY, Vector4 *row)
+{
+    int srcWidth = rotate->srcWidth;
+    int srcHeight = rotate->srcHeight;
+    float minCoord = rotate->antialias? -1.0f : 0.0f;
+
+    for (int x = 0; x < rotate->width; x++)
+    {
+        float u = baseX + x*rotate->cosAngle;
+        float v = baseY - x*rotate->sinAngle;
+
+        row[x] = (Vector4){ 0 };
+
+        if ((u < minCoord) || (u >= srcWidth) || (v < minCoord) || (v >= srcHeight)) continue;
+
+        int x1 = (u < 0.0f)? -1 : (int)u;
+        int y1 = (v < 0.0f)? -1 : (int)v;
+        float fu = u - x1;
+        float fv = v - y1;
+        float weights[4] = { (1.0f - fu)*(1.0f - fv), fu*(1.0f - fv), (1.0f - fu)*fv, fu*fv };
+
+        for (int t = 0; t < 4; t++)
+        {
+            int tapX = x1 + (t & 1);
+            int tapY = y1 + (t >> 1);
+            int clampedX = (tapX < 0)? 0 : ((tapX >= srcWidth)? (srcWidth - 1) : tapX);
+            int clampedY = (tapY < 0)? 0 : ((tapY >= srcHeight)? (srcHeight - 1) : tapY);
+            bool outside = rotate->antialias && ((clampedX != tapX) || (clampedY != tapY));
+
+            if (outside && !rotate->alpha) continue;
+
+            Vector4 tap = rotate->srcNormalized[clampedY*srcWidth + clampedX];
+
+            row[x].x += tap.x*weights[t];
+            row[x].y += tap.y*weights[t];
+            row[x].z += tap.z*weights[t];
+            if (!outside) row[x].w += tap.w*weights[t];
+        }
+    }
+}
+
+// Accumulate weighted pixels: accum[i] += pixels[i]*weight
+static void AccumulatePixels(Vector4 *accum, const Vector4 *pixels, int count, float weight)
+{
+#if defined(RL_SIMD_SSE2)
+    __m128 w = _mm_set1_ps(weight);
+
+    for (int i = 0; i < count; i++) _mm_storeu_ps(&accum[i].x, _mm_add_ps(_mm_loadu_ps(&accum[i].x), _mm_mul_ps(_mm_loadu_ps(&pixels[i].x), w)));
+#elif defined(RL_SIMD_NEON)
+    float32x4_t w = vdupq_n_f32(weight);
+
+    for (int i = 0; i < count; i++) vst1q_f32(&accum[i].x, vaddq_f32(vld1q_f32(&accum[i].x), vmulq_f32(vld1q_f32(&pixels[i].x), w)));
+#else
+    for (int i = 0; i < count; i++)
+    {
+        accum[i].x += pixels[i].x*weight;
+        accum[i].y += pixels[i].y*weight;
+        accum[i].z += pixels[i].z*weight;
+        accum[i].w += pixels[i].w*weight;
+    }
+#endif
+}
+
+// Store convolution results into image pixels range, clamped for 8-bit per channel formats
+static void StoreConvolutionPixels(ImageConvolutionData *convolution, Vector4 *pixels, int offset, int count)
+{
+    if (convolution->clamp)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            pixels[i].x = (pixels[i].x < 0.0f)? 0.0f : ((pixels[i].x > 1.0f)? 1.0f : pixels[i].x);
+            pixels[i].y = (pixels[i].y < 0.0f)? 0.0f : ((pixels[i].y > 1.0f)? 1.0f : pixels[i].y);
+            pixels[i].z = (pixels[i].z < 0.0f)? 0.0f : ((pixels[i].z > 1.0f)? 1.0f : pixels[i].z);
+            pixels[i].w = (pixels[i].w < 0.0f)? 0.0f : ((pixels[i].w > 1.0f)? 1.0f : pixels[i].w);
+        }
+    }
+
+    SetPixelsNormalized(convolution->data, convolution->format, offset, count, pixels);
+}
+
+// Load convolution padded rows range [start, end), source pixels normalized, zero outside image
+static void LoadConvolutionRowsRange(int start, int end, void *userData)
+{
+    ImageConvolutionData *convolution = (ImageConvolutionData *)userData;
+    int anchor = convolution->kernelWidth/2;
+
+    for (int py = start; py < end; py++)
+    {
+        Vector4 *row = convolution->padded + py*convolution->paddedWidth;
+        int y = py - anchor;
+
+        memset(row, 0, convolution->paddedWidth*sizeof(Vector4));
+
+        if ((y >= 0) && (y < convolution->height)) GetPixelsNormalized(convolution->data, convolution->format, y*convolution->width, convolution->width, row + anchor);
+    }
+}
+
+// Convolve padded rows range [start, end) with kernel row (separable kernel horizontal pass)
+static void ConvolveRowsRange(int start, int end, void *userData)
+{
+    ImageConvolutionData *convolution = (ImageConvolutionData *)userData;
+
+    for (int py = start; py < end; py++)
+    {
+        Vector4 *row = convolution->rows + py*convolution->width;
+        const Vector4 *padded = convolution->padded + py*convolution->paddedWidth;
+
+        memset(row, 0, convolution->width*sizeof(Vector4));
+
+        for (int j = 0; j < convolution->kernelWidth; j++)
+        {
+            if (convolution->kernelRow[j] != 0.0f) AccumulatePixels(row, padded + j, convolution->width, convolution->kernelRow[j]);
+        }
+    }
+}
+
+// Convolve image rows range [start, end) with kernel column (separable kernel vertical pass)
+static void ConvolveColumnsRange(int start, int end, void *userData)
+{
+    ImageConvolutionData *convolution = (ImageConvolutionData *)userData;
+    Vector4 accum[IMAGE_CONVOLUTION_BATCH_PIXELS];
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < convolution->width; x += IMAGE_CONVOLUTION_BATCH_PIXELS)
+        {
+            int count = ((convolution->width - x) < IMAGE_CONVOLUTION_BATCH_PIXELS)? (convolution->width - x) : IMAGE_CONVOLUTION_BATCH_PIXELS;
+
+            memset(accum, 0, count*sizeof(Vector4));
+
+            for (int i = 0; i < convolution->kernelWidth; i++)
+            {
+                if (convolution->kernelColumn[i] != 0.0f) AccumulatePixels(accum, convolution->rows + (y + i)*convolution->width + x, count, convolution->kernelColumn[i]);
+            }
+
+            StoreConvolutionPixels(convolution, accum, y*convolution->width + x, count);
+        }
+    }
+}
+
+// Convolve image rows range [start, end) with full kernel (direct convolution)
+// NOTE: Pixels are accumulated by batches, one weighted padded row segment per kernel element
+static void ConvolveDirectRange(int start, int end, void *userData)
+{
+    ImageConvolutionData *convolution = (ImageConvolutionData *)userData;
+    int kernelWidth = convolution->kernelWidth;
+    Vector4 accum[IMAGE_CONVOLUTION_BATCH_PIXELS];
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < convolution->width; x += IMAGE_CONVOLUTION_BATCH_PIXELS)
+        {
+            int count = ((convolution->width - x) < IMAGE_CONVOLUTION_BATCH_PIXELS)? (convolution->width - x) : IMAGE_CONVOLUTION_BATCH_PIXELS;
+
+            memset(accum, 0, count*sizeof(Vector4));
+
+            for (int i = 0; i < kernelWidth; i++)
+            {
+                const Vector4 *padded = convolution->padded + (y + i)*convolution->paddedWidth + x;
+
+                for (int j = 0; j < kernelWidth; j++)
+                {
+                    if (convolution->kernel[i*kernelWidth + j] != 0.0f) AccumulatePixels(accum, padded + j, count, convolution->kernel[i*kernelWidth + j]);
+                }
+            }
+
+            StoreConvolutionPixels(convolution, accum, y*convolution->width + x, count);
+        }
+    }
+}
+
+// Convolve image tiles range [start, end) by FFT (overlap-save)
+// NOTE: Tile input (fftSize x fftSize padded pixels) is correlated with the kernel as product of the tile
+// spectrum by the kernel spectrum conjugate, channels are transformed in pairs (real, imaginary)
+static void ConvolveTilesRange(int start, int end, void *userData)
+{
+    ImageConvolutionData *convolution = (ImageConvolutionData *)userData;
+    int size = convolution->fftSize;
+    float scale = 1.0f/(float)(size*size);
+    float *planes = (float *)RL_MALLOC(2*2*size*size*sizeof(float));
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(convolution->tileSize*sizeof(Vector4));
+
+    for (int tile = start; tile < end; tile++)
+    {
+        int tileX = (tile%convolution->tilesX)*convolution->tileSize;
+        int tileY = (tile/convolution->tilesX)*convolution->tileSize;
+
+        for (int p = 0; p < 2; p++)
+        {
+            float *plane = planes + p*2*size*size;
+
+            for (int ty = 0; ty < size; ty++)
+            {
+                int py = tileY + ty;
+
+                for (int tx = 0; tx < size; tx++)
+                {
+                    int px = tileX + tx;
+                    const float *pixel = ((px < convolution->paddedWidth) && (py < convolution->paddedHeight))? &convolution->padded[py*convolution->paddedWidth + px].x : NULL;
+
+                    plane[2*(ty*size + tx)] = (pixel != NULL)? pixel[2*p] : 0.0f;
+                    plane[2*(ty*size + tx) + 1] = (pixel != NULL)? pixel[2*p + 1] : 0.0f;
+                }
+            }
+
+            ComputeFFT2D(plane, size, convolution->twiddles, false);
+
+            for (int i = 0; i < size*size; i++)
+            {
+                float re = plane[2*i];
+                float im = plane[2*i + 1];
+                float kre = convolution->spectrum[2*i];
+                float kim = convolution->spectrum[2*i + 1];
+
+                plane[2*i] = re*kre + im*kim;
+                plane[2*i + 1] = im*kre - re*kim;
+            }
+
+            ComputeFFT2D(plane, size, convolution->twiddles, true);
+        }
+
+        int countX = ((convolution->width - tileX) < convolution->tileSize)? (convolution->width - tileX) : convolution->tileSize;
+        int countY = ((convolution->height - tileY) < convolution->tileSize)? (convolution->height - tileY) : convolution->tileSize;
+
+        for (int ty = 0; ty < countY; ty++)
+        {
+            for (int tx = 0; tx < countX; tx++)
+            {
+                int i = 2*(ty*size + tx);
+
+                pixels[tx] = (Vector4){ planes[i]*scale, planes[i + 1]*scale, planes[2*size*size + i]*scale, planes[2*size*size + i + 1]*scale };
+            }
+
+            StoreConvolutionPixels(convolution, pixels, (tileY + ty)*convolution->width + tileX, countX);
+        }
+    }
+
+    RL_FREE(pixels);
+    RL_FREE(planes);
+}
+
+// Compute in-place radix-2 complex FFT (interleaved real, imaginary), inverse is not scaled
+static void ComputeFFT(float *data, int size, int stride, const float *twiddles, bool inverse)
+{
+    // Bit reversal permutation
+    for (int i = 1, j = 0; i < size; i++)
+    {
+        int bit = size >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+        {
+            float *a = data + 2*i*stride;
+            float *b = data + 2*j*stride;
+            float re = a[0];
+            float im = a[1];
+
+            a[0] = b[0];
+            a[1] = b[1];
+            b[0] = re;
+            b[1] = im;
+        }
+    }
+
+    // Butterflies, twiddle factors table defined for full size
+    for (int length = 2; length <= size; length <<= 1)
+    {
+        int half = length >> 1;
+        int step = size/length;
+
+        for (int i = 0; i < size; i += length)
+        {
+            for (int k = 0; k < half; k++)
+            {
+                float wre = twiddles[2*k*step];
+                float wim = inverse? -twiddles[2*k*step + 1] : twiddles[2*k*step + 1];
+                float *a = data + 2*(i + k)*stride;
+                float *b = data + 2*(i + k + half)*stride;
+                float re = b[0]*wre - b[1]*wim;
+                float im = b[0]*wim + b[1]*wre;
+
+                b[0] = a[0] - re;
+                b[1] = a[1] - im;
+                a[0] += re;
+                a[1] += im;
+            }
+        }
+    }
+}
+
+// Compute in-place 2D complex FFT (size x size), rows then columns
+static void ComputeFFT2D(float *data, int size, const float *twiddles, bool inverse)
+{
+    for (int i = 0; i < size; i++) ComputeFFT(data + 2*i*size, size, 1, twiddles, inverse);
+    for (int i = 0; i < size; i++) ComputeFFT(data + 2*i, size, size, twiddles, inverse);
+}
+
+// Resize image splits range [start, end)
+static void ResizeImageSplits(int start, int end, void *userData)
+{
+    ImageResizeData *resizeData = (ImageResizeData *)userData;
+
+    stbir_resize_extended_split(resizeData->resize, start, end - start);
+}
+
+// Resize input rows callback, source pixels converted to R8G8B8A8
+static const void *ResizeImageInput(void *output, const void *input, int count, int x, int y, void *userData)
+{
+    ImageResizeData *resizeData = (ImageResizeData *)userData;
+
+    (void)input;
+
+    // NOTE: Input pointer is computed by resizer for R8G8B8A8 layout, source pointer is computed for source format
+    GetPixelsColor(resizeData->src + y*resizeData->srcStride + x*resizeData->srcBytesPerPixel, resizeData->srcFormat, count, (Color *)output);
+
+    return output;
+}
+
+// Get mipmap filter weight for source pixel at distance x from destination pixel center
+// NOTE: Distance and scale are defined in source pixels, box filter weight is the pixel coverage
+static float GetMipmapFilterWeight(int filter, float x, float scale)
+{
+    float weight = 0.0f;
+
+    if (filter == MIPMAP_FILTER_BOX)
+    {
+        float radius = 0.5f*scale;
+        float left = ((x - 0.5f) > -radius)? (x - 0.5f) : -radius;
+        float right = ((x + 0.5f) < radius)? (x + 0.5f) : radius;
+
+        if (right > left) weight = right - left;
+    }
+    else
+    {
+        x /= scale;     // Filter is defined in destination pixels
+
+        if (fabsf(x) < MIPMAP_FILTER_RADIUS)
+        {
+            float sinc = (x == 0.0f)? 1.0f : sinf(PI*x)/(PI*x);
+
+            if (filter == MIPMAP_FILTER_KAISER)
+            {
+                // Kaiser window: I0(beta*sqrt(1 - (x/radius)^2))/I0(beta), I0 computed by power series
+                float t = x/MIPMAP_FILTER_RADIUS;
+                float windowX = MIPMAP_KAISER_BETA*sqrtf(1.0f - t*t)*0.5f;
+                float windowBeta = MIPMAP_KAISER_BETA*0.5f;
+                float sumX = 1.0f, termX = 1.0f;
+                float sumBeta = 1.0f, termBeta = 1.0f;
+
+                for (int k = 1; k < 20; k++)
+                {
+                    termX *= (windowX/k)*(windowX/k);
+                    termBeta *= (windowBeta/k)*(windowBeta/k);
+                    sumX += termX;
+                    sumBeta += termBeta;
+                }
+
+                weight = sinc*sumX/sumBeta;
+            }
+            else
+            {
+                float lobe = x/MIPMAP_FILTER_RADIUS;
+
+                weight = sinc*((lobe == 0.0f)? 1.0f : sinf(PI*lobe)/(PI*lobe));
+            }
+        }
+    }
+
+    return weight;
+}
+
+// Compute mipmap filter weights for one dimension, returns taps per destination pixel
+// NOTE: Taps are contiguous source pixels from first[i], edge pixels are clamped,
+// if first or weights are NULL only taps count is computed
+static int ComputeMipmapWeights(int filter, int srcSize, int dstSize, int *first, float *weights)
+{
+    float scale = (float)srcSize/dstSize;
+    float radius = ((filter == MIPMAP_FILTER_BOX)? 0.5f : MIPMAP_FILTER_RADIUS)*scale;
+    int taps = 0;
+
+    for (int i = 0; i < dstSize; i++)
+    {
+        float center = (i + 0.5f)*scale;
+        int span = (int)ceilf(center + radius) - (int)floorf(center - radius);
+
+        if (span > taps) taps = span;
+    }
+
+    if (taps > srcSize) taps = srcSize;
+
+    if ((first != NULL) && (weights != NULL))
+    {
+        for (int i = 0; i < dstSize; i++)
+        {
+            float center = (i + 0.5f)*scale;
+            int start = (int)floorf(center - radius);
+            int end = (int)ceilf(center + radius);
+            float *pixelWeights = weights + i*taps;
+            float sum = 0.0f;
+
+            first[i] = (start < 0)? 0 : ((start > (srcSize - taps))? (srcSize - taps) : start);
+            for (int t = 0; t < taps; t++) pixelWeights[t] = 0.0f;
+
+            for (int k = start; k < end; k++)
+            {
+                float weight = GetMipmapFilterWeight(filter, k + 0.5f - center, scale);
+                int index = (k < 0)? 0 : ((k >= srcSize)? (srcSize - 1) : k);
+
+                pixelWeights[index - first[i]] += weight;
+                sum += weight;
+            }
+
+            if (sum != 0.0f) for (int t = 0; t < taps; t++) pixelWeights[t] /= sum;
+        }
+    }
+
+    return taps;
+}
+
+// Get value from transfer table (MIPMAP_TRANSFER_TABLE_SIZE + 1 entries), linear interpolated
+static inline float GetTransferValue(const float *table, float value)
+{
+    value = (value < 0.0f)? 0.0f : ((value > 1.0f)? 1.0f : value);
+    value *= MIPMAP_TRANSFER_TABLE_SIZE;
+
+    int index = (int)value;
+    if (index >= MIPMAP_TRANSFER_TABLE_SIZE) return table[MIPMAP_TRANSFER_TABLE_SIZE];
+
+    return table[index] + (table[index + 1] - table[index])*(value - index);
+}
+
+// Load mipmap base level pixels as linear color, alpha premultiplied
+// NOTE: Formats with 8-bit per channel are converted by channel values table
+static void LoadMipmapPixels(const ImageMipmapData *mipmap, int offset, int count, Vector4 *pixels)
+{
+    const unsigned char *data = mipmap->srcData;
+    const float *table = mipmap->byteToLinear;
+
+    switch (mipmap->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0, p = offset; i < count; i++, p++) pixels[i] = (Vector4){ table[data[p]], table[data[p]], table[data[p]], 1.0f };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0, p = offset*2; i < count; i++, p += 2)
+            {
+                float alpha = (float)data[p + 1]/255.0f;
+                float gray = table[data[p]]*alpha;
+
+                pixels[i] = (Vector4){ gray, gray, gray, alpha };
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0, p = offset*3; i < count; i++, p += 3) pixels[i] = (Vector4){ table[data[p]], table[data[p + 1]], table[data[p + 2]], 1.0f };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            for (int i = 0, p = offset*4; i < count; i++, p += 4)
+            {
+                float alpha = (float)data[p + 3]/255.0f;
+
+                pixels[i] = (Vector4){ table[data[p]]*alpha, table[data[p + 1]]*alpha, table[data[p + 2]]*alpha, alpha };
+            }
+        } break;
+        default:
+        {
+            GetPixelsNormalized(data, mipmap->format, offset, count, pixels);
+
+            for (int i = 0; i < count; i++)
+            {
+                // NOTE: Single channel formats are stored as gray, channel is replicated
+                if ((mipmap->format == PIXELFORMAT_UNCOMPRESSED_R32) || (mipmap->format == PIXELFORMAT_UNCOMPRESSED_R16))
+                {
+                    pixels[i].y = pixels[i].x;
+                    pixels[i].z = pixels[i].x;
+                }
+
+                if (mipmap->srgbToLinear != NULL)
+                {
+                    pixels[i].x = GetTransferValue(mipmap->srgbToLinear, pixels[i].x);
+                    pixels[i].y = GetTransferValue(mipmap->srgbToLinear, pixels[i].y);
+                    pixels[i].z = GetTransferValue(mipmap->srgbToLinear, pixels[i].z);
+                }
+
+                pixels[i].x *= pixels[i].w;
+                pixels[i].y *= pixels[i].w;
+                pixels[i].z *= pixels[i].w;
+            }
+        } break;
+    }
+}
+
+// Store mipmap level pixels from linear color with alpha premultiplied, alpha scaled by mipmap alpha scale
+static void StoreMipmapPixels(const ImageMipmapData *mipmap, int offset, int count, const Vector4 *pixels)
+{
+    Vector4 batch[IMAGE_FORMAT_BATCH_PIXELS];
+
+    for (int b = 0; b < count; b += IMAGE_FORMAT_BATCH_PIXELS)
+    {
+        int batchCount = ((count - b) < IMAGE_FORMAT_BATCH_PIXELS)? (count - b) : IMAGE_FORMAT_BATCH_PIXELS;
+
+        for (int i = 0; i < batchCount; i++)
+        {
+            Vector4 pixel = pixels[b + i];
+
+            if (pixel.w > 0.0f)
+            {
+                pixel.x /= pixel.w;
+                pixel.y /= pixel.w;
+                pixel.z /= pixel.w;
+            }
+
+            pixel.w *= mipmap->alphaScale;
+            pixel.w = (pixel.w < 0.0f)? 0.0f : ((pixel.w > 1.0f)? 1.0f : pixel.w);
+
+            if (mipmap->linearToSrgb != NULL)
+            {
+                pixel.x = GetTransferValue(mipmap->linearToSrgb, pixel.x);
+                pixel.y = GetTransferValue(mipmap->linearToSrgb, pixel.y);
+                pixel.z = GetTransferValue(mipmap->linearToSrgb, pixel.z);
+            }
+            else if (mipmap->clamp)
+            {
+                pixel.x = (pixel.x < 0.0f)? 0.0f : ((pixel.x > 1.0f)? 1.0f : pixel.x);
+                pixel.y = (pixel.y < 0.0f)? 0.0f : ((pixel.y > 1.0f)? 1.0f : pixel.y);
+                pixel.z = (pixel.z < 0.0f)? 0.0f : ((pixel.z > 1.0f)? 1.0f : pixel.z);
+            }
+
+            // NOTE: 8-bit per channel formats are truncated on store, rounding bias added
+            batch[i].x = pixel.x + mipmap->bias;
+            batch[i].y = pixel.y + mipmap->bias;
+            batch[i].z = pixel.z + mipmap->bias;
+            batch[i].w = pixel.w + mipmap->bias;
+        }
+
+        SetPixelsNormalized(mipmap->dstData, mipmap->format, offset + b, batchCount, batch);
+    }
+}
+
+// Filter mipmap source pixels row into destination pixels row (horizontal pass)
+static void FilterMipmapPixels(const Vector4 *src, Vector4 *dst, int count, const int *first, const float *weights, int taps)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const Vector4 *pixels = src + first[i];
+        const float *pixelWeights = weights + i*taps;
+
+#if defined(RL_SIMD_SSE2)
+        __m128 accum = _mm_setzero_ps();
+
+        for (int t = 0; t < taps; t++) accum = _mm_add_ps(accum, _mm_mul_ps(_mm_loadu_ps(&pixels[t].x), _mm_set1_ps(pixelWeights[t])));
+
+        _mm_storeu_ps(&dst[i].x, accum);
+#elif defined(RL_SIMD_NEON)
+        float32x4_t accum = vdupq_n_f32(0.0f);
+
+        for (int t = 0; t < taps; t++) accum = vmlaq_n_f32(accum, vld1q_f32(&pixels[t].x), pixelWeights[t]);
+
+        vst1q_f32(&dst[i].x, accum);
+#else
+        Vector4 accum = { 0 };
+
+        for (int t = 0; t < taps; t++)
+        {
+            accum.x += pixels[t].x*pixelWeights[t];
+            accum.y += pixels[t].y*pixelWeights[t];
+            accum.z += pixels[t].z*pixelWeights[t];
+            accum.w += pixels[t].w*pixelWeights[t];
+        }
+
+        dst[i] = accum;
+#endif
+    }
+}
+
+// Filter mipmap destination rows range [start, end) from source level
+// NOTE: Horizontally filtered source rows are kept in a tapsY rows ring, every source row is filtered once per range
+static void FilterMipmapRowsRange(int start, int end, void *userData)
+{
+    ImageMipmapData *mipmap = (ImageMipmapData *)userData;
+    int dstWidth = mipmap->dstWidth;
+    int tapsY = mipmap->tapsY;
+    Vector4 *rows = (Vector4 *)RL_MALLOC(tapsY*dstWidth*sizeof(Vector4));
+    Vector4 *input = (mipmap->srcData != NULL)? (Vector4 *)RL_MALLOC(mipmap->srcWidth*sizeof(Vector4)) : NULL;
+    int nextRow = mipmap->firstY[start];
+
+    for (int y = start; y < end; y++)
+    {
+        int firstRow = mipmap->firstY[y];
+        const float *weights = mipmap->weightsY + y*tapsY;
+        Vector4 *dst = mipmap->dst + y*dstWidth;
+
+        if (nextRow < firstRow) nextRow = firstRow;
+
+        // Horizontal pass for source rows not filtered yet
+        for (; nextRow < (firstRow + tapsY); nextRow++)
+        {
+            const Vector4 *src = mipmap->src + nextRow*mipmap->srcWidth;
+
+            if (input != NULL)
+            {
+                LoadMipmapPixels(mipmap, nextRow*mipmap->srcWidth, mipmap->srcWidth, input);
+                src = input;
+            }
+
+            FilterMipmapPixels(src, rows + (nextRow%tapsY)*dstWidth, dstWidth, mipmap->firstX, mipmap->weightsX, mipmap->tapsX);
+        }
+
+        // Vertical pass
+        memset(dst, 0, dstWidth*sizeof(Vector4));
+
+        for (int t = 0; t < tapsY; t++)
+        {
+            if (weights[t] != 0.0f) AccumulatePixels(dst, rows + ((firstRow + t)%tapsY)*dstWidth, dstWidth, weights[t]);
+        }
+
+        if (mipmap->store) StoreMipmapPixels(mipmap, y*dstWidth, dstWidth, dst);
+    }
+
+    RL_FREE(input);
+    RL_FREE(rows);
+}
+
+// Store mipmap level rows range [start, end), alpha coverage scale applied
+static void StoreMipmapRowsRange(int start, int end, void *userData)
+{
+    ImageMipmapData *mipmap = (ImageMipmapData *)userData;
+
+    for (int y = start; y < end; y++) StoreMipmapPixels(mipmap, y*mipmap->dstWidth, mipmap->dstWidth, mipmap->dst + y*mipmap->dstWidth);
+}
+
+// Count mipmap base level pixels with alpha over cutoff, rows range [start, end)
+static void CountMipmapCoverageRange(int start, int end, void *userData)
+{
+    ImageMipmapData *mipmap = (ImageMipmapData *)userData;
+    Vector4 batch[IMAGE_FORMAT_BATCH_PIXELS];
+    int count = 0;
+
+    for (int b = start*mipmap->srcWidth; b < end*mipmap->srcWidth; b += IMAGE_FORMAT_BATCH_PIXELS)
+    {
+        int batchCount = ((end*mipmap->srcWidth - b) < IMAGE_FORMAT_BATCH_PIXELS)? (end*mipmap->srcWidth - b) : IMAGE_FORMAT_BATCH_PIXELS;
+
+        GetPixelsNormalized(mipmap->srcData, mipmap->format, b, batchCount, batch);
+
+        for (int i = 0; i < batchCount; i++) if (batch[i].w > mipmap->alphaCutoff) count++;
+    }
+
+    RL_ATOMIC_ADD(&mipmap->coverage, count);
+}
+
+// Get mipmap level alpha scale to preserve coverage (ratio of pixels with alpha over cutoff)
+// NOTE: Alpha threshold matching coverage is found by alpha histogram, alpha*scale > cutoff for threshold < alpha
+static float GetMipmapAlphaScale(const Vector4 *pixels, int count, float cutoff, float coverage)
+{
+    int *histogram = (int *)RL_CALLOC(MIPMAP_ALPHA_HISTOGRAM_BINS, sizeof(int));
+    int target = (int)(coverage*count + 0.5f);
+    float threshold = 0.5f/MIPMAP_ALPHA_HISTOGRAM_BINS;
+    int accum = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        int bin = (int)(pixels[i].w*MIPMAP_ALPHA_HISTOGRAM_BINS);
+        histogram[(bin < 0)? 0 : ((bin >= MIPMAP_ALPHA_HISTOGRAM_BINS)? (MIPMAP_ALPHA_HISTOGRAM_BINS - 1) : bin)]++;
+    }
+
+    for (int bin = MIPMAP_ALPHA_HISTOGRAM_BINS - 1; bin > 0; bin--)
+    {
+        accum += histogram[bin];
+
+        if (accum >= target)
+        {
+            threshold = (float)bin/MIPMAP_ALPHA_HISTOGRAM_BINS;
+            break;
+        }
+    }
+
+    RL_FREE(histogram);
+
+    return (target > 0)? cutoff/threshold : 1.0f;
+}
+
+// Compress image blocks rows range [start, end), ImageCompress() parallel-for callback
+// NOTE: Blocks out of image bounds are padded with edge pixels
+static void CompressBlocksRange(int start, int end, void *userData)
+{
+    ImageCompressData *compress = (ImageCompressData *)userData;
+    int width = compress->width;
+    int blocksX = (width + 3)/4;
+    int srcStride = GetPixelDataSize(width, 1, compress->srcFormat);
+    int blockSize = ((compress->format == PIXELFORMAT_COMPRESSED_DXT1_RGB) || (compress->format == PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+                     (compress->format == PIXELFORMAT_COMPRESSED_ETC1_RGB) || (compress->format == PIXELFORMAT_COMPRESSED_ETC2_RGB))? 8 : 16;
+    Color *rows = (Color *)RL_MALLOC(4*width*sizeof(Color));
+
+    for (int by = start; by < end; by++)
+    {
+        for (int r = 0; r < 4; r++)
+        {
+            int y = ((by*4 + r) < compress->height)? (by*4 + r) : (compress->height - 1);
+
+            GetPixelsColor(compress->src + y*srcStride, compress->srcFormat, width, rows + r*width);
+        }
+
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            Color pixels[16] = { 0 };
+            unsigned char values[16] = { 0 };
+            unsigned char *block = compress->dst + (by*blocksX + bx)*blockSize;
+
+            for (int y = 0; y < 4; y++)
+            {
+                for (int x = 0; x < 4; x++)
+                {
+                    pixels[y*4 + x] = rows[y*width + (((bx*4 + x) < width)? (bx*4 + x) : (width - 1))];
+                    values[y*4 + x] = pixels[y*4 + x].a;
+                }
+            }
+
+            switch (compress->format)
+            {
+                case PIXELFORMAT_COMPRESSED_DXT1_RGB: CompressBlockDXT1(pixels, block, false, compress->highQuality, compress->singleColor); break;
+                case PIXELFORMAT_COMPRESSED_DXT1_RGBA: CompressBlockDXT1(pixels, block, true, compress->highQuality, compress->singleColor); break;
+                case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                {
+                    // Explicit 4-bit alpha values
+                    for (int i = 0; i < 8; i++) block[i] = (unsigned char)(((values[i*2]*15 + 127)/255) | (((values[i*2 + 1]*15 + 127)/255) << 4));
+                    CompressBlockDXT1(pixels, block + 8, false, compress->highQuality, compress->singleColor);
+                } break;
+                case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                {
+                    CompressBlockDXT5Alpha(values, block, compress->highQuality);
+                    CompressBlockDXT1(pixels, block + 8, false, compress->highQuality, compress->singleColor);
+                } break;
+                case PIXELFORMAT_COMPRESSED_ETC1_RGB: CompressBlockETC2(pixels, block, false, compress->highQuality); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_RGB: CompressBlockETC2(pixels, block, true, compress->highQuality); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                {
+                    CompressBlockEAC(values, block, compress->highQuality);
+                    CompressBlockETC2(pixels, block + 8, true, compress->highQuality);
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    RL_FREE(rows);
+}
+
+// Assign block pixels to nearest DXT1 palette colors, endpoints are ordered for block mode, returns squared error
+// NOTE: Four colors mode requires c0 > c1, three colors mode (transparent pixels) requires c0 <= c1
+static int MatchBlockDXT1(const Color *pixels, int transparent, unsigned short *c0, unsigned short *c1, bool threeColors, unsigned int *indices)
+{
+    if ((threeColors && (*c0 > *c1)) || (!threeColors && (*c0 < *c1)))
+    {
+        unsigned short temp = *c0;
+        *c0 = *c1;
+        *c1 = temp;
+    }
+
+    // Palette colors from RGB565 endpoints, last color is transparent black in three colors mode
+    int palette[4][3] = { 0 };
+    unsigned short endpoints[2] = { *c0, *c1 };
+
+    for (int e = 0; e < 2; e++)
+    {
+        int r = (endpoints[e] >> 11) & 0x1f;
+        int g = (endpoints[e] >> 5) & 0x3f;
+        int b = endpoints[e] & 0x1f;
+
+        palette[e][0] = (r << 3) | (r >> 2);
+        palette[e][1] = (g << 2) | (g >> 4);
+        palette[e][2] = (b << 3) | (b >> 2);
+    }
+
+    int colors = (threeColors || (*c0 == *c1))? 3 : 4;
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (colors == 4)
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c] + 1)/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c] + 1)/3;
+        }
+        else palette[2][c] = (palette[0][c] + palette[1][c])/2;
+    }
+
+    int error = 0;
+    *indices = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (transparent & (1 << i))
+        {
+            *indices |= (3u << (i*2));
+            continue;
+        }
+
+        int bestIndex = 0;
+        int bestError = 0x7fffffff;
+
+        for (int p = 0; p < colors; p++)
+        {
+            int dr = pixels[i].r - palette[p][0];
+            int dg = pixels[i].g - palette[p][1];
+            int db = pixels[i].b - palette[p][2];
+            int pixelError = dr*dr + dg*dg + db*db;
+
+            if (pixelError < bestError)
+            {
+                bestError = pixelError;
+                bestIndex = p;
+            }
+        }
+
+        *indices |= ((unsigned int)bestIndex << (i*2));
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Compress 4x4 pixels block color into DXT1 block (8 bytes), also used for DXT3/DXT5 color
+// NOTE: Endpoints are fitted along colors principal axis, high quality refines them by least squares,
+// pixels with alpha < 128 are encoded transparent if alpha enabled (three colors mode), DXT3/DXT5 colors always use four colors mode
+static void CompressBlockDXT1(const Color *pixels, unsigned char *block, bool alpha, bool highQuality, const unsigned char (*singleColor)[256][2])
+{
+    int transparent = 0;            // Transparent pixels mask
+    int count = 0;                  // Opaque pixels count
+    int minColor[3] = { 255, 255, 255 };
+    int maxColor[3] = { 0, 0, 0 };
+    float mean[3] = { 0 };
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (alpha && (pixels[i].a < 128))
+        {
+            transparent |= (1 << i);
+            continue;
+        }
+
+        int color[3] = { pixels[i].r, pixels[i].g, pixels[i].b };
+
+        for (int c = 0; c < 3; c++)
+        {
+            if (color[c] < minColor[c]) minColor[c] = color[c];
+            if (color[c] > maxColor[c]) maxColor[c] = color[c];
+            mean[c] += color[c];
+        }
+
+        count++;
+    }
+
+    unsigned short c0 = 0;
+    unsigned short c1 = 0;
+    unsigned int indices = 0xffffffff;      // Fully transparent block
+    bool threeColors = (transparent != 0);
+
+    if (count > 0)
+    {
+        if (!threeColors && (minColor[0] == maxColor[0]) && (minColor[1] == maxColor[1]) && (minColor[2] == maxColor[2]))
+        {
+            // Single color block, endpoints with closest 2/3 interpolated color
+            c0 = (unsigned short)((singleColor[0][minColor[0]][0] << 11) | (singleColor[1][minColor[1]][0] << 5) | singleColor[0][minColor[2]][0]);
+            c1 = (unsigned short)((singleColor[0][minColor[0]][1] << 11) | (singleColor[1][minColor[1]][1] << 5) | singleColor[0][minColor[2]][1]);
+
+            if (c0 > c1) indices = 0xaaaaaaaa;
+            else if (c0 < c1)
+            {
+                // Swapped endpoints, 2/3 interpolated color is index 3
+                unsigned short temp = c0;
+                c0 = c1;
+                c1 = temp;
+            }
+            else indices = 0;
+        }
+        else
+        {
+            float covariance[6] = { 0 };
+
+            for (int c = 0; c < 3; c++) mean[c] /= count;
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (transparent & (1 << i)) continue;
+
+                float r = pixels[i].r - mean[0];
+                float g = pixels[i].g - mean[1];
+                float b = pixels[i].b - mean[2];
+
+                covariance[0] += r*r;
+                covariance[1] += r*g;
+                covariance[2] += r*b;
+                covariance[3] += g*g;
+                covariance[4] += g*b;
+                covariance[5] += b*b;
+            }
+
+            // Colors principal axis by power iteration, starting from colors bounding box diagonal
+            float axis[3] = { (float)(maxColor[0] - minColor[0]), (float)(maxColor[1] - minColor[1]), (float)(maxColor[2] - minColor[2]) };
+
+            for (int k = 0; k < 4; k++)
+            {
+                float r = axis[0]*covariance[0] + axis[1]*covariance[1] + axis[2]*covariance[2];
+                float g = axis[0]*covariance[1] + axis[1]*covariance[3] + axis[2]*covariance[4];
+                float b = axis[0]*covariance[2] + axis[1]*covariance[4] + axis[2]*covariance[5];
+                float length = fmaxf(fabsf(r), fmaxf(fabsf(g), fabsf(b)));
+
+                if (length < 1e-6f) break;
+
+                axis[0] = r/length;
+                axis[1] = g/length;
+                axis[2] = b/length;
+            }
+
+            // Endpoints from extreme pixels along axis
+            float minDot = 1e30f;
+            float maxDot = -1e30f;
+            int minIndex = 0;
+            int maxIndex = 0;
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (transparent & (1 << i)) continue;
+
+                float dot = pixels[i].r*axis[0] + pixels[i].g*axis[1] + pixels[i].b*axis[2];
+
+                if (dot < minDot) { minDot = dot; minIndex = i; }
+                if (dot > maxDot) { maxDot = dot; maxIndex = i; }
+            }
+
+            c0 = (unsigned short)((((pixels[maxIndex].r*31 + 127)/255) << 11) | (((pixels[maxIndex].g*63 + 127)/255) << 5) | ((pixels[maxIndex].b*31 + 127)/255));
+            c1 = (unsigned short)((((pixels[minIndex].r*31 + 127)/255) << 11) | (((pixels[minIndex].g*63 + 127)/255) << 5) | ((pixels[minIndex].b*31 + 127)/255));
+
+            int error = MatchBlockDXT1(pixels, transparent, &c0, &c1, threeColors, &indices);
+
+            // Least squares endpoints refinement for current pixels indices
+            for (int k = 0; highQuality && (k < 2) && (error > 0); k++)
+            {
+                float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+                float ax[3] = { 0 };
+                float bx[3] = { 0 };
+
+                for (int i = 0; i < 16; i++)
+                {
+                    int index = (indices >> (i*2)) & 3;
+                    if (transparent & (1 << i)) continue;
+
+                    float w = (index == 0)? 1.0f : ((index == 1)? 0.0f : (threeColors? 0.5f : ((index == 2)? 2.0f/3.0f : 1.0f/3.0f)));
+                    int color[3] = { pixels[i].r, pixels[i].g, pixels[i].b };
+
+                    aa += w*w;
+                    ab += w*(1.0f - w);
+                    bb += (1.0f - w)*(1.0f - w);
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        ax[c] += w*color[c];
+                        bx[c] += (1.0f - w)*color[c];
+                    }
+                }
+
+                float det = aa*bb - ab*ab;
+                if (fabsf(det) < 1e-6f) break;
+
+                int endpoints[2][3] = { 0 };
+                int maxValues[3] = { 31, 63, 31 };
+
+                for (int c = 0; c < 3; c++)
+                {
+                    float e0 = (bb*ax[c] - ab*bx[c])/det;
+                    float e1 = (aa*bx[c] - ab*ax[c])/det;
+
+                    endpoints[0][c] = (int)(fminf(fmaxf(e0, 0.0f), 255.0f)*maxValues[c]/255.0f + 0.5f);
+                    endpoints[1][c] = (int)(fminf(fmaxf(e1, 0.0f), 255.0f)*maxValues[c]/255.0f + 0.5f);
+                }
+
+                unsigned short r0 = (unsigned short)((endpoints[0][0] << 11) | (endpoints[0][1] << 5) | endpoints[0][2]);
+                unsigned short r1 = (unsigned short)((endpoints[1][0] << 11) | (endpoints[1][1] << 5) | endpoints[1][2]);
+                unsigned int refinedIndices = 0;
+                int refinedError = MatchBlockDXT1(pixels, transparent, &r0, &r1, threeColors, &refinedIndices);
+
+                if (refinedError >= error) break;
+
+                error = refinedError;
+                c0 = r0;
+                c1 = r1;
+                indices = refinedIndices;
+            }
+        }
+    }
+
+    block[0] = (unsigned char)(c0 & 0xff);
+    block[1] = (unsigned char)(c0 >> 8);
+    block[2] = (unsigned char)(c1 & 0xff);
+    block[3] = (unsigned char)(c1 >> 8);
+    for (int i = 0; i < 4; i++) block[4 + i] = (unsigned char)((indices >> (i*8)) & 0xff);
+}
+
+// Assign values to nearest DXT5 alpha palette values, returns squared error
+// NOTE: Eight values mode if a0 > a1, six values mode plus 0 and 255 otherwise
+static int MatchBlockDXT5Alpha(const unsigned char *values, int a0, int a1, unsigned long long *indices)
+{
+    int palette[8] = { a0, a1, 0 };
+
+    if (a0 > a1) for (int i = 1; i < 7; i++) palette[i + 1] = ((7 - i)*a0 + i*a1 + 3)/7;
+    else
+    {
+        for (int i = 1; i < 5; i++) palette[i + 1] = ((5 - i)*a0 + i*a1 + 2)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    int error = 0;
+    *indices = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int bestIndex = 0;
+        int bestError = 0x7fffffff;
+
+        for (int p = 0; p < 8; p++)
+        {
+            int valueError = (values[i] - palette[p])*(values[i] - palette[p]);
+
+            if (valueError < bestError)
+            {
+                bestError = valueError;
+                bestIndex = p;
+            }
+        }
+
+        *indices |= ((unsigned long long)bestIndex << (i*3));
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Compress 16 values into DXT5 alpha block (BC4 block, 8 bytes)
+// NOTE: High quality refines eight values mode endpoints by least squares and tries six values mode
+static void CompressBlockDXT5Alpha(const unsigned char *values, unsigned char *block, bool highQuality)
+{
+    int minValue = 255;
+    int maxValue = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (values[i] < minValue) minValue = values[i];
+        if (values[i] > maxValue) maxValue = values[i];
+    }
+
+    int a0 = maxValue;
+    int a1 = minValue;
+    unsigned long long indices = 0;
+    int error = MatchBlockDXT5Alpha(values, a0, a1, &indices);
+
+    if (highQuality && (error > 0))
+    {
+        // Least squares endpoints for eight values mode indices
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f, ax = 0.0f, bx = 0.0f;
+
+        for (int i = 0; i < 16; i++)
+        {
+            int index = (int)((indices >> (i*3)) & 7);
+            float w = (index == 0)? 1.0f : ((index == 1)? 0.0f : (8 - index)/7.0f);
+
+            aa += w*w;
+            ab += w*(1.0f - w);
+            bb += (1.0f - w)*(1.0f - w);
+            ax += w*values[i];
+            bx += (1.0f - w)*values[i];
+        }
+
+        float det = aa*bb - ab*ab;
+
+        if (fabsf(det) > 1e-6f)
+        {
+            int r0 = (int)(fminf(fmaxf((bb*ax - ab*bx)/det, 0.0f), 255.0f) + 0.5f);
+            int r1 = (int)(fminf(fmaxf((aa*bx - ab*ax)/det, 0.0f), 255.0f) + 0.5f);
+            unsigned long long refinedIndices = 0;
+
+            if (r0 > r1)
+            {
+                int refinedError = MatchBlockDXT5Alpha(values, r0, r1, &refinedIndices);
+
+                if (refinedError < error)
+                {
+                    error = refinedError;
+                    a0 = r0;
+                    a1 = r1;
+                    indices = refinedIndices;
+                }
+            }
+        }
+
+        // Six values mode, values 0 and 255 are available as extremes
+        int low = 255;
+        int high = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if ((values[i] != 0) && (values[i] != 255))
+            {
+                if (values[i] < low) low = values[i];
+                if (values[i] > high) high = values[i];
+            }
+        }
+
+        if (low > high) low = high = 0;
+
+        unsigned long long sixIndices = 0;
+        int sixError = MatchBlockDXT5Alpha(values, low, high, &sixIndices);
+
+        if (sixError < error)
+        {
+            a0 = low;
+            a1 = high;
+            indices = sixIndices;
+        }
+    }
+
+    block[0] = (unsigned char)a0;
+    block[1] = (unsigned char)a1;
+    for (int i = 0; i < 6; i++) block[2 + i] = (unsigned char)((indices >> (i*8)) & 0xff);
+}
+
+// Fit ETC subblock pixels (8) to base color, returns squared error
+// NOTE: Modifier per pixel is chosen by luminance difference (fast) or by exact clamped error (exact)
+static int FitSubblockETC(const Color *pixels, const int *base, bool exact, int *table, int *indices)
+{
+    static const int modifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+    int colors[8][3] = { 0 };
+    int diffs[8] = { 0 };           // Pixels luminance difference to base color (sum of channels differences)
+    int bestError = 0x7fffffff;
+
+    for (int i = 0; i < 8; i++)
+    {
+        colors[i][0] = pixels[i].r;
+        colors[i][1] = pixels[i].g;
+        colors[i][2] = pixels[i].b;
+        diffs[i] = (colors[i][0] - base[0]) + (colors[i][1] - base[1]) + (colors[i][2] - base[2]);
+    }
+
+    for (int t = 0; t < 8; t++)
+    {
+        // Pixel index values: 0: +a, 1: +b, 2: -a, 3: -b
+        int values[4] = { modifiers[t][0], modifiers[t][1], -modifiers[t][0], -modifiers[t][1] };
+        int threshold = 3*(values[0] + values[1]);
+        int tableIndices[8] = { 0 };
+        int error = 0;
+
+        for (int i = 0; (i < 8) && (error < bestError); i++)
+        {
+            int first = 0;
+            int last = 3;
+
+            // Modifier closest to luminance difference (unclamped error minimum)
+            if (!exact)
+            {
+                if (diffs[i] >= 0) first = (2*diffs[i] > threshold)? 1 : 0;
+                else first = (-2*diffs[i] > threshold)? 3 : 2;
+
+                last = first;
+            }
+
+            int bestIndex = first;
+            int pixelError = 0x7fffffff;
+
+            for (int m = first; m <= last; m++)
+            {
+                int modifiedError = 0;
+
+                for (int c = 0; c < 3; c++)
+                {
+                    int value = base[c] + values[m];
+                    value = (value < 0)? 0 : ((value > 255)? 255 : value);
+                    modifiedError += (value - colors[i][c])*(value - colors[i][c]);
+                }
+
+                if (modifiedError < pixelError)
+                {
+                    pixelError = modifiedError;
+                    bestIndex = m;
+                }
+            }
+
+            tableIndices[i] = bestIndex;
+            error += pixelError;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            *table = t;
+            for (int i = 0; i < 8; i++) indices[i] = tableIndices[i];
+        }
+    }
+
+    return bestError;
+}
+
+// Compress 4x4 pixels block into ETC2 RGB block (8 bytes), ETC1 compatible if planar mode disabled
+// NOTE: Individual and differential modes are evaluated for both subblocks orientations, high quality evaluates
+// base colors rounded up and down per channel and refines modifiers by exact error, T and H modes are not used
+static void CompressBlockETC2(const Color *pixels, unsigned char *block, bool planar, bool highQuality)
+{
+    unsigned int bestHigh = 0;
+    unsigned int bestLow = 0;
+    int bestError = 0x7fffffff;
+
+    for (int flip = 0; flip < 2; flip++)
+    {
+        Color subblocks[2][8] = { 0 };
+        int positions[2][8] = { 0 };        // Pixels bit positions (x*4 + y)
+        float average[2][3] = { 0 };
+
+        int counts[2] = { 0 };
+
+        for (int y = 0; y < 4; y++)
+        {
+            for (int x = 0; x < 4; x++)
+            {
+                int s = flip? (y >= 2) : (x >= 2);
+
+                subblocks[s][counts[s]] = pixels[y*4 + x];
+                positions[s][counts[s]] = x*4 + y;
+                average[s][0] += pixels[y*4 + x].r/8.0f;
+                average[s][1] += pixels[y*4 + x].g/8.0f;
+                average[s][2] += pixels[y*4 + x].b/8.0f;
+                counts[s]++;
+            }
+        }
+
+        // Individual (4-bit base colors) and differential (5-bit base color and 3-bit difference) modes
+        for (int differential = 0; differential < 2; differential++)
+        {
+            int maxValue = differential? 31 : 15;
+            int quantized[2][3] = { 0 };
+            int tables[2] = { 0 };
+            int indices[2][8] = { 0 };
+            int error = 0;
+
+            for (int s = 0; s < 2; s++)
+            {
+                int subblockError = 0x7fffffff;
+                int candidates = highQuality? 8 : 1;
+
+                for (int k = 0; k < candidates; k++)
+                {
+                    int candidate[3] = { 0 };
+                    int base[3] = { 0 };
+                    int table = 0;
+                    int candidateIndices[8] = { 0 };
+                    bool valid = true;
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        float value = average[s][c]*maxValue/255.0f;
+
+                        candidate[c] = highQuality? ((int)value + ((k >> c) & 1)) : (int)(value + 0.5f);
+                        if (candidate[c] > maxValue) candidate[c] = maxValue;
+
+                        // Second base color is clamped to differential range, evaluated if different
+                        if (differential && (s == 1))
+                        {
+                            int clamped = (candidate[c] < (quantized[0][c] - 4))? (quantized[0][c] - 4) : ((candidate[c] > (quantized[0][c] + 3))? (quantized[0][c] + 3) : candidate[c]);
+                            if (clamped != candidate[c]) valid = (k == 0);
+                            candidate[c] = clamped;
+                        }
+
+                        base[c] = differential? ((candidate[c] << 3) | (candidate[c] >> 2)) : ((candidate[c] << 4) | candidate[c]);
+                    }
+
+                    if (!valid) continue;
+
+                    int candidateError = FitSubblockETC(subblocks[s], base, false, &table, candidateIndices);
+
+                    if (candidateError < subblockError)
+                    {
+                        subblockError = candidateError;
+                        tables[s] = table;
+                        for (int c = 0; c < 3; c++) quantized[s][c] = candidate[c];
+                        for (int i = 0; i < 8; i++) indices[s][i] = candidateIndices[i];
+                    }
+                }
+
+                // Best candidate modifiers refined by exact clamped error
+                if (highQuality && (subblockError > 0))
+                {
+                    int base[3] = { 0 };
+
+                    for (int c = 0; c < 3; c++) base[c] = differential? ((quantized[s][c] << 3) | (quantized[s][c] >> 2)) : ((quantized[s][c] << 4) | quantized[s][c]);
+
+                    subblockError = FitSubblockETC(subblocks[s], base, true, &tables[s], indices[s]);
+                }
+
+                error += subblockError;
+            }
+
+            if (error < bestError)
+            {
+                bestError = error;
+
+                if (differential)
+                {
+                    bestHigh = ((unsigned int)quantized[0][0] << 27) | ((unsigned int)((quantized[1][0] - quantized[0][0]) & 7) << 24) |
+                               ((unsigned int)quantized[0][1] << 19) | ((unsigned int)((quantized[1][1] - quantized[0][1]) & 7) << 16) |
+                               ((unsigned int)quantized[0][2] << 11) | ((unsigned int)((quantized[1][2] - quantized[0][2]) & 7) << 8);
+                }
+                else
+                {
+                    bestHigh = ((unsigned int)quantized[0][0] << 28) | ((unsigned int)quantized[1][0] << 24) | ((unsigned int)quantized[0][1] << 20) |
+                               ((unsigned int)quantized[1][1] << 16) | ((unsigned int)quantized[0][2] << 12) | ((unsigned int)quantized[1][2] << 8);
+                }
+
+                bestHigh |= ((unsigned int)tables[0] << 5) | ((unsigned int)tables[1] << 2) | ((unsigned int)differential << 1) | (unsigned int)flip;
+                bestLow = 0;
+
+                // Pixels indices most significant bits in high half, least significant bits in low half
+                for (int s = 0; s < 2; s++)
+                {
+                    for (int i = 0; i < 8; i++) bestLow |= ((unsigned int)(indices[s][i] >> 1) << (16 + positions[s][i])) | ((unsigned int)(indices[s][i] & 1) << positions[s][i]);
+                }
+            }
+        }
+    }
+
+    // ETC2 planar mode: colors plane fitted by least squares, corners origin (O), horizontal (H) and vertical (V)
+    if (planar && (bestError > 0))
+    {
+        int plane[3][3] = { 0 };        // Channel: O, H, V
+        int bits[3] = { 6, 7, 6 };
+        int error = 0;
+
+        for (int c = 0; c < 3; c++)
+        {
+            float mean = 0.0f, slopeX = 0.0f, slopeY = 0.0f;
+
+            for (int y = 0; y < 4; y++)
+            {
+                for (int x = 0; x < 4; x++)
+                {
+                    int value = (c == 0)? pixels[y*4 + x].r : ((c == 1)? pixels[y*4 + x].g : pixels[y*4 + x].b);
+
+                    mean += value/16.0f;
+                    slopeX += (x - 1.5f)*value/20.0f;
+                    slopeY += (y - 1.5f)*value/20.0f;
+                }
+            }
+
+            float corners[3] = { mean - 1.5f*slopeX - 1.5f*slopeY, 0.0f, 0.0f };
+            corners[1] = corners[0] + 4.0f*slopeX;
+            corners[2] = corners[0] + 4.0f*slopeY;
+
+            for (int k = 0; k < 3; k++)
+            {
+                int maxValue = (1 << bits[c]) - 1;
+                int value = (int)(fminf(fmaxf(corners[k], 0.0f), 255.0f)*maxValue/255.0f + 0.5f);
+
+                plane[c][k] = value;
+            }
+        }
+
+        for (int y = 0; y < 4; y++)
+        {
+            for (int x = 0; x < 4; x++)
+            {
+                int color[3] = { pixels[y*4 + x].r, pixels[y*4 + x].g, pixels[y*4 + x].b };
+
+                for (int c = 0; c < 3; c++)
+                {
+                    int o = (plane[c][0] << (8 - bits[c])) | (plane[c][0] >> (2*bits[c] - 8));
+                    int h = (plane[c][1] << (8 - bits[c])) | (plane[c][1] >> (2*bits[c] - 8));
+                    int v = (plane[c][2] << (8 - bits[c])) | (plane[c][2] >> (2*bits[c] - 8));
+                    int value = (x*(h - o) + y*(v - o) + 4*o + 2) >> 2;
+
+                    value = (value < 0)? 0 : ((value > 255)? 255 : value);
+                    error += (value - color[c])*(value - color[c]);
+                }
+            }
+        }
+
+        if (error < bestError)
+        {
+            unsigned long long word = ((unsigned long long)plane[0][0] << 57) | ((unsigned long long)(plane[1][0] >> 6) << 56) |
+                ((unsigned long long)(plane[1][0] & 0x3f) << 49) | ((unsigned long long)(plane[2][0] >> 5) << 48) |
+                ((unsigned long long)((plane[2][0] >> 3) & 3) << 43) | ((unsigned long long)(plane[2][0] & 7) << 39) |
+                ((unsigned long long)(plane[0][1] >> 1) << 34) | (1ULL << 33) | ((unsigned long long)(plane[0][1] & 1) << 32) |
+                ((unsigned long long)plane[1][1] << 25) | ((unsigned long long)plane[2][1] << 19) |
+                ((unsigned long long)plane[0][2] << 13) | ((unsigned long long)plane[1][2] << 6) | (unsigned long long)plane[2][2];
+
+            // Unused bits (63, 55, 47..45, 42) are set for differential mode red and green in range and blue overflow
+            for (int k = 0; k < 64; k++)
+            {
+                unsigned long long candidate = word | ((unsigned long long)(k & 1) << 63) | ((unsigned long long)((k >> 1) & 1) << 55) |
+                                               ((unsigned long long)((k >> 2) & 7) << 45) | ((unsigned long long)((k >> 5) & 1) << 42);
+                int r = (int)((candidate >> 59) & 0x1f) + ((int)((candidate >> 56) & 7) ^ 4) - 4;
+                int g = (int)((candidate >> 51) & 0x1f) + ((int)((candidate >> 48) & 7) ^ 4) - 4;
+                int b = (int)((candidate >> 43) & 0x1f) + ((int)((candidate >> 40) & 7) ^ 4) - 4;
+
+                if ((r >= 0) && (r <= 31) && (g >= 0) && (g <= 31) && ((b < 0) || (b > 31)))
+                {
+                    bestHigh = (unsigned int)(candidate >> 32);
+                    bestLow = (unsigned int)(candidate & 0xffffffff);
+                    break;
+                }
+            }
+        }
+    }
+
+    // NOTE: ETC blocks are stored big-endian
+    for (int i = 0; i < 4; i++)
+    {
+        block[i] = (unsigned char)((bestHigh >> (24 - i*8)) & 0xff);
+        block[4 + i] = (unsigned char)((bestLow >> (24 - i*8)) & 0xff);
+    }
+}
+
+// Compress 16 values into ETC2 EAC alpha block (8 bytes)
+// NOTE: Base value and multiplier are fitted to values range for every modifiers table,
+// high quality also evaluates neighbour base values and multipliers
+static void CompressBlockEAC(const unsigned char *values, unsigned char *block, bool highQuality)
+{
+    static const int modifiers[16][8] = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    int minValue = 255;
+    int maxValue = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (values[i] < minValue) minValue = values[i];
+        if (values[i] > maxValue) maxValue = values[i];
+    }
+
+    // Single value block: table 13 includes modifier 0 (index 4)
+    int bestBase = minValue;
+    int bestMultiplier = 1;
+    int bestTable = 13;
+    unsigned long long bestIndices = 0x924924924924ULL;
+    int bestError = (minValue == maxValue)? 0 : 0x7fffffff;
+
+    for (int t = 0; (t < 16) && (bestError > 0); t++)
+    {
+        int range = modifiers[t][7] - modifiers[t][3];
+        int multiplier = (maxValue - minValue + range - 1)/range;
+        if (multiplier < 1) multiplier = 1;
+
+        for (int m = multiplier; m <= (highQuality? (multiplier + 1) : multiplier); m++)
+        {
+            if (m > 15) break;
+
+            int center = (int)floorf((minValue + maxValue)/2.0f - (modifiers[t][3] + modifiers[t][7])*m/2.0f + 0.5f);
+
+            for (int base = center - (highQuality? 1 : 0); base <= center + (highQuality? 1 : 0); base++)
+            {
+                if ((base < 0) || (base > 255)) continue;
+
+                unsigned long long indices = 0;
+                int error = 0;
+
+                for (int i = 0; (i < 16) && (error < bestError); i++)
+                {
+                    // NOTE: Pixels are stored by columns (x*4 + y), first pixel in most significant bits
+                    int value = values[(i%4)*4 + i/4];
+                    int bestIndex = 0;
+                    int valueError = 0x7fffffff;
+
+                    for (int k = 0; k < 8; k++)
+                    {
+                        int decoded = base + modifiers[t][k]*m;
+                        decoded = (decoded < 0)? 0 : ((decoded > 255)? 255 : decoded);
+
+                        if ((decoded - value)*(decoded - value) < valueError)
+                        {
+                            valueError = (decoded - value)*(decoded - value);
+                            bestIndex = k;
+                        }
+                    }
+
+                    indices |= ((unsigned long long)bestIndex << (45 - i*3));
+                    error += valueError;
+                }
+
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestBase = base;
+                    bestMultiplier = m;
+                    bestTable = t;
+                    bestIndices = indices;
+                }
+            }
+        }
+    }
+
+    unsigned long long word = ((unsigned long long)bestBase << 56) | ((unsigned long long)bestMultiplier << 52) | ((unsigned long long)bestTable << 48) | bestIndices;
+
+    // NOTE: EAC blocks are stored big-endian
+    for (int i = 0; i < 8; i++) block[i] = (unsigned char)((word >> (56 - i*8)) & 0xff);
+}
+
+// Get pixels colors from pixel data of certain format
+// NOTE: Direct conversion kernels results match GetPixelColor(), other formats are converted per pixel
+static void GetPixelsColor(const void *data, int format, int count, Color *colors)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: ConvertPixelsDirect(data, format, colors, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 0, count); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(colors, data, count*sizeof(Color)); break;
+        default:
+        {
+            int bytesPerPixel = GetPixelDataSize(1, 1, format);
+
+            for (int i = 0; i < count; i++) colors[i] = GetPixelColor((unsigned char *)data + i*bytesPerPixel, format);
+
+        } break;
+    }
+}
+
+// Set pixels colors formatted into pixel data of certain format
+// NOTE: Direct conversion kernels results match SetPixelColor(), 32-bit and 16-bit float formats
+// (not supported by SetPixelColor()) are set from normalized colors by batches
+static void SetPixelsColor(void *data, const Color *colors, int count, int format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: ConvertPixelsDirect(colors, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, data, format, 0, count); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(data, colors, count*sizeof(Color)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            Vector4 batch[IMAGE_FORMAT_BATCH_PIXELS];
+
+            for (int i = 0; i < count; i += IMAGE_FORMAT_BATCH_PIXELS)
+            {
+                int batchCount = ((count - i) < IMAGE_FORMAT_BATCH_PIXELS)? (count - i) : IMAGE_FORMAT_BATCH_PIXELS;
+
+                for (int k = 0; k < batchCount; k++)
+                {
+                    Color color = colors[i + k];
+                    batch[k] = (Vector4){ (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+                }
+
+                SetPixelsNormalized(data, format, i, batchCount, batch);
+            }
+
+        } break;
+        default: break;     // Compressed formats not supported
+    }
+}
+
+// Blend src pixels into dst pixels with tint, results match ColorAlphaBlend()
+// NOTE: Opaque destination pixels (dst.a = 255) are blended without division, vectorized when available:
+//   out.a = 255, out.c = q + (((src.c*a + 255*r) >= 65280)? 1 : 0), with a = src.a + 1,
+//   sum = src.c*a + dst.c*(256 - a), q = sum >> 8, r = sum & 0xff
+static void BlendPixelsAlpha(Color *dst, const Color *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RL_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i value255 = _mm_set1_epi16(255);
+    const __m128i value256 = _mm_set1_epi16(256);
+    const __m128i value65280 = _mm_set1_epi16((short)65280);
+    const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    const __m128i alphaLanes = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+    const __m128i tintFactor = _mm_setr_epi16(tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1, tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+
+        // Check all 4 destination pixels are opaque, otherwise blended per pixel
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(d, alphaMask), alphaMask)) == 0xffff)
+        {
+            __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i result[2] = { 0 };
+
+            for (int h = 0; h < 2; h++)
+            {
+                __m128i s16 = (h == 0)? _mm_unpacklo_epi8(s, zero) : _mm_unpackhi_epi8(s, zero);
+                __m128i d16 = (h == 0)? _mm_unpacklo_epi8(d, zero) : _mm_unpackhi_epi8(d, zero);
+
+                s16 = _mm_srli_epi16(_mm_mullo_epi16(s16, tintFactor), 8);
+                __m128i srcAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+                __m128i alpha = _mm_add_epi16(srcAlpha, one);
+
+                __m128i weighted = _mm_mullo_epi16(s16, alpha);
+                __m128i sum = _mm_add_epi16(weighted, _mm_mullo_epi16(d16, _mm_sub_epi16(value256, alpha)));
+                __m128i limit = _mm_sub_epi16(value65280, _mm_mullo_epi16(_mm_and_si128(sum, value255), value255));
+                __m128i carry = _mm_cmpeq_epi16(_mm_subs_epu16(limit, weighted), zero);     // Unsigned (weighted >= limit)
+                __m128i v = _mm_sub_epi16(_mm_srli_epi16(sum, 8), carry);
+
+                // Source alpha 255 keeps source, source alpha 0 keeps destination
+                __m128i srcOpaque = _mm_cmpeq_epi16(srcAlpha, value255);
+                __m128i srcClear = _mm_cmpeq_epi16(srcAlpha, zero);
+                v = _mm_or_si128(_mm_andnot_si128(srcOpaque, v), _mm_and_si128(srcOpaque, s16));
+                v = _mm_or_si128(_mm_andnot_si128(srcClear, v), _mm_and_si128(srcClear, d16));
+
+                result[h] = _mm_or_si128(v, alphaLanes);
+            }
+
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(result[0], result[1]));
+        }
+        else
+        {
+            for (int k = i; k < (i + 4); k++) dst[k] = ColorAlphaBlend(dst[k], src[k], tint);
+        }
+    }
+#elif defined(RL_SIMD_NEON)
+    const unsigned short tintFactor[4] = { tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1 };
+
+    for (; (i + 8) <= count; i += 8)
+    {
+        uint8x8x4_t d = vld4_u8((const unsigned char *)(dst + i));
+
+        // Check all 8 destination pixels are opaque, otherwise blended per pixel
+        if (vget_lane_u64(vreinterpret_u64_u8(vmvn_u8(d.val[3])), 0) == 0)
+        {
+            uint8x8x4_t s = vld4_u8((const unsigned char *)(src + i));
+            uint16x8_t channels[4] = { 0 };
+
+            for (int k = 0; k < 4; k++) channels[k] = vshrq_n_u16(vmulq_u16(vmovl_u8(s.val[k]), vdupq_n_u16(tintFactor[k])), 8);
+
+            uint16x8_t alpha = vaddq_u16(channels[3], vdupq_n_u16(1));
+            uint16x8_t invAlpha = vsubq_u16(vdupq_n_u16(256), alpha);
+            uint16x8_t srcOpaque = vceqq_u16(channels[3], vdupq_n_u16(255));
+            uint16x8_t srcClear = vceqq_u16(channels[3], vdupq_n_u16(0));
+            uint8x8x4_t result = { 0 };
+
+            for (int k = 0; k < 3; k++)
+            {
+                uint16x8_t d16 = vmovl_u8(d.val[k]);
+                uint16x8_t weighted = vmulq_u16(channels[k], alpha);
+                uint16x8_t sum = vmlaq_u16(weighted, d16, invAlpha);
+                uint16x8_t limit = vsubq_u16(vdupq_n_u16(65280), vmulq_u16(vandq_u16(sum, vdupq_n_u16(255)), vdupq_n_u16(255)));
+                uint16x8_t v = vsubq_u16(vshrq_n_u16(sum, 8), vcgeq_u16(weighted, limit));
+
+                // Source alpha 255 keeps source, source alpha 0 keeps destination
+                v = vbslq_u16(srcOpaque, channels[k], v);
+                v = vbslq_u16(srcClear, d16, v);
+
+                result.val[k] = vmovn_u16(v);
+            }
+
+            result.val[3] = vdup_n_u8(255);
+            vst4_u8((unsigned char *)(dst + i), result);
+        }
+        else
+        {
+            for (int k = i; k < (i + 8); k++) dst[k] = ColorAlphaBlend(dst[k], src[k], tint);
+        }
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = ColorAlphaBlend(dst[i], src[i], tint);
+}
+
+// Blend premultiplied src pixels into premultiplied dst pixels with tint
+// NOTE: out.c = src.c + dst.c*(255 - src.a)/255 (rounded, saturated), tint is applied to all src channels
+static void BlendPixelsPremultiplied(Color *dst, const Color *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RL_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i value128 = _mm_set1_epi16(128);
+    const __m128i value255 = _mm_set1_epi16(255);
+    const __m128i tintFactor = _mm_setr_epi16(tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1, tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i result[2] = { 0 };
+
+        for (int h = 0; h < 2; h++)
+        {
+            __m128i s16 = (h == 0)? _mm_unpacklo_epi8(s, zero) : _mm_unpackhi_epi8(s, zero);
+            __m128i d16 = (h == 0)? _mm_unpacklo_epi8(d, zero) : _mm_unpackhi_epi8(d, zero);
+
+            s16 = _mm_srli_epi16(_mm_mullo_epi16(s16, tintFactor), 8);
+            __m128i invAlpha = _mm_sub_epi16(value255, _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)));
+
+            // Rounded division by 255: x/255 == (t + (t >> 8)) >> 8, with t = x + 128
+            __m128i t = _mm_add_epi16(_mm_mullo_epi16(d16, invAlpha), value128);
+            t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+
+            result[h] = _mm_adds_epu16(s16, t);
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(result[0], result[1]));
+    }
+#elif defined(RL_SIMD_NEON)
+    const unsigned short tintFactor[4] = { tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1 };
+
+    for (; (i + 8) <= count; i += 8)
+    {
+        uint8x8x4_t s = vld4_u8((const unsigned char *)(src + i));
+        uint8x8x4_t d = vld4_u8((const unsigned char *)(dst + i));
+        uint16x8_t channels[4] = { 0 };
+        uint8x8x4_t result = { 0 };
+
+        for (int k = 0; k < 4; k++) channels[k] = vshrq_n_u16(vmulq_u16(vmovl_u8(s.val[k]), vdupq_n_u16(tintFactor[k])), 8);
+
+        uint16x8_t invAlpha = vsubq_u16(vdupq_n_u16(255), channels[3]);
+
+        for (int k = 0; k < 4; k++)
+        {
+            // Rounded division by 255: x/255 == (t + (t >> 8)) >> 8, with t = x + 128
+            uint16x8_t t = vmlaq_u16(vdupq_n_u16(128), vmovl_u8(d.val[k]), invAlpha);
+            t = vshrq_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+
+            result.val[k] = vqmovn_u16(vaddq_u16(channels[k], t));
+        }
+
+        vst4_u8((unsigned char *)(dst + i), result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int s[4] = {
+            ((unsigned int)src[i].r*((unsigned int)tint.r + 1)) >> 8,
+            ((unsigned int)src[i].g*((unsigned int)tint.g + 1)) >> 8,
+            ((unsigned int)src[i].b*((unsigned int)tint.b + 1)) >> 8,
+            ((unsigned int)src[i].a*((unsigned int)tint.a + 1)) >> 8
+        };
+        unsigned char *d = (unsigned char *)(dst + i);
+
+        for (int k = 0; k < 4; k++)
+        {
+            unsigned int t = (unsigned int)d[k]*(255 - s[3]) + 128;
+            unsigned int value = s[k] + ((t + (t >> 8)) >> 8);
+
+            d[k] = (value > 255)? 255 : (unsigned char)value;
+        }
+    }
+}
+
+// Draw src pixels row into dst pixels row, with tint and blend mode
+// NOTE: R8G8B8A8 pixels are blended in place, other formats are converted by batches of Color
+static void DrawPixelsRow(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int count, Color tint, int blendMode)
+{
+    // Fast path: Avoid blend if source has no alpha to blend
+    bool blendRequired = true;
+    if ((tint.a == 255) && ((srcFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
+
+    int bytesPerPixelDst = GetPixelDataSize(1, 1, dstFormat);
+    int bytesPerPixelSrc = GetPixelDataSize(1, 1, srcFormat);
+
+    // Fast path: Avoid moving pixel by pixel if no blend required and same format
+    if (!blendRequired && (srcFormat == dstFormat)) memcpy(dst, src, count*bytesPerPixelSrc);
+    else
+    {
+        Color srcColors[IMAGE_DRAW_BATCH_PIXELS];
+        Color dstColors[IMAGE_DRAW_BATCH_PIXELS];
+
+        for (int i = 0; i < count; i += IMAGE_DRAW_BATCH_PIXELS)
+        {
+            int batchCount = ((count - i) < IMAGE_DRAW_BATCH_PIXELS)? (count - i) : IMAGE_DRAW_BATCH_PIXELS;
+            unsigned char *pDst = dst + i*bytesPerPixelDst;
+            const unsigned char *pSrc = src + i*bytesPerPixelSrc;
+
+            const Color *colSrc = (const Color *)pSrc;
+            if (srcFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+            {
+                GetPixelsColor(pSrc, srcFormat, batchCount, srcColors);
+                colSrc = srcColors;
+            }
+
+            if (!blendRequired) SetPixelsColor(pDst, colSrc, batchCount, dstFormat);
+            else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+            {
+                if (blendMode == BLEND_ALPHA_PREMULTIPLY) BlendPixelsPremultiplied((Color *)pDst, colSrc, batchCount, tint);
+                else BlendPixelsAlpha((Color *)pDst, colSrc, batchCount, tint);
+            }
+            else
+            {
+                GetPixelsColor(pDst, dstFormat, batchCount, dstColors);
+
+                if (blendMode == BLEND_ALPHA_PREMULTIPLY) BlendPixelsPremultiplied(dstColors, colSrc, batchCount, tint);
+                else BlendPixelsAlpha(dstColors, colSrc, batchCount, tint);
+
+                SetPixelsColor(pDst, dstColors, batchCount, dstFormat);
+            }
+        }
+    }
+}
+
+// Resize input rows callback for ImageViewDraw(), source rows converted to R8G8B8A8
+static const void *ImageDrawResizeInput(void *output, const void *input, int count, int x, int y, void *userData)
+{
+    ImageDrawData *drawData = (ImageDrawData *)userData;
+    (void)input;
+
+    // NOTE: Input pointer is computed by resizer for R8G8B8A8 layout, source pointer is computed for source format
+    GetPixelsColor(drawData->src + y*drawData->srcStride + x*drawData->srcBytesPerPixel, drawData->srcFormat, count, (Color *)output);
+
+    return output;
+}
+
+// Resize output rows callback for ImageViewDraw(), resized rows drawn into destination
+static void ImageDrawResizeOutput(const void *output, int count, int y, void *userData)
+{
+    ImageDrawData *drawData = (ImageDrawData *)userData;
+    int visibleX = (int)drawData->visibleRec.x;
+    int visibleY = (int)drawData->visibleRec.y;
+    (void)count;
+
+    if ((y >= visibleY) && (y < (visibleY + (int)drawData->visibleRec.height)))
+    {
+        const unsigned char *row = (const unsigned char *)output + visibleX*GetPixelDataSize(1, 1, drawData->rowFormat);
+
+        DrawPixelsRow(drawData->dst + (y - visibleY)*drawData->dstStride, drawData->dstFormat, row, drawData->rowFormat, (int)drawData->visibleRec.width, drawData->tint, drawData->blendMode);
+    }
+}
+
+// Load atlas packer, empty skyline
+// NOTE: Packer and skyline nodes are allocated in one block, freed with RL_FREE()
+static AtlasPacker *LoadAtlasPacker(int width, int height)
+{
+    // NOTE: Skyline nodes are at least 1 pixel wide, nodes count never exceeds width (+1 while adding a node)
+    AtlasPacker *packer = (AtlasPacker *)RL_MALLOC(sizeof(AtlasPacker) + (width + 1)*sizeof(AtlasSkylineNode));
+
+    packer->width = width;
+    packer->height = height;
+    packer->nodeCount = 1;
+    packer->nodes = (AtlasSkylineNode *)(packer + 1);
+    packer->nodes[0] = (AtlasSkylineNode){ 0, 0, width };
+
+    return packer;
+}
+
+// Get position y to place rectangle at skyline node (rectangle left side at node left side), -1 if it does not fit
+static int FitAtlasSkyline(const AtlasPacker *packer, int index, int width, int height)
+{
+    int x = packer->nodes[index].x;
+    int y = 0;
+
+    if ((x + width) > packer->width) return -1;
+
+    // Rectangle rests on the highest node it spans
+    for (int i = index, remaining = width; remaining > 0; i++)
+    {
+        if (packer->nodes[i].y > y) y = packer->nodes[i].y;
+        if ((y + height) > packer->height) return -1;
+
+        remaining -= packer->nodes[i].width;
+    }
+
+    return y;
+}
+
+// Add rectangle placed at skyline node to skyline: new node inserted, covered nodes shrunk or removed, same height nodes merged
+static void AddAtlasSkyline(AtlasPacker *packer, int index, int y, int width, int height)
+{
+    AtlasSkylineNode *nodes = packer->nodes;
+
+    memmove(&nodes[index + 1], &nodes[index], (packer->nodeCount - index)*sizeof(AtlasSkylineNode));
+    nodes[index] = (AtlasSkylineNode){ nodes[index + 1].x, y + height, width };
+    packer->nodeCount++;
+
+    for (int i = index + 1; i < packer->nodeCount;)
+    {
+        int end = nodes[i - 1].x + nodes[i - 1].width;
+
+        if (nodes[i].x >= end) break;
+
+        int shrink = end - nodes[i].x;
+        nodes[i].x += shrink;
+        nodes[i].width -= shrink;
+
+        if (nodes[i].width > 0) break;
+
+        memmove(&nodes[i], &nodes[i + 1], (packer->nodeCount - i - 1)*sizeof(AtlasSkylineNode));
+        packer->nodeCount--;
+    }
+
+    for (int i = 0; i < (packer->nodeCount - 1);)
+    {
+        if (nodes[i].y == nodes[i + 1].y)
+        {
+            nodes[i].width += nodes[i + 1].width;
+            memmove(&nodes[i + 1], &nodes[i + 2], (packer->nodeCount - i - 2)*sizeof(AtlasSkylineNode));
+            packer->nodeCount--;
+        }
+        else i++;
+    }
+}
+
+// Pack sprite cell (trimmed size plus padding) into atlas, sprite rectangle and rotation defined on success
+// NOTE: Cell is placed at the position with lowest top edge (bottom-left), ties resolved by narrower skyline node,
+// rotated placement is only used if it is strictly better
+static bool PackAtlasSprite(AtlasPacker *packer, Rectangle trim, int padding, bool allowRotation, AtlasSprite *sprite)
+{
+    int cellWidth = (int)trim.width + 2*padding;
+    int cellHeight = (int)trim.height + 2*padding;
+    int bestIndex = -1;
+    int bestTop = 0;
+    int bestNodeWidth = 0;
+    int bestY = 0;
+    bool bestRotated = false;
+
+    for (int i = 0; i < packer->nodeCount; i++)
+    {
+        for (int r = 0; r < ((allowRotation && (cellWidth != cellHeight))? 2 : 1); r++)
+        {
+            int width = (r == 0)? cellWidth : cellHeight;
+            int height = (r == 0)? cellHeight : cellWidth;
+            int y = FitAtlasSkyline(packer, i, width, height);
+
+            if (y < 0) continue;
+
+            if ((bestIndex < 0) || ((y + height) < bestTop) || (((y + height) == bestTop) && (packer->nodes[i].width < bestNodeWidth)))
+            {
+                bestIndex = i;
+                bestTop = y + height;
+                bestNodeWidth = packer->nodes[i].width;
+                bestY = y;
+                bestRotated = (r == 1);
+            }
+        }
+    }
+
+    if (bestIndex < 0) return false;
+
+    int x = packer->nodes[bestIndex].x;
+    int width = bestRotated? cellHeight : cellWidth;
+    int height = bestRotated? cellWidth : cellHeight;
+
+    AddAtlasSkyline(packer, bestIndex, bestY, width, height);
+
+    sprite->rec = (Rectangle){ (float)(x + padding), (float)(bestY + padding), (float)(width - 2*padding), (float)(height - 2*padding) };
+    sprite->rotated = bestRotated;
+
+    return true;
+}
+
+// Draw sprite pixels into atlas image (converted to atlas format), borders extruded into padding if required
+static void DrawAtlasSprite(ImageAtlas *atlas, Image image, Rectangle trim, AtlasSprite sprite)
+{
+    ImageView atlasView = GetImageView(atlas->image);
+    ImageView src = GetImageViewRec(GetImageView(image), trim);
+    ImageView dst = GetImageViewRec(atlasView, sprite.rec);
+
+    if (sprite.rotated)
+    {
+        Image rotated = ImageFromView(src);
+        ImageRotateCW(&rotated);
+        ImageViewCopy(dst, GetImageView(rotated));
+        UnloadImage(rotated);
+    }
+    else ImageViewCopy(dst, src);
+
+    if (((atlas->flags & ATLAS_EXTRUDE_BORDERS) != 0) && (atlas->padding > 0))
+    {
+        float x = sprite.rec.x;
+        float y = sprite.rec.y;
+        float width = sprite.rec.width;
+        float height = sprite.rec.height;
+        float padding = (float)atlas->padding;
+
+        // Top and bottom rows repeated into padding
+        for (int i = 1; i <= atlas->padding; i++)
+        {
+            ImageViewCopy(GetImageViewRec(atlasView, (Rectangle){ x, y - i, width, 1 }), GetImageViewRec(atlasView, (Rectangle){ x, y, width, 1 }));
+            ImageViewCopy(GetImageViewRec(atlasView, (Rectangle){ x, y + height - 1 + i, width, 1 }), GetImageViewRec(atlasView, (Rectangle){ x, y + height - 1, width, 1 }));
+        }
+
+        // Left and right columns (extruded rows included, filling corners) repeated into padding
+        for (int i = 1; i <= atlas->padding; i++)
+        {
+            ImageViewCopy(GetImageViewRec(atlasView, (Rectangle){ x - i, y - padding, 1, height + 2*padding }), GetImageViewRec(atlasView, (Rectangle){ x, y - padding, 1, height + 2*padding }));
+            ImageViewCopy(GetImageViewRec(atlasView, (Rectangle){ x + width - 1 + i, y - padding, 1, height + 2*padding }), GetImageViewRec(atlasView, (Rectangle){ x + width - 1, y - padding, 1, height + 2*padding }));
+        }
+    }
+}
+
+// Get image rectangle to pack into atlas: full image or alpha trimmed, empty if image can not be packed
+static Rectangle GetAtlasTrimRec(Image image, int flags)
+{
+    Rectangle trim = { 0 };
+
+    if ((image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return trim;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas packing not supported for compressed formats");
+        return trim;
+    }
+
+    if ((flags & ATLAS_TRIM_ALPHA) != 0) trim = GetImageAlphaBorder(image, 0.0f);
+    else trim = (Rectangle){ 0, 0, (float)image.width, (float)image.height };
+
+    return trim;
+}
+
+// Compare atlas entries for packing order: larger side first, then smaller side, then insertion order (stable)
+static int CompareAtlasEntries(const void *a, const void *b)
+{
+    const AtlasEntry *entryA = (const AtlasEntry *)a;
+    const AtlasEntry *entryB = (const AtlasEntry *)b;
+
+    if (entryA->maxSide != entryB->maxSide) return entryB->maxSide - entryA->maxSide;
+    if (entryA->minSide != entryB->minSide) return entryB->minSide - entryA->minSide;
+
+    return entryA->index - entryB->index;
+}
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Load image animation stream from GIF data, first frame decoded
+// NOTE: File data is released on failure if owned by stream (loaded or mapped)
+static ImageAnimStream LoadImageAnimStreamGif(const unsigned char *fileData, int dataSize, int dataSource)
+{
+    ImageAnimStream anim = { 0 };
+    ImageAnimDecoder *decoder = (ImageAnimDecoder *)RL_CALLOC(1, sizeof(ImageAnimDecoder));
+
+    decoder->fileData = fileData;
+    decoder->dataSize = dataSize;
+    decoder->dataSource = dataSource;
+
+    ResetImageAnimDecoder(decoder);
+
+    if (DecodeImageAnimFrame(decoder))
+    {
+        anim.frame.width = decoder->gif.w;
+        anim.frame.height = decoder->gif.h;
+        anim.frame.mipmaps = 1;
+        anim.frame.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        anim.frame.data = RL_MALLOC(decoder->gif.w*decoder->gif.h*4);
+        anim.frameCount = GetGifFrameCount(fileData, dataSize);
+        anim.ctxData = decoder;
+
+        CopyImageAnimFrame(&anim, decoder);
+
+        TRACELOG(LOG_INFO, "IMAGE: GIF animation stream loaded successfully (%ix%i | %i frames)", anim.frame.width, anim.frame.height, anim.frameCount);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to load GIF animation stream");
+
+        anim.ctxData = decoder;
+        UnloadImageAnimStream(anim);
+        anim = (ImageAnimStream){ 0 };
+    }
+
+    return anim;
+}
+
+// Reset image animation decoder to animation start
+static void ResetImageAnimDecoder(ImageAnimDecoder *decoder)
+{
+    STBI_FREE(decoder->gif.out);
+    STBI_FREE(decoder->gif.history);
+    STBI_FREE(decoder->gif.background);
+    memset(&decoder->gif, 0, sizeof(stbi__gif));
+
+    stbi__start_mem(&decoder->context, decoder->fileData, decoder->dataSize);
+    decoder->decodedFrame = -1;
+}
 
-                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
-                {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
-                    {
-                        // ------------------------------------------------------------
-                        // MIDDLE-LEFT QUAD
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                        if (drawCenter)
-                        {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
-                        }
+// Decode next animation frame, animation restarted from first frame after last frame
+static bool DecodeImageAnimFrame(ImageAnimDecoder *decoder)
+{
+    int comp = 0;
+    int frameSize = decoder->gif.w*decoder->gif.h*4;
 
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
-                    }
+    // Keep a snapshot of frame before decoded one, stb_image restores pixels of frames disposed
+    // to previous (disposal method 3) from frame composed two frames back (twoBack)
+    if (decoder->gif.out != NULL)
+    {
+        if (decoder->twoBack == NULL)
+        {
+            decoder->twoBack = (unsigned char *)RL_MALLOC(frameSize);
+            decoder->spare = (unsigned char *)RL_MALLOC(frameSize);
+        }
 
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
-                    }
+        memcpy(decoder->spare, decoder->gif.out, frameSize);
+    }
 
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
-                {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                    }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
-                {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                }
-            rlEnd();
-        rlPopMatrix();
+    stbi_uc *result = stbi__gif_load_next(&decoder->context, &decoder->gif, &comp, 4, (decoder->decodedFrame >= 1)? decoder->twoBack : NULL);
+
+    if ((result == NULL) || (result == (stbi_uc *)&decoder->context))
+    {
+        // NOTE: Stream end marker is returned as context pointer, corrupted frames also restart animation
+        if ((result == NULL) && (decoder->decodedFrame >= 0)) TRACELOG(LOG_WARNING, "IMAGE: GIF frame data corrupted, animation restarted");
+
+        ResetImageAnimDecoder(decoder);
+        result = stbi__gif_load_next(&decoder->context, &decoder->gif, &comp, 4, NULL);
+
+        if ((result == NULL) || (result == (stbi_uc *)&decoder->context)) return false;
+    }
+    else if (decoder->gif.out != NULL)
+    {
+        unsigned char *snapshot = decoder->twoBack;
+        decoder->twoBack = decoder->spare;
+        decoder->spare = snapshot;
+    }
+
+    decoder->decodedFrame++;
+    decoder->decodedDelay = decoder->gif.delay;
+
+    return true;
+}
+
+// Decode next animation frame job, decode ahead
+static void DecodeImageAnimJob(void *userData)
+{
+    ImageAnimDecoder *decoder = (ImageAnimDecoder *)userData;
+
+    decoder->decoded = DecodeImageAnimFrame(decoder);
+}
+
+// Copy decoded frame to stream frame, next frame decoded ahead by a job worker (if available) while current frame is used
+static void CopyImageAnimFrame(ImageAnimStream *anim, ImageAnimDecoder *decoder)
+{
+    memcpy(anim->frame.data, decoder->gif.out, anim->frame.width*anim->frame.height*4);
+
+    anim->currentFrame = decoder->decodedFrame;
+    anim->frameDelay = (float)decoder->decodedDelay/1000.0f;
+    decoder->decoded = false;
+
+    if (GetJobWorkerCount() > 0) SubmitJob(DecodeImageAnimJob, decoder, &decoder->counter);
+}
+
+// Get GIF frames count, data blocks scanned without decoding
+static int GetGifFrameCount(const unsigned char *fileData, int dataSize)
+{
+    int frameCount = 0;
+    int offset = 13;        // Header and logical screen descriptor size
+
+    if (dataSize < offset) return 0;
+
+    // Skip global color table
+    if (fileData[10] & 0x80) offset += 3*(1 << ((fileData[10] & 0x07) + 1));
+
+    while (offset < dataSize)
+    {
+        unsigned char block = fileData[offset++];
+
+        if (block == 0x21) offset++;        // Extension: label followed by data sub-blocks
+        else if (block == 0x2C)             // Image: descriptor, local color table, LZW code size followed by data sub-blocks
+        {
+            if ((offset + 9) > dataSize) break;
+
+            unsigned char flags = fileData[offset + 8];
+            offset += 9;
+
+            if (flags & 0x80) offset += 3*(1 << ((flags & 0x07) + 1));
+            offset++;
+
+            frameCount++;
+        }
+        else break;                         // Trailer (0x3B) or unknown block
+
+        // Skip data sub-blocks, terminated by a zero size block
+        while ((offset < dataSize) && (fileData[offset] != 0)) offset += fileData[offset] + 1;
+        offset++;
+    }
+
+    return frameCount;
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate gradient image rows range [start, end), GenImageGradient*() parallel-for callback
+static void GenGradientRange(int start, int end, void *userData)
+{
+    ImageGenData *gen = (ImageGenData *)userData;
+    float factors[IMAGE_GEN_BATCH_PIXELS];
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < gen->width; x += IMAGE_GEN_BATCH_PIXELS)
+        {
+            int count = ((gen->width - x) < IMAGE_GEN_BATCH_PIXELS)? (gen->width - x) : IMAGE_GEN_BATCH_PIXELS;
+
+            GetGradientFactors(gen, x, y, count, factors);
+            BlendGradientPixels(factors, count, gen->start, gen->end, gen->pixels + y*gen->width + x);
+        }
+    }
+}
+
+// Get gradient factors for row pixels, clamped to [0.0f..1.0f] range
+static void GetGradientFactors(const ImageGenData *gen, int x, int y, int count, float *factors)
+{
+    const float *params = gen->params;
+    float distY = (gen->gradient == 2)? fabsf((float)y - params[1])/params[1] : (float)y - params[1];
+    int i = 0;
+
+#if defined(RL_SIMD_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128 px = _mm_add_ps(_mm_set1_ps((float)(x + i)), lanes);
+        __m128 factor = zero;
+
+        if (gen->gradient == 0)
+        {
+            // Linear: position along gradient direction
+            factor = _mm_add_ps(_mm_mul_ps(px, _mm_set1_ps(params[0])), _mm_set1_ps((float)y*params[1]));
+            factor = _mm_div_ps(factor, _mm_set1_ps(params[2]));
+        }
+        else if (gen->gradient == 1)
+        {
+            // Radial: euclidean distance from center
+            __m128 dx = _mm_sub_ps(px, _mm_set1_ps(params[0]));
+            __m128 dist = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_set1_ps(distY*distY)));
+            factor = _mm_div_ps(_mm_sub_ps(dist, _mm_set1_ps(params[2])), _mm_set1_ps(params[3]));
+        }
+        else
+        {
+            // Square: normalized Manhattan distance from center
+            __m128 dx = _mm_div_ps(_mm_andnot_ps(signMask, _mm_sub_ps(px, _mm_set1_ps(params[0]))), _mm_set1_ps(params[0]));
+            __m128 dist = _mm_max_ps(dx, _mm_set1_ps(distY));
+            factor = _mm_div_ps(_mm_sub_ps(dist, _mm_set1_ps(params[2])), _mm_set1_ps(params[3]));
+        }
+
+        // NOTE: Maximum operation returns second operand for NaN factors (zero)
+        _mm_storeu_ps(factors + i, _mm_min_ps(_mm_max_ps(factor, zero), one));
+    }
+#elif defined(RL_SIMD_NEON) && defined(__aarch64__)
+    // NOTE: Division and square root NEON instructions are only available on AArch64
+    const float laneOffsets[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t lanes = vld1q_f32(laneOffsets);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        float32x4_t px = vaddq_f32(vdupq_n_f32((float)(x + i)), lanes);
+        float32x4_t factor = zero;
+
+        if (gen->gradient == 0)
+        {
+            // Linear: position along gradient direction
+            factor = vaddq_f32(vmulq_f32(px, vdupq_n_f32(params[0])), vdupq_n_f32((float)y*params[1]));
+            factor = vdivq_f32(factor, vdupq_n_f32(params[2]));
+        }
+        else if (gen->gradient == 1)
+        {
+            // Radial: euclidean distance from center
+            float32x4_t dx = vsubq_f32(px, vdupq_n_f32(params[0]));
+            float32x4_t dist = vsqrtq_f32(vaddq_f32(vmulq_f32(dx, dx), vdupq_n_f32(distY*distY)));
+            factor = vdivq_f32(vsubq_f32(dist, vdupq_n_f32(params[2])), vdupq_n_f32(params[3]));
+        }
+        else
+        {
+            // Square: normalized Manhattan distance from center
+            float32x4_t dx = vdivq_f32(vabsq_f32(vsubq_f32(px, vdupq_n_f32(params[0]))), vdupq_n_f32(params[0]));
+            float32x4_t dist = vmaxq_f32(dx, vdupq_n_f32(distY));
+            factor = vdivq_f32(vsubq_f32(dist, vdupq_n_f32(params[2])), vdupq_n_f32(params[3]));
+        }
+
+        // NOTE: Factors clamped by comparison, NaN factors set to zero
+        factor = vbslq_f32(vcgtq_f32(factor, zero), factor, zero);
+        vst1q_f32(factors + i, vbslq_f32(vcltq_f32(factor, one), factor, one));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float px = (float)(x + i);
+        float factor = 0.0f;
+
+        if (gen->gradient == 0) factor = (px*params[0] + (float)y*params[1])/params[2];
+        else if (gen->gradient == 1)
+        {
+            float dx = px - params[0];
+            factor = (sqrtf(dx*dx + distY*distY) - params[2])/params[3];
+        }
+        else
+        {
+            float dx = fabsf(px - params[0])/params[0];
+            factor = (((dx > distY)? dx : distY) - params[2])/params[3];
+        }
+
+        factor = (factor > 0.0f)? factor : 0.0f;
+        factors[i] = (factor < 1.0f)? factor : 1.0f;
+    }
+}
+
+// Blend gradient start and end colors by factors into pixels
+static void BlendGradientPixels(const float *factors, int count, Color start, Color end, Color *pixels)
+{
+    int i = 0;
+
+#if defined(RL_SIMD_SSE2)
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 startR = _mm_set1_ps((float)start.r), endR = _mm_set1_ps((float)end.r);
+    const __m128 startG = _mm_set1_ps((float)start.g), endG = _mm_set1_ps((float)end.g);
+    const __m128 startB = _mm_set1_ps((float)start.b), endB = _mm_set1_ps((float)end.b);
+    const __m128 startA = _mm_set1_ps((float)start.a), endA = _mm_set1_ps((float)end.a);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128 factor = _mm_loadu_ps(factors + i);
+        __m128 inverse = _mm_sub_ps(one, factor);
+
+        __m128i r = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(endR, factor), _mm_mul_ps(startR, inverse)));
+        __m128i g = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(endG, factor), _mm_mul_ps(startG, inverse)));
+        __m128i b = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(endB, factor), _mm_mul_ps(startB, inverse)));
+        __m128i a = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(endA, factor), _mm_mul_ps(startA, inverse)));
+
+        __m128i rgba = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24)));
+        _mm_storeu_si128((__m128i *)(pixels + i), rgba);
+    }
+#elif defined(RL_SIMD_NEON)
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t startR = vdupq_n_f32((float)start.r), endR = vdupq_n_f32((float)end.r);
+    const float32x4_t startG = vdupq_n_f32((float)start.g), endG = vdupq_n_f32((float)end.g);
+    const float32x4_t startB = vdupq_n_f32((float)start.b), endB = vdupq_n_f32((float)end.b);
+    const float32x4_t startA = vdupq_n_f32((float)start.a), endA = vdupq_n_f32((float)end.a);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        float32x4_t factor = vld1q_f32(factors + i);
+        float32x4_t inverse = vsubq_f32(one, factor);
+
+        uint32x4_t r = vcvtq_u32_f32(vaddq_f32(vmulq_f32(endR, factor), vmulq_f32(startR, inverse)));
+        uint32x4_t g = vcvtq_u32_f32(vaddq_f32(vmulq_f32(endG, factor), vmulq_f32(startG, inverse)));
+        uint32x4_t b = vcvtq_u32_f32(vaddq_f32(vmulq_f32(endB, factor), vmulq_f32(startB, inverse)));
+        uint32x4_t a = vcvtq_u32_f32(vaddq_f32(vmulq_f32(endA, factor), vmulq_f32(startA, inverse)));
+
+        uint32x4_t rgba = vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 8)), vorrq_u32(vshlq_n_u32(b, 16), vshlq_n_u32(a, 24)));
+        vst1q_u32((uint32_t *)(pixels + i), rgba);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float factor = factors[i];
+
+        pixels[i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
+        pixels[i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
+        pixels[i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
+        pixels[i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
+    }
+}
+
+// Generate white noise image rows range [start, end), GenImageWhiteNoise() parallel-for callback
+// NOTE: Pixel values are hashed from pixel index and seed (lowbias32 integer hash), no sequential random state
+static void GenWhiteNoiseRange(int start, int end, void *userData)
+{
+    ImageGenData *gen = (ImageGenData *)userData;
+    unsigned int *pixels = (unsigned int *)gen->pixels;     // Pixels as packed RGBA, little-endian (BLACK: 0xff000000, WHITE: 0xffffffff)
+    int i = start*gen->width;
+    int last = end*gen->width;
+
+#if defined(RL_SIMD_SSE2)
+    // NOTE: SSE2 does not provide 32-bit multiplication, even and odd lanes multiplied separately
+    #define NOISE_MULLO(v, k) _mm_unpacklo_epi32(_mm_shuffle_epi32(_mm_mul_epu32(v, k), _MM_SHUFFLE(0, 0, 2, 0)), \
+        _mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(v, 32), k), _MM_SHUFFLE(0, 0, 2, 0)))
+    const __m128i golden = _mm_set1_epi32((int)0x9e3779b9);
+    const __m128i mul0 = _mm_set1_epi32(0x7feb352d);
+    const __m128i mul1 = _mm_set1_epi32((int)0x846ca68b);
+    const __m128i seed = _mm_set1_epi32((int)gen->seed);
+    const __m128i threshold = _mm_set1_epi32(gen->threshold);
+    const __m128i alpha = _mm_set1_epi32((int)0xff000000);
+
+    for (; (i + 4) <= last; i += 4)
+    {
+        __m128i hash = _mm_add_epi32(NOISE_MULLO(_mm_setr_epi32(i, i + 1, i + 2, i + 3), golden), seed);
+        hash = _mm_xor_si128(hash, _mm_srli_epi32(hash, 16));
+        hash = NOISE_MULLO(hash, mul0);
+        hash = _mm_xor_si128(hash, _mm_srli_epi32(hash, 15));
+        hash = NOISE_MULLO(hash, mul1);
+        hash = _mm_xor_si128(hash, _mm_srli_epi32(hash, 16));
+
+        __m128i white = _mm_cmplt_epi32(_mm_srli_epi32(hash, 8), threshold);
+        _mm_storeu_si128((__m128i *)(pixels + i), _mm_or_si128(white, alpha));
+    }
+    #undef NOISE_MULLO
+#elif defined(RL_SIMD_NEON)
+    const int laneOffsets[4] = { 0, 1, 2, 3 };
+    const uint32x4_t seed = vdupq_n_u32(gen->seed);
+    const uint32x4_t threshold = vdupq_n_u32((unsigned int)gen->threshold);
+    const uint32x4_t alpha = vdupq_n_u32(0xff000000);
+    const uint32x4_t lanes = vreinterpretq_u32_s32(vld1q_s32(laneOffsets));
+
+    for (; (i + 4) <= last; i += 4)
+    {
+        uint32x4_t hash = vaddq_u32(vmulq_n_u32(vaddq_u32(vdupq_n_u32((unsigned int)i), lanes), 0x9e3779b9), seed);
+        hash = veorq_u32(hash, vshrq_n_u32(hash, 16));
+        hash = vmulq_n_u32(hash, 0x7feb352d);
+        hash = veorq_u32(hash, vshrq_n_u32(hash, 15));
+        hash = vmulq_n_u32(hash, 0x846ca68b);
+        hash = veorq_u32(hash, vshrq_n_u32(hash, 16));
+
+        uint32x4_t white = vcltq_u32(vshrq_n_u32(hash, 8), threshold);
+        vst1q_u32((uint32_t *)(pixels + i), vorrq_u32(white, alpha));
+    }
+#endif
+
+    for (; i < last; i++)
+    {
+        unsigned int hash = (unsigned int)i*0x9e3779b9u + gen->seed;
+        hash ^= hash >> 16;
+        hash *= 0x7feb352du;
+        hash ^= hash >> 15;
+        hash *= 0x846ca68bu;
+        hash ^= hash >> 16;
+
+        pixels[i] = ((int)(hash >> 8) < gen->threshold)? 0xffffffff : 0xff000000;
+    }
+}
+
+// Generate perlin noise image rows range [start, end), GenImagePerlinNoise() parallel-for callback
+static void GenPerlinNoiseRange(int start, int end, void *userData)
+{
+    ImageGenData *gen = (ImageGenData *)userData;
+    float aspectRatio = (float)gen->width/(float)gen->height;
+    float scaleX = gen->scale/(float)gen->width;
+    float scaleY = gen->scale/(float)gen->height;
+    float coords[IMAGE_GEN_BATCH_PIXELS];
+    float values[IMAGE_GEN_BATCH_PIXELS];
+
+    for (int y = start; y < end; y++)
+    {
+        float ny = (float)(y + gen->offsetY)*scaleY;
+
+        // Apply aspect ratio compensation to wider side
+        if (gen->width <= gen->height) ny /= aspectRatio;
+
+        for (int x = 0; x < gen->width; x += IMAGE_GEN_BATCH_PIXELS)
+        {
+            int count = ((gen->width - x) < IMAGE_GEN_BATCH_PIXELS)? (gen->width - x) : IMAGE_GEN_BATCH_PIXELS;
+
+            for (int i = 0; i < count; i++)
+            {
+                coords[i] = (float)(x + i + gen->offsetX)*scaleX;
+                if (gen->width > gen->height) coords[i] *= aspectRatio;
+            }
+
+            GetPerlinNoiseFbm(coords, ny, 1.0f, count, gen->lacunarity, gen->gain, gen->octaves, values);
+
+            for (int i = 0; i < count; i++)
+            {
+                // Clamp between -1.0f and 1.0f
+                float p = values[i];
+                if (p < -1.0f) p = -1.0f;
+                if (p > 1.0f) p = 1.0f;
+
+                // We need to normalize the data from [-1..1] to [0..1]
+                float np = (p + 1.0f)/2.0f;
 
-        rlSetTexture(0);
+                if (gen->values != NULL) gen->values[y*gen->width + x + i] = np;
+                else
+                {
+                    int intensity = (int)(np*255.0f);
+                    gen->pixels[y*gen->width + x + i] = (Color){ intensity, intensity, intensity, 255 };
+                }
+            }
+        }
     }
 }
 
-// Check if two colors are equal
-bool ColorIsEqual(Color col1, Color col2)
+// Get perlin noise fbm (fractal brownian motion) values for points along x axis
+// NOTE: Same values as stb_perlin_fbm_noise3(), octaves are accumulated for all points on SIMD path
+static void GetPerlinNoiseFbm(const float *x, float y, float z, int count, float lacunarity, float gain, int octaves, float *values)
 {
-    bool result = false;
+#if defined(RL_SIMD_SSE2) || defined(RL_SIMD_NEON)
+    float frequency = 1.0f;
+    float amplitude = 1.0f;
 
-    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+    for (int i = 0; i < count; i++) values[i] = 0.0f;
 
-    return result;
+    for (int o = 0; o < octaves; o++)
+    {
+        AddPerlinNoiseOctave(x, y, z, count, frequency, amplitude, (unsigned char)o, values);
+
+        frequency *= lacunarity;
+        amplitude *= gain;
+    }
+#else
+    for (int i = 0; i < count; i++) values[i] = stb_perlin_fbm_noise3(x[i], y, z, lacunarity, gain, octaves);
+#endif
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color Fade(Color color, float alpha)
+#if defined(RL_SIMD_SSE2) || defined(RL_SIMD_NEON)
+// Add perlin noise octave for points along x axis, vectorized stb_perlin_noise3_internal() by 4 points
+// NOTE: Lattice y and z are shared by all points and lattice corners gradient indices (tables lookups)
+// are only hashed when x cell changes, stb_perlin gradients basis are selected by index bits:
+// (±x ±y) for [0..3], (±x ±z) for [4..7], (±y ±z) for [8..11]
+static void AddPerlinNoiseOctave(const float *x, float y, float z, int count, float frequency, float amplitude, unsigned char seed, float *values)
 {
-    Color result = color;
+    #define PERLIN_EASE(a) (((a*6 - 15)*a + 10)*a*a*a)
+
+    float fy = y*frequency;
+    float fz = z*frequency;
+    int cellY = stb__perlin_fastfloor(fy);
+    int cellZ = stb__perlin_fastfloor(fz);
+    int y0 = cellY & 255, y1 = (cellY + 1) & 255;
+    int z0 = cellZ & 255, z1 = (cellZ + 1) & 255;
+
+    fy -= cellY;
+    fz -= cellZ;
+    float easeY = PERLIN_EASE(fy);
+    float easeZ = PERLIN_EASE(fz);
+
+    int cells[4] = { 0 };           // Points lattice cells x
+    int hashedCell = 0;             // Lattice cell x of hashed indices
+    int hashed[8] = { 0 };          // Lattice corners gradient indices for hashed cell, corners indexed by bits: x = 4, y = 2, z = 1
+    bool hashValid = false;
+
+#if defined(RL_SIMD_SSE2)
+    __m128i hashedIndices[2] = { 0 };
+    __m128i lanesIndices[4][2] = { 0 };
+#else
+    int32x4_t hashedIndices[2] = { vdupq_n_s32(0), vdupq_n_s32(0) };
+    int32x4_t lanesIndices[4][2];
+#endif
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    for (int i = 0; i < count; i += 4)
+    {
+        // Points batch, padded with last point if required
+        float points[4] = { 0 };
+        float noise[4] = { 0 };
+        const float *batch = x + i;
 
-    result.a = (unsigned char)(255.0f*alpha);
+        if ((i + 4) > count)
+        {
+            for (int l = 0; l < 4; l++) points[l] = x[((i + l) < count)? (i + l) : (count - 1)];
+            batch = points;
+        }
 
-    return result;
-}
+#if defined(RL_SIMD_SSE2)
+        // Lattice cell, rounded towards negative infinity
+        __m128 px = _mm_mul_ps(_mm_loadu_ps(batch), _mm_set1_ps(frequency));
+        __m128i cell = _mm_cvttps_epi32(px);
+        cell = _mm_add_epi32(cell, _mm_castps_si128(_mm_cmplt_ps(px, _mm_cvtepi32_ps(cell))));
+        _mm_storeu_si128((__m128i *)cells, cell);
 
-// Get hexadecimal value for a Color
-int ColorToInt(Color color)
-{
-    int result = 0;
+        px = _mm_sub_ps(px, _mm_cvtepi32_ps(cell));
+        __m128 easeX = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(px, _mm_set1_ps(6.0f)),
+            _mm_set1_ps(15.0f)), px), _mm_set1_ps(10.0f)), px), px), px);
+#else
+        // Lattice cell, rounded towards negative infinity
+        float32x4_t px = vmulq_n_f32(vld1q_f32(batch), frequency);
+        int32x4_t cell = vcvtq_s32_f32(px);
+        cell = vaddq_s32(cell, vreinterpretq_s32_u32(vcltq_f32(px, vcvtq_f32_s32(cell))));
+        vst1q_s32(cells, cell);
+
+        px = vsubq_f32(px, vcvtq_f32_s32(cell));
+        float32x4_t easeX = vmulq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vsubq_f32(vmulq_n_f32(px, 6.0f),
+            vdupq_n_f32(15.0f)), px), vdupq_n_f32(10.0f)), px), px), px);
+#endif
 
-    result = (int)(((unsigned int)color.r << 24) |
-                   ((unsigned int)color.g << 16) |
-                   ((unsigned int)color.b << 8) |
-                    (unsigned int)color.a);
+        for (int l = 0; l < 4; l++)
+        {
+            if (!hashValid || (cells[l] != hashedCell))
+            {
+                int x0 = cells[l] & 255, x1 = (cells[l] + 1) & 255;
+                int r0 = stb__perlin_randtab[x0 + seed];
+                int r1 = stb__perlin_randtab[x1 + seed];
+                int r00 = stb__perlin_randtab[r0 + y0];
+                int r01 = stb__perlin_randtab[r0 + y1];
+                int r10 = stb__perlin_randtab[r1 + y0];
+                int r11 = stb__perlin_randtab[r1 + y1];
+
+                hashed[0] = stb__perlin_randtab_grad_idx[r00 + z0];
+                hashed[1] = stb__perlin_randtab_grad_idx[r00 + z1];
+                hashed[2] = stb__perlin_randtab_grad_idx[r01 + z0];
+                hashed[3] = stb__perlin_randtab_grad_idx[r01 + z1];
+                hashed[4] = stb__perlin_randtab_grad_idx[r10 + z0];
+                hashed[5] = stb__perlin_randtab_grad_idx[r10 + z1];
+                hashed[6] = stb__perlin_randtab_grad_idx[r11 + z0];
+                hashed[7] = stb__perlin_randtab_grad_idx[r11 + z1];
+
+                hashedCell = cells[l];
+                hashValid = true;
+#if defined(RL_SIMD_SSE2)
+                hashedIndices[0] = _mm_loadu_si128((const __m128i *)hashed);
+                hashedIndices[1] = _mm_loadu_si128((const __m128i *)(hashed + 4));
+#else
+                hashedIndices[0] = vld1q_s32(hashed);
+                hashedIndices[1] = vld1q_s32(hashed + 4);
+#endif
+            }
 
-    return result;
-}
+            lanesIndices[l][0] = hashedIndices[0];
+            lanesIndices[l][1] = hashedIndices[1];
+        }
 
-// Get color normalized as float [0..1]
-Vector4 ColorNormalize(Color color)
-{
-    Vector4 result;
+#if defined(RL_SIMD_SSE2)
+        // Lanes indices transposed to corners indices
+        __m128i indices[8] = { 0 };
 
-    result.x = (float)color.r/255.0f;
-    result.y = (float)color.g/255.0f;
-    result.z = (float)color.b/255.0f;
-    result.w = (float)color.a/255.0f;
+        for (int h = 0; h < 2; h++)
+        {
+            __m128i t0 = _mm_unpacklo_epi32(lanesIndices[0][h], lanesIndices[1][h]);
+            __m128i t1 = _mm_unpacklo_epi32(lanesIndices[2][h], lanesIndices[3][h]);
+            __m128i t2 = _mm_unpackhi_epi32(lanesIndices[0][h], lanesIndices[1][h]);
+            __m128i t3 = _mm_unpackhi_epi32(lanesIndices[2][h], lanesIndices[3][h]);
+
+            indices[h*4 + 0] = _mm_unpacklo_epi64(t0, t1);
+            indices[h*4 + 1] = _mm_unpackhi_epi64(t0, t1);
+            indices[h*4 + 2] = _mm_unpacklo_epi64(t2, t3);
+            indices[h*4 + 3] = _mm_unpackhi_epi64(t2, t3);
+        }
 
-    return result;
+        const __m128 offsetX = _mm_sub_ps(px, _mm_set1_ps(1.0f));
+        __m128 n[8] = { 0 };
+
+        for (int c = 0; c < 8; c++)
+        {
+            // Gradient dot product: first and second components selected by index, signs flipped by index bits 0 and 1
+            __m128 dx = (c & 4)? offsetX : px;
+            __m128 dy = _mm_set1_ps((c & 2)? fy - 1 : fy);
+            __m128 dz = _mm_set1_ps((c & 1)? fz - 1 : fz);
+            __m128i index = indices[c];
+            __m128 lowX = _mm_castsi128_ps(_mm_cmplt_epi32(index, _mm_set1_epi32(8)));
+            __m128 lowY = _mm_castsi128_ps(_mm_cmplt_epi32(index, _mm_set1_epi32(4)));
+            __m128 u = _mm_or_ps(_mm_and_ps(lowX, dx), _mm_andnot_ps(lowX, dy));
+            __m128 v = _mm_or_ps(_mm_and_ps(lowY, dy), _mm_andnot_ps(lowY, dz));
+
+            u = _mm_xor_ps(u, _mm_castsi128_ps(_mm_slli_epi32(index, 31)));
+            v = _mm_xor_ps(v, _mm_castsi128_ps(_mm_slli_epi32(_mm_srli_epi32(index, 1), 31)));
+            n[c] = _mm_add_ps(u, v);
+        }
+
+        #define PERLIN_LERP(a, b, t) _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t))
+        const __m128 ey = _mm_set1_ps(easeY);
+        const __m128 ez = _mm_set1_ps(easeZ);
+        __m128 n0 = PERLIN_LERP(PERLIN_LERP(n[0], n[1], ez), PERLIN_LERP(n[2], n[3], ez), ey);
+        __m128 n1 = PERLIN_LERP(PERLIN_LERP(n[4], n[5], ez), PERLIN_LERP(n[6], n[7], ez), ey);
+
+        _mm_storeu_ps(noise, _mm_mul_ps(PERLIN_LERP(n0, n1, easeX), _mm_set1_ps(amplitude)));
+        #undef PERLIN_LERP
+#else
+        // Lanes indices transposed to corners indices
+        uint32x4_t indices[8];
+
+        for (int h = 0; h < 2; h++)
+        {
+            int32x4x2_t t01 = vtrnq_s32(lanesIndices[0][h], lanesIndices[1][h]);
+            int32x4x2_t t23 = vtrnq_s32(lanesIndices[2][h], lanesIndices[3][h]);
+
+            indices[h*4 + 0] = vreinterpretq_u32_s32(vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0])));
+            indices[h*4 + 1] = vreinterpretq_u32_s32(vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1])));
+            indices[h*4 + 2] = vreinterpretq_u32_s32(vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0])));
+            indices[h*4 + 3] = vreinterpretq_u32_s32(vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1])));
+        }
+
+        const float32x4_t offsetX = vsubq_f32(px, vdupq_n_f32(1.0f));
+        float32x4_t n[8];
+
+        for (int c = 0; c < 8; c++)
+        {
+            // Gradient dot product: first and second components selected by index, signs flipped by index bits 0 and 1
+            float32x4_t dx = (c & 4)? offsetX : px;
+            float32x4_t dy = vdupq_n_f32((c & 2)? fy - 1 : fy);
+            float32x4_t dz = vdupq_n_f32((c & 1)? fz - 1 : fz);
+            uint32x4_t index = indices[c];
+            float32x4_t u = vbslq_f32(vcltq_u32(index, vdupq_n_u32(8)), dx, dy);
+            float32x4_t v = vbslq_f32(vcltq_u32(index, vdupq_n_u32(4)), dy, dz);
+
+            u = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(u), vshlq_n_u32(index, 31)));
+            v = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v), vshlq_n_u32(vshrq_n_u32(index, 1), 31)));
+            n[c] = vaddq_f32(u, v);
+        }
+
+        #define PERLIN_LERP(a, b, t) vaddq_f32(a, vmulq_f32(vsubq_f32(b, a), t))
+        const float32x4_t ey = vdupq_n_f32(easeY);
+        const float32x4_t ez = vdupq_n_f32(easeZ);
+        float32x4_t n0 = PERLIN_LERP(PERLIN_LERP(n[0], n[1], ez), PERLIN_LERP(n[2], n[3], ez), ey);
+        float32x4_t n1 = PERLIN_LERP(PERLIN_LERP(n[4], n[5], ez), PERLIN_LERP(n[6], n[7], ez), ey);
+
+        vst1q_f32(noise, vmulq_n_f32(PERLIN_LERP(n0, n1, easeX), amplitude));
+        #undef PERLIN_LERP
+#endif
+
+        for (int l = 0; (l < 4) && ((i + l) < count); l++) values[i + l] += noise[l];
+    }
+
+    #undef PERLIN_EASE
 }
+#endif
 
-// Get color from normalized values [0..1]
-Color ColorFromNormalized(Vector4 normalized)
+// Generate cellular image rows range [start, end), GenImageCellular() parallel-for callback
+// NOTE: Squared distances to adjacent tiles seeds are compared, square root computed once per pixel
+static void GenCellularRange(int start, int end, void *userData)
 {
-    Color result;
+    ImageGenData *gen = (ImageGenData *)userData;
+    int tileSize = gen->tileSize;
+    float seedsX[9] = { 0 };        // Adjacent tiles seeds position X
+    float seedsDistY[9] = { 0 };    // Adjacent tiles seeds squared distance Y to current row
 
-    result.r = (unsigned char)(normalized.x*255.0f);
-    result.g = (unsigned char)(normalized.y*255.0f);
-    result.b = (unsigned char)(normalized.z*255.0f);
-    result.a = (unsigned char)(normalized.w*255.0f);
+    for (int y = start; y < end; y++)
+    {
+        int tileY = y/tileSize;
+        Color *row = gen->pixels + y*gen->width;
 
-    return result;
+        for (int tileX = 0; (tileX*tileSize) < gen->width; tileX++)
+        {
+            int seedCount = 0;
+
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= gen->seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= gen->seedsPerCol)) continue;
+
+                    Vector2 neighborSeed = gen->seeds[(tileY + j)*gen->seedsPerRow + tileX + i];
+                    float distY = (float)(y - (int)neighborSeed.y);
+
+                    seedsX[seedCount] = (float)((int)neighborSeed.x);
+                    seedsDistY[seedCount] = distY*distY;
+                    seedCount++;
+                }
+            }
+
+            int x = tileX*tileSize;
+            int tileEnd = ((x + tileSize) < gen->width)? (x + tileSize) : gen->width;
+
+#if defined(RL_SIMD_SSE2)
+            const __m128 lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+            const __m128 scale = _mm_set1_ps(256.0f);
+            const __m128 size = _mm_set1_ps((float)tileSize);
+            const __m128i alpha = _mm_set1_epi32((int)0xff000000);
+
+            for (; (x + 4) <= tileEnd; x += 4)
+            {
+                __m128 px = _mm_add_ps(_mm_set1_ps((float)x), lanes);
+                __m128 minDistance = _mm_set1_ps(65536.0f*65536.0f);
+
+                for (int s = 0; s < seedCount; s++)
+                {
+                    __m128 dx = _mm_sub_ps(px, _mm_set1_ps(seedsX[s]));
+                    minDistance = _mm_min_ps(minDistance, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_set1_ps(seedsDistY[s])));
+                }
+
+                // Intensity saturated to 255 by packing, replicated to RGB channels
+                __m128i intensity = _mm_cvttps_epi32(_mm_div_ps(_mm_mul_ps(_mm_sqrt_ps(minDistance), scale), size));
+                intensity = _mm_packus_epi16(_mm_packs_epi32(intensity, intensity), intensity);
+                intensity = _mm_unpacklo_epi8(intensity, intensity);
+                intensity = _mm_unpacklo_epi16(intensity, intensity);
+
+                _mm_storeu_si128((__m128i *)(row + x), _mm_or_si128(intensity, alpha));
+            }
+#elif defined(RL_SIMD_NEON) && defined(__aarch64__)
+            const float laneOffsets[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+            const float32x4_t lanes = vld1q_f32(laneOffsets);
+            const float32x4_t scale = vdupq_n_f32(256.0f);
+            const float32x4_t size = vdupq_n_f32((float)tileSize);
+            const uint32x4_t maxIntensity = vdupq_n_u32(255);
+            const uint32x4_t alpha = vdupq_n_u32(0xff000000);
+
+            for (; (x + 4) <= tileEnd; x += 4)
+            {
+                float32x4_t px = vaddq_f32(vdupq_n_f32((float)x), lanes);
+                float32x4_t minDistance = vdupq_n_f32(65536.0f*65536.0f);
+
+                for (int s = 0; s < seedCount; s++)
+                {
+                    float32x4_t dx = vsubq_f32(px, vdupq_n_f32(seedsX[s]));
+                    minDistance = vminq_f32(minDistance, vaddq_f32(vmulq_f32(dx, dx), vdupq_n_f32(seedsDistY[s])));
+                }
+
+                // Intensity clamped to 255, replicated to RGB channels
+                uint32x4_t intensity = vminq_u32(vcvtq_u32_f32(vdivq_f32(vmulq_f32(vsqrtq_f32(minDistance), scale), size)), maxIntensity);
+                intensity = vorrq_u32(vorrq_u32(intensity, vshlq_n_u32(intensity, 8)), vshlq_n_u32(intensity, 16));
+
+                vst1q_u32((uint32_t *)(row + x), vorrq_u32(intensity, alpha));
+            }
+#endif
+
+            for (; x < tileEnd; x++)
+            {
+                float minDistance = 65536.0f*65536.0f;
+
+                for (int s = 0; s < seedCount; s++)
+                {
+                    float dx = (float)x - seedsX[s];
+                    float distance = dx*dx + seedsDistY[s];
+
+                    if (distance < minDistance) minDistance = distance;
+                }
+
+                // I made this up, but it seems to give good results at all tile sizes
+                int intensity = (int)(sqrtf(minDistance)*256.0f/tileSize);
+                if (intensity > 255) intensity = 255;
+
+                row[x] = (Color){ intensity, intensity, intensity, 255 };
+            }
+        }
+    }
 }
+#endif
 
-// Get HSV values for a Color
-// NOTE: Hue is returned as degrees [0..360]
-Vector3 ColorToHSV(Color color)
+// Get color packed RGBA key
+static inline unsigned int GetColorKey(Color color)
 {
-    Vector3 hsv = { 0 };
-    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    float min, max, delta;
+    return ((unsigned int)color.r | ((unsigned int)color.g << 8) | ((unsigned int)color.b << 16) | ((unsigned int)color.a << 24));
+}
 
-    min = rgb.x < rgb.y? rgb.x : rgb.y;
-    min = min  < rgb.z? min  : rgb.z;
+// Load pixels unique colors histogram, transparent pixels skipped or counted as BLANK
+// NOTE: Unique colors are stored in first appearance order, consecutive equal pixels
+// are counted without hash table lookup (common on images with flat color areas)
+static ColorHistogram LoadColorHistogram(const Color *pixels, int count, bool skipTransparent)
+{
+    ColorHistogram histogram = { 0 };
 
-    max = rgb.x > rgb.y? rgb.x : rgb.y;
-    max = max  > rgb.z? max  : rgb.z;
+    histogram.capacity = 256;
+    histogram.entries = (ColorHistogramEntry *)RL_MALLOC(histogram.capacity*sizeof(ColorHistogramEntry));
+    histogram.slotCount = 2*histogram.capacity;
+    histogram.slots = (int *)RL_MALLOC(histogram.slotCount*sizeof(int));
+    memset(histogram.slots, 0xff, histogram.slotCount*sizeof(int));
 
-    hsv.z = max;            // Value
-    delta = max - min;
+    int last = -1;
+    unsigned int lastKey = 0;
 
-    if (delta < 0.00001f)
+    for (int i = 0; i < count; i++)
     {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;       // Undefined, maybe NAN?
-        return hsv;
-    }
+        Color color = pixels[i];
 
-    if (max > 0.0f)
-    {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max);    // Saturation
+        if (color.a == 0)
+        {
+            if (skipTransparent) continue;
+            color = BLANK;
+        }
+
+        unsigned int key = GetColorKey(color);
+
+        if ((last >= 0) && (key == lastKey))
+        {
+            histogram.entries[last].count++;
+            continue;
+        }
+
+        unsigned int hash = key*0x9e3779b1u;
+        int slot = (int)((hash ^ (hash >> 15)) & (unsigned int)(histogram.slotCount - 1));
+
+        while ((histogram.slots[slot] >= 0) && (GetColorKey(histogram.entries[histogram.slots[slot]].color) != key)) slot = (slot + 1) & (histogram.slotCount - 1);
+
+        if (histogram.slots[slot] < 0)
+        {
+            if (histogram.count == histogram.capacity)
+            {
+                histogram.capacity *= 2;
+                histogram.entries = (ColorHistogramEntry *)RL_REALLOC(histogram.entries, histogram.capacity*sizeof(ColorHistogramEntry));
+            }
+
+            histogram.entries[histogram.count] = (ColorHistogramEntry){ color, 0 };
+            histogram.slots[slot] = histogram.count;
+            histogram.count++;
+
+            // Grow hash table to keep load factor under 0.5, entries rehashed
+            if (2*histogram.count > histogram.slotCount)
+            {
+                RL_FREE(histogram.slots);
+                histogram.slotCount *= 2;
+                histogram.slots = (int *)RL_MALLOC(histogram.slotCount*sizeof(int));
+                memset(histogram.slots, 0xff, histogram.slotCount*sizeof(int));
+
+                for (int e = 0; e < histogram.count; e++)
+                {
+                    unsigned int entryHash = GetColorKey(histogram.entries[e].color)*0x9e3779b1u;
+                    int entrySlot = (int)((entryHash ^ (entryHash >> 15)) & (unsigned int)(histogram.slotCount - 1));
+
+                    while (histogram.slots[entrySlot] >= 0) entrySlot = (entrySlot + 1) & (histogram.slotCount - 1);
+                    histogram.slots[entrySlot] = e;
+                }
+
+                // Slot is only used to find current color entry
+                slot = -1;
+            }
+        }
+
+        last = (slot >= 0)? histogram.slots[slot] : histogram.count - 1;
+        lastKey = key;
+        histogram.entries[last].count++;
     }
-    else
+
+    return histogram;
+}
+
+// Unload color histogram
+static void UnloadColorHistogram(ColorHistogram histogram)
+{
+    RL_FREE(histogram.entries);
+    RL_FREE(histogram.slots);
+}
+
+// Get color histogram entry index, -1 if color not found
+static int GetColorHistogramEntry(const ColorHistogram *histogram, Color color)
+{
+    unsigned int key = GetColorKey(color);
+    unsigned int hash = key*0x9e3779b1u;
+    int slot = (int)((hash ^ (hash >> 15)) & (unsigned int)(histogram->slotCount - 1));
+
+    while (histogram->slots[slot] >= 0)
     {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = NAN;        // Undefined
-        return hsv;
+        if (GetColorKey(histogram->entries[histogram->slots[slot]].color) == key) return histogram->slots[slot];
+        slot = (slot + 1) & (histogram->slotCount - 1);
     }
 
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
-    else
+    return -1;
+}
+
+// Compute color box weight, error and split channel
+static void ComputeColorBox(const ColorHistogramEntry *entries, ColorBox *box)
+{
+    double sum[4] = { 0 };
+    double sumSquared[4] = { 0 };
+
+    box->weight = 0;
+
+    for (int i = box->first; i < (box->first + box->count); i++)
     {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+        const unsigned char *channels = &entries[i].color.r;
+        double count = (double)entries[i].count;
+
+        for (int c = 0; c < 4; c++)
+        {
+            sum[c] += count*channels[c];
+            sumSquared[c] += count*channels[c]*channels[c];
+        }
+
+        box->weight += entries[i].count;
     }
 
-    hsv.x *= 60.0f;     // Convert to degrees
+    box->error = 0.0;
+    box->channel = 0;
 
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+    double maxVariance = -1.0;
 
-    return hsv;
+    for (int c = 0; c < 4; c++)
+    {
+        double variance = sumSquared[c] - sum[c]*sum[c]/(double)box->weight;
+
+        box->error += variance;
+        if (variance > maxVariance)
+        {
+            maxVariance = variance;
+            box->channel = c;
+        }
+    }
 }
 
+// Quantize unique colors to best palette (median cut), returns palette colors count
+// NOTE: Box with greater error is split at weighted median of its greater variance channel,
+// palette colors (boxes mean colors) are refined by IMAGE_QUANTIZE_REFINE_ITERATIONS k-means iterations
+static int QuantizePalette(const ColorHistogramEntry *entries, int count, int maxColors, Color *palette)
+{
+    if (count <= 0) return 0;
 
+    ColorHistogramEntry *sorted = (ColorHistogramEntry *)RL_MALLOC(count*sizeof(ColorHistogramEntry));
+    ColorHistogramEntry *temp = (ColorHistogramEntry *)RL_MALLOC(count*sizeof(ColorHistogramEntry));
+    ColorBox *boxes = (ColorBox *)RL_MALLOC(maxColors*sizeof(ColorBox));
 
-// Get a Color from HSV values
-// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
-// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
-// Hue is provided in degrees: [0..360]
-// Saturation/Value are provided normalized: [0.0f..1.0f]
-Color ColorFromHSV(float hue, float saturation, float value)
-{
-    Color color = { 0, 0, 0, 255 };
+    memcpy(sorted, entries, count*sizeof(ColorHistogramEntry));
 
-    // Red channel
-    float k = fmodf((5.0f + hue/60.0f), 6);
-    float t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+    boxes[0] = (ColorBox){ 0, count, 0, 0.0, 0 };
+    ComputeColorBox(sorted, &boxes[0]);
 
-    // Green channel
-    k = fmodf((3.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+    int boxCount = 1;
 
-    // Blue channel
-    k = fmodf((1.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+    while (boxCount < maxColors)
+    {
+        int selected = -1;
 
-    return color;
-}
+        for (int i = 0; i < boxCount; i++)
+        {
+            if ((boxes[i].count > 1) && ((selected < 0) || (boxes[i].error > boxes[selected].error))) selected = i;
+        }
 
-// Get color multiplied with another color
-Color ColorTint(Color color, Color tint)
-{
-    Color result = color;
+        if (selected < 0) break;    // All boxes contain a single color
 
-    unsigned char r = (unsigned char)(((int)color.r*(int)tint.r)/255);
-    unsigned char g = (unsigned char)(((int)color.g*(int)tint.g)/255);
-    unsigned char b = (unsigned char)(((int)color.b*(int)tint.b)/255);
-    unsigned char a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+        // Sort box entries by split channel (counting sort, stable)
+        ColorBox *box = &boxes[selected];
+        int offsets[256] = { 0 };
+
+        for (int i = box->first; i < (box->first + box->count); i++) offsets[(&sorted[i].color.r)[box->channel]]++;
+        for (int v = 0, offset = box->first; v < 256; v++)
+        {
+            int valueCount = offsets[v];
+            offsets[v] = offset;
+            offset += valueCount;
+        }
+        for (int i = box->first; i < (box->first + box->count); i++) temp[offsets[(&sorted[i].color.r)[box->channel]]++] = sorted[i];
+        memcpy(sorted + box->first, temp + box->first, box->count*sizeof(ColorHistogramEntry));
 
-    result.r = r;
-    result.g = g;
-    result.b = b;
-    result.a = a;
+        // Split box at weighted median, both boxes keep at least one entry
+        long long accum = 0;
+        int split = box->count - 1;
 
-    return result;
-}
+        for (int i = 0; i < (box->count - 1); i++)
+        {
+            accum += sorted[box->first + i].count;
 
-// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
-Color ColorBrightness(Color color, float factor)
-{
-    Color result = color;
+            if (2*accum >= box->weight)
+            {
+                split = i + 1;
+                break;
+            }
+        }
 
-    if (factor > 1.0f) factor = 1.0f;
-    else if (factor < -1.0f) factor = -1.0f;
+        boxes[boxCount] = (ColorBox){ box->first + split, box->count - split, 0, 0.0, 0 };
+        box->count = split;
 
-    float red = (float)color.r;
-    float green = (float)color.g;
-    float blue = (float)color.b;
+        ComputeColorBox(sorted, box);
+        ComputeColorBox(sorted, &boxes[boxCount]);
+        boxCount++;
+    }
 
-    if (factor < 0.0f)
+    // Palette colors are boxes mean colors
+    for (int b = 0; b < boxCount; b++)
     {
-        factor = 1.0f + factor;
-        red *= factor;
-        green *= factor;
-        blue *= factor;
+        double sum[4] = { 0 };
+
+        for (int i = boxes[b].first; i < (boxes[b].first + boxes[b].count); i++)
+        {
+            for (int c = 0; c < 4; c++) sum[c] += (double)sorted[i].count*(&sorted[i].color.r)[c];
+        }
+
+        for (int c = 0; c < 4; c++) (&palette[b].r)[c] = (unsigned char)(sum[c]/(double)boxes[b].weight + 0.5);
     }
-    else
+
+    // Refine palette colors: unique colors are mapped to nearest palette color,
+    // palette colors are moved to mapped colors mean (k-means iterations)
+    if (count > boxCount)
     {
-        red = (255 - red)*factor + red;
-        green = (255 - green)*factor + green;
-        blue = (255 - blue)*factor + blue;
-    }
+        int *entryIndices = (int *)RL_MALLOC(count*sizeof(int));
+        double (*sums)[5] = RL_MALLOC(boxCount*sizeof(*sums));
 
-    result.r = (unsigned char)red;
-    result.g = (unsigned char)green;
-    result.b = (unsigned char)blue;
+        for (int iteration = 0; iteration < IMAGE_QUANTIZE_REFINE_ITERATIONS; iteration++)
+        {
+            PaletteMapData map = { 0 };
+            map.entries = sorted;
+            map.search = LoadPaletteSearch(palette, boxCount);
+            map.entryIndices = entryIndices;
 
-    return result;
-}
+            ParallelFor(count, IMAGE_PALETTE_BATCH_COLORS, MapEntriesRange, &map);
 
-// Get color with contrast correction
-// NOTE: Contrast values between -1.0f and 1.0f
-Color ColorContrast(Color color, float contrast)
-{
-    Color result = color;
+            UnloadPaletteSearch((PaletteSearch *)map.search);
 
-    if (contrast < -1.0f) contrast = -1.0f;
-    else if (contrast > 1.0f) contrast = 1.0f;
+            memset(sums, 0, boxCount*sizeof(*sums));
 
-    contrast = (1.0f + contrast);
-    contrast *= contrast;
+            for (int i = 0; i < count; i++)
+            {
+                double *colorSum = sums[entryIndices[i]];
 
-    float pR = (float)color.r/255.0f;
-    pR -= 0.5f;
-    pR *= contrast;
-    pR += 0.5f;
-    pR *= 255;
-    if (pR < 0) pR = 0;
-    else if (pR > 255) pR = 255;
+                for (int c = 0; c < 4; c++) colorSum[c] += (double)sorted[i].count*(&sorted[i].color.r)[c];
+                colorSum[4] += (double)sorted[i].count;
+            }
 
-    float pG = (float)color.g/255.0f;
-    pG -= 0.5f;
-    pG *= contrast;
-    pG += 0.5f;
-    pG *= 255;
-    if (pG < 0) pG = 0;
-    else if (pG > 255) pG = 255;
+            for (int b = 0; b < boxCount; b++)
+            {
+                if (sums[b][4] > 0.0)
+                {
+                    for (int c = 0; c < 4; c++) (&palette[b].r)[c] = (unsigned char)(sums[b][c]/sums[b][4] + 0.5);
+                }
+            }
+        }
 
-    float pB = (float)color.b/255.0f;
-    pB -= 0.5f;
-    pB *= contrast;
-    pB += 0.5f;
-    pB *= 255;
-    if (pB < 0) pB = 0;
-    else if (pB > 255) pB = 255;
+        RL_FREE(sums);
+        RL_FREE(entryIndices);
+    }
 
-    result.r = (unsigned char)pR;
-    result.g = (unsigned char)pG;
-    result.b = (unsigned char)pB;
+    RL_FREE(boxes);
+    RL_FREE(temp);
+    RL_FREE(sorted);
 
-    return result;
+    return boxCount;
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color ColorAlpha(Color color, float alpha)
+// Load palette nearest color search
+static PaletteSearch *LoadPaletteSearch(const Color *palette, int count)
 {
-    Color result = color;
+    PaletteSearch *search = (PaletteSearch *)RL_CALLOC(1, sizeof(PaletteSearch));
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    search->colors = (Color *)RL_MALLOC(count*sizeof(Color));
+    search->indices = (int *)RL_MALLOC(count*sizeof(int));
+    search->count = count;
 
-    result.a = (unsigned char)(255.0f*alpha);
+    // Sort palette colors by green channel (counting sort, stable)
+    int offsets[256] = { 0 };
 
-    return result;
+    for (int i = 0; i < count; i++) offsets[palette[i].g]++;
+    for (int v = 0, offset = 0; v < 256; v++)
+    {
+        int valueCount = offsets[v];
+        search->start[v] = offset;
+        offsets[v] = offset;
+        offset += valueCount;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        int sortedIndex = offsets[palette[i].g]++;
+
+        search->colors[sortedIndex] = palette[i];
+        search->indices[sortedIndex] = i;
+    }
+
+    return search;
 }
 
-// Get src alpha-blended into dst color with tint
-Color ColorAlphaBlend(Color dst, Color src, Color tint)
+// Unload palette nearest color search
+static void UnloadPaletteSearch(PaletteSearch *search)
 {
-    Color out = WHITE;
+    RL_FREE(search->colors);
+    RL_FREE(search->indices);
+    RL_FREE(search);
+}
 
-    // Apply color tint to source color
-    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
-    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
-    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
-    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+// Get palette index of nearest color
+// NOTE: Search expands from colors with nearest green channel,
+// stopped when green channel distance is greater than nearest color distance
+static int GetPaletteNearest(const PaletteSearch *search, Color color)
+{
+    int nearest = 0;
+    int nearestDistance = 0x7fffffff;
+    int start = search->start[color.g];
 
-//#define COLORALPHABLEND_FLOAT
-#define COLORALPHABLEND_INTEGERS
-#if defined(COLORALPHABLEND_INTEGERS)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
+    for (int i = start; i < search->count; i++)
     {
-        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
-        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+        const Color *candidate = &search->colors[i];
+        int dg = candidate->g - color.g;
 
-        if (out.a > 0)
+        if (dg*dg >= nearestDistance) break;
+
+        int dr = candidate->r - color.r;
+        int db = candidate->b - color.b;
+        int da = candidate->a - color.a;
+        int distance = dr*dr + dg*dg + db*db + da*da;
+
+        if (distance < nearestDistance)
         {
-            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            nearestDistance = distance;
+            nearest = i;
         }
     }
-#endif
-#if defined(COLORALPHABLEND_FLOAT)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
+
+    for (int i = start - 1; i >= 0; i--)
     {
-        Vector4 fdst = ColorNormalize(dst);
-        Vector4 fsrc = ColorNormalize(src);
-        Vector4 ftint = ColorNormalize(tint);
-        Vector4 fout = { 0 };
+        const Color *candidate = &search->colors[i];
+        int dg = candidate->g - color.g;
 
-        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+        if (dg*dg >= nearestDistance) break;
 
-        if (fout.w > 0.0f)
+        int dr = candidate->r - color.r;
+        int db = candidate->b - color.b;
+        int da = candidate->a - color.a;
+        int distance = dr*dr + dg*dg + db*db + da*da;
+
+        if (distance < nearestDistance)
         {
-            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+            nearestDistance = distance;
+            nearest = i;
         }
-
-        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
     }
-#endif
-
-    return out;
-}
 
-// Get color lerp interpolation between two colors, factor [0.0f..1.0f]
-Color ColorLerp(Color color1, Color color2, float factor) 
-{ 
-    Color color = { 0 };
-    
-    if (factor < 0.0f) factor = 0.0f;
-    else if (factor > 1.0f) factor = 1.0f;
-
-    color.r = (unsigned char)((1.0f - factor)*color1.r + factor*color2.r);
-    color.g = (unsigned char)((1.0f - factor)*color1.g + factor*color2.g);
-    color.b = (unsigned char)((1.0f - factor)*color1.b + factor*color2.b);
-    color.a = (unsigned char)((1.0f - factor)*color1.a + factor*color2.a);
-
-    return color;
+    return search->indices[nearest];
 }
 
-// Get a Color struct from hexadecimal value
-Color GetColor(unsigned int hexValue)
+// Map pixels to nearest palette colors, output indices and/or colors
+// NOTE: Without dithering, nearest colors are searched once per unique color; with dithering
+// pixels are mapped in order (Floyd-Steinberg error diffusion), transparent pixels do not diffuse error
+static void MapPaletteColors(const Color *pixels, int width, int height, const Color *palette, int count, bool dither, unsigned char *indices, Color *colors)
 {
-    Color color;
+    PaletteSearch *search = LoadPaletteSearch(palette, count);
 
-    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
-    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
-    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
-    color.a = (unsigned char)hexValue & 0xFF;
+    if (!dither)
+    {
+        ColorHistogram histogram = LoadColorHistogram(pixels, width*height, false);
 
-    return color;
-}
+        PaletteMapData map = { 0 };
+        map.pixels = pixels;
+        map.width = width;
+        map.histogram = &histogram;
+        map.entries = histogram.entries;
+        map.search = search;
+        map.entryIndices = (int *)RL_MALLOC(histogram.count*sizeof(int));
+        map.palette = palette;
+        map.indices = indices;
+        map.colors = colors;
 
-// Get color from a pixel from certain format
-Color GetPixelColor(void *srcPtr, int format)
-{
-    Color color = { 0 };
+        ParallelFor(histogram.count, IMAGE_PALETTE_BATCH_COLORS, MapEntriesRange, &map);
+        ProcessImageRows(width, height, MapPixelsRange, &map);
 
-    switch (format)
+        RL_FREE(map.entryIndices);
+        UnloadColorHistogram(histogram);
+    }
+    else
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+        // Error rows (current and next), channels error scaled by 16, padded with one pixel per side
+        int *errors = (int *)RL_CALLOC(2*(width + 2)*4, sizeof(int));
+        int *current = errors + 4;
+        int *next = errors + (width + 2)*4 + 4;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        for (int y = 0; y < height; y++)
         {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+            for (int x = 0; x < width; x++)
+            {
+                int i = y*width + x;
+                Color color = pixels[i];
+                int index = 0;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
+                if (color.a == 0) index = GetPaletteNearest(search, BLANK);
+                else
+                {
+                    int values[4] = { 0 };
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
+                    for (int c = 0; c < 4; c++)
+                    {
+                        int value = (&color.r)[c] + current[x*4 + c]/16;
+                        values[c] = (value < 0)? 0 : ((value > 255)? 255 : value);
+                    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+                    index = GetPaletteNearest(search, (Color){ (unsigned char)values[0], (unsigned char)values[1], (unsigned char)values[2], (unsigned char)values[3] });
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.a = 255;
+                    for (int c = 0; c < 4; c++)
+                    {
+                        int error = values[c] - (&palette[index].r)[c];
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = 255;
+                        current[(x + 1)*4 + c] += error*7;
+                        next[(x - 1)*4 + c] += error*3;
+                        next[x*4 + c] += error*5;
+                        next[(x + 1)*4 + c] += error;
+                    }
+                }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
+                if (indices != NULL) indices[i] = (unsigned char)index;
+                if (colors != NULL) colors[i] = palette[index];
+            }
 
-        } break;
-        default: break;
+            // Swap error rows, next row errors cleared
+            int *swap = current;
+            current = next;
+            next = swap;
+            memset(next - 4, 0, (width + 2)*4*sizeof(int));
+        }
+
+        RL_FREE(errors);
     }
 
-    return color;
+    UnloadPaletteSearch(search);
 }
 
-// Set pixel color formatted into destination pointer
-void SetPixelColor(void *dstPtr, Color color, int format)
+// Map unique colors entries range [start, end) to nearest palette colors, parallel-for callback
+static void MapEntriesRange(int start, int end, void *userData)
 {
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dstPtr)[0] = gray;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    PaletteMapData *map = (PaletteMapData *)userData;
 
-            ((unsigned char *)dstPtr)[0] = gray;
-            ((unsigned char *)dstPtr)[1] = color.a;
+    for (int i = start; i < end; i++) map->entryIndices[i] = GetPaletteNearest(map->search, map->entries[i].color);
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+// Map pixels rows range [start, end) to nearest palette colors, parallel-for callback
+static void MapPixelsRange(int start, int end, void *userData)
+{
+    PaletteMapData *map = (PaletteMapData *)userData;
+    unsigned int lastKey = 0;
+    int lastIndex = -1;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+    for (int i = start*map->width; i < end*map->width; i++)
+    {
+        Color color = map->pixels[i];
+        if (color.a == 0) color = BLANK;
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+        unsigned int key = GetColorKey(color);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        if ((lastIndex < 0) || (key != lastKey))
         {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            lastIndex = map->entryIndices[GetColorHistogramEntry(map->histogram, color)];
+            lastKey = key;
+        }
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+        if (map->indices != NULL) map->indices[i] = (unsigned char)lastIndex;
+        if (map->colors != NULL) map->colors[i] = map->palette[lastIndex];
+    }
+}
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+#if defined(EXPORT_PNG_SDEFL)
+// Encode pixels into PNG file data (8-bit channels: 1-Grayscale, 2-Gray alpha, 3-RGB, 4-RGBA)
+// NOTE: Filtered rows are split in blocks compressed in parallel as deflate streams
+// continued one after another (sync flushed), blocks adler32 checksums are combined
+static unsigned char *EncodePng(const unsigned char *pixels, int width, int height, int channels, int level, int *dataSize)
+{
+    static const unsigned char colorTypes[5] = { 0, 0, 4, 2, 6 };  // PNG color type by channels count
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    int stride = width*channels;
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+    PngEncodeData png = { 0 };
+    png.pixels = pixels;
+    png.width = width;
+    png.height = height;
+    png.channels = channels;
+    png.level = level;
+    png.blockRows = IMAGE_PNG_BLOCK_BYTES/(stride + 1);
+    if (png.blockRows < 1) png.blockRows = 1;
+    png.blockCount = (height + png.blockRows - 1)/png.blockRows;
+    png.blocks = (unsigned char **)RL_CALLOC(png.blockCount, sizeof(unsigned char *));
+    png.blockSizes = (int *)RL_CALLOC(png.blockCount, sizeof(int));
+    png.blockAdlers = (unsigned int *)RL_CALLOC(png.blockCount, sizeof(unsigned int));
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+    ParallelFor(png.blockCount, 1, EncodePngBlocksRange, &png);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
+    // Zlib stream: header, blocks deflate streams, filtered data adler32 checksum
+    int idatSize = 2 + 4;
+    unsigned int adler = 1;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-            ((unsigned char *)dstPtr)[3] = color.a;
+    for (int b = 0; b < png.blockCount; b++)
+    {
+        int blockDataSize = ((b < (png.blockCount - 1))? png.blockRows : (height - b*png.blockRows))*(stride + 1);
 
-        } break;
-        default: break;
+        idatSize += png.blockSizes[b];
+        adler = CombineAdler32(adler, png.blockAdlers[b], blockDataSize);
     }
-}
 
-// Get pixel data size in bytes for certain format
-// NOTE: Size can be requested for Image or Texture data
-int GetPixelDataSize(int width, int height, int format)
-{
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+    // File data: signature, IHDR chunk, IDAT chunk, IEND chunk
+    *dataSize = 8 + (12 + 13) + (12 + idatSize) + 12;
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(*dataSize);
+    unsigned char *ptr = fileData;
 
-    switch (format)
+    unsigned int crcTable[256] = { 0 };
+    for (unsigned int n = 0; n < 256; n++)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
-        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
-        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
-        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
-        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
+        unsigned int c = n;
+        for (int k = 0; k < 8; k++) c = (c & 1)? (0xedb88320u ^ (c >> 1)) : (c >> 1);
+        crcTable[n] = c;
     }
 
-    double bytesPerPixel = (double)bpp/8.0;
-    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
+    memcpy(ptr, "\x89PNG\r\n\x1a\n", 8);
+    ptr += 8;
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    unsigned char header[13] = {
+        (unsigned char)(width >> 24), (unsigned char)(width >> 16), (unsigned char)(width >> 8), (unsigned char)width,
+        (unsigned char)(height >> 24), (unsigned char)(height >> 16), (unsigned char)(height >> 8), (unsigned char)height,
+        8, colorTypes[channels], 0, 0, 0    // Bit depth, color type, compression, filter, interlace
+    };
+
+    ptr = WritePngChunk(ptr, "IHDR", header, 13, crcTable);
+
+    // NOTE: IDAT chunk data written in place, chunk CRC computed once data is complete
+    unsigned char *idat = ptr + 8;
+    unsigned char *idatPtr = idat;
+
+    *idatPtr++ = 0x78;      // Deflate, 32K window
+    *idatPtr++ = 0x01;      // No preset dictionary, fastest compression (check bits)
+
+    for (int b = 0; b < png.blockCount; b++)
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        memcpy(idatPtr, png.blocks[b], png.blockSizes[b]);
+        idatPtr += png.blockSizes[b];
+        RL_FREE(png.blocks[b]);
     }
 
-    return dataSize;
-}
+    for (int i = 0; i < 4; i++) *idatPtr++ = (unsigned char)(adler >> (24 - i*8));
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-// Convert half-float (stored as unsigned short) to float
-// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-static float HalfToFloat(unsigned short x)
-{
-    float result = 0.0f;
+    ptr = WritePngChunk(ptr, "IDAT", NULL, idatSize, crcTable);
+    ptr = WritePngChunk(ptr, "IEND", NULL, 0, crcTable);
 
-    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
-    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
-    const float fm = (float)m;
-    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
-    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+    RL_FREE(png.blocks);
+    RL_FREE(png.blockSizes);
+    RL_FREE(png.blockAdlers);
 
-    result = *(float *)&r;
+    return fileData;
+}
 
-    return result;
+// Write PNG chunk: length, type, data and CRC, returns pointer after chunk
+// NOTE: If data is NULL, chunk data is expected to be already written after chunk type
+static unsigned char *WritePngChunk(unsigned char *ptr, const char *type, const unsigned char *data, int size, const unsigned int *crcTable)
+{
+    ptr[0] = (unsigned char)(size >> 24);
+    ptr[1] = (unsigned char)(size >> 16);
+    ptr[2] = (unsigned char)(size >> 8);
+    ptr[3] = (unsigned char)size;
+    memcpy(ptr + 4, type, 4);
+    if (data != NULL) memcpy(ptr + 8, data, size);
+
+    // CRC computed over chunk type and data
+    unsigned int crc = 0xffffffffu;
+    for (int i = 0; i < (size + 4); i++) crc = crcTable[(crc ^ ptr[4 + i]) & 0xff] ^ (crc >> 8);
+    crc ^= 0xffffffffu;
+
+    ptr += (8 + size);
+    ptr[0] = (unsigned char)(crc >> 24);
+    ptr[1] = (unsigned char)(crc >> 16);
+    ptr[2] = (unsigned char)(crc >> 8);
+    ptr[3] = (unsigned char)crc;
+
+    return ptr + 4;
 }
 
-// Convert float to half-float (stored as unsigned short)
-static unsigned short FloatToHalf(float x)
+// Encode PNG blocks range [start, end): rows filtered and compressed, EncodePng() parallel-for callback
+// NOTE: Row filter is selected by minimum sum of absolute filtered values (signed), like libpng heuristic
+static void EncodePngBlocksRange(int start, int end, void *userData)
 {
-    unsigned short result = 0;
+    PngEncodeData *png = (PngEncodeData *)userData;
+    int stride = png->width*png->channels;
 
-    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
-    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+    unsigned char *filters = (unsigned char *)RL_MALLOC(5*stride);     // Row filtered by every filter type
+    unsigned char *zeroRow = (unsigned char *)RL_CALLOC(stride, 1);    // Previous row of first image row
+    struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));  // WARNING: struct sdefl is almost 1MB
 
-    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+    for (int b = start; b < end; b++)
+    {
+        int firstRow = b*png->blockRows;
+        int rowCount = ((firstRow + png->blockRows) < png->height)? png->blockRows : (png->height - firstRow);
+        int size = rowCount*(stride + 1);
+        unsigned char *filtered = (unsigned char *)RL_MALLOC(size);
 
-    return result;
+        for (int r = 0; r < rowCount; r++)
+        {
+            int y = firstRow + r;
+            const unsigned char *row = png->pixels + y*stride;
+            const unsigned char *prev = (y > 0)? (row - stride) : zeroRow;
+            unsigned int bestCost = 0xffffffffu;
+            int bestFilter = 0;
+
+            for (int filter = 0; filter < 5; filter++)
+            {
+                unsigned int cost = FilterPngRow(row, prev, stride, png->channels, filter, filters + filter*stride);
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestFilter = filter;
+                }
+            }
+
+            filtered[r*(stride + 1)] = (unsigned char)bestFilter;
+            memcpy(filtered + r*(stride + 1) + 1, filters + bestFilter*stride, stride);
+        }
+
+        png->blockAdlers[b] = ComputeAdler32(1, filtered, size);
+        png->blocks[b] = (unsigned char *)RL_MALLOC(sdefl_bound(size));
+        png->blockSizes[b] = sdeflate_part(sdefl, png->blocks[b], filtered, size, png->level, (b == (png->blockCount - 1)));
+
+        RL_FREE(filtered);
+    }
+
+    RL_FREE(sdefl);
+    RL_FREE(zeroRow);
+    RL_FREE(filters);
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Filter PNG row with filter type (0-None, 1-Sub, 2-Up, 3-Average, 4-Paeth), returns sum of absolute filtered values
+static unsigned int FilterPngRow(const unsigned char *row, const unsigned char *prev, int stride, int bpp, int filter, unsigned char *out)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    int i = 0;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    if (filter == 0) memcpy(out, row, stride);
     else
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        // First pixel has no left neighbours: Sub and None are equivalent, Paeth predictor is up value
+        for (; i < bpp; i++)
         {
-            switch (image.format)
+            int predictor = (filter == 1)? 0 : ((filter == 3)? (prev[i] >> 1) : prev[i]);
+            out[i] = (unsigned char)(row[i] - predictor);
+        }
+
+#if defined(RL_SIMD_SSE2)
+        __m128i zero = _mm_setzero_si128();
+        __m128i one = _mm_set1_epi8(1);
+
+        for (; (i + 16) <= stride; i += 16)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)(row + i));
+            __m128i a = _mm_loadu_si128((const __m128i *)(row + i - bpp));
+            __m128i b = _mm_loadu_si128((const __m128i *)(prev + i));
+            __m128i predictor = zero;
+
+            if (filter == 1) predictor = a;
+            else if (filter == 2) predictor = b;
+            else if (filter == 3) predictor = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));  // Rounded down average
+            else
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                // Paeth predictor, 16-bit lanes: nearest of a, b, c to a + b - c (ties order: a, b, c)
+                __m128i c = _mm_loadu_si128((const __m128i *)(prev + i - bpp));
+                __m128i halves[2] = { zero, zero };
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                for (int h = 0; h < 2; h++)
                 {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    __m128i a16 = (h == 0)? _mm_unpacklo_epi8(a, zero) : _mm_unpackhi_epi8(a, zero);
+                    __m128i b16 = (h == 0)? _mm_unpacklo_epi8(b, zero) : _mm_unpackhi_epi8(b, zero);
+                    __m128i c16 = (h == 0)? _mm_unpacklo_epi8(c, zero) : _mm_unpackhi_epi8(c, zero);
+                    __m128i pa = _mm_sub_epi16(b16, c16);
+                    __m128i pb = _mm_sub_epi16(a16, c16);
+                    __m128i pc = _mm_add_epi16(pa, pb);
+
+                    pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+                    pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+                    pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+                    __m128i notA = _mm_or_si128(_mm_cmpgt_epi16(pa, pb), _mm_cmpgt_epi16(pa, pc));
+                    __m128i notB = _mm_cmpgt_epi16(pb, pc);
+                    __m128i bc = _mm_or_si128(_mm_and_si128(notB, c16), _mm_andnot_si128(notB, b16));
+
+                    halves[h] = _mm_or_si128(_mm_and_si128(notA, bc), _mm_andnot_si128(notA, a16));
+                }
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                predictor = _mm_packus_epi16(halves[0], halves[1]);
+            }
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+            _mm_storeu_si128((__m128i *)(out + i), _mm_sub_epi8(x, predictor));
+        }
+#elif defined(RL_SIMD_NEON)
+        for (; (i + 16) <= stride; i += 16)
+        {
+            uint8x16_t x = vld1q_u8(row + i);
+            uint8x16_t a = vld1q_u8(row + i - bpp);
+            uint8x16_t b = vld1q_u8(prev + i);
+            uint8x16_t predictor = vdupq_n_u8(0);
+
+            if (filter == 1) predictor = a;
+            else if (filter == 2) predictor = b;
+            else if (filter == 3) predictor = vhaddq_u8(a, b);     // Rounded down average
+            else
+            {
+                // Paeth predictor, 16-bit distances: nearest of a, b, c to a + b - c (ties order: a, b, c)
+                uint8x16_t c = vld1q_u8(prev + i - bpp);
+                uint8x8_t halves[2];
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                for (int h = 0; h < 2; h++)
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    uint8x8_t a8 = (h == 0)? vget_low_u8(a) : vget_high_u8(a);
+                    uint8x8_t b8 = (h == 0)? vget_low_u8(b) : vget_high_u8(b);
+                    uint8x8_t c8 = (h == 0)? vget_low_u8(c) : vget_high_u8(c);
+                    uint16x8_t pa = vabdl_u8(b8, c8);
+                    uint16x8_t pb = vabdl_u8(a8, c8);
+                    uint16x8_t pc = vabdq_u16(vaddl_u8(a8, b8), vshll_n_u8(c8, 1));
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+                    uint8x8_t notA = vmovn_u16(vorrq_u16(vcgtq_u16(pa, pb), vcgtq_u16(pa, pc)));
+                    uint8x8_t notB = vmovn_u16(vcgtq_u16(pb, pc));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    halves[h] = vbsl_u8(notA, vbsl_u8(notB, c8, b8), a8);
+                }
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+                predictor = vcombine_u8(halves[0], halves[1]);
+            }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+            vst1q_u8(out + i, vsubq_u8(x, predictor));
+        }
+#endif
+        for (; i < stride; i++)
+        {
+            int a = row[i - bpp];
+            int b = prev[i];
+            int c = prev[i - bpp];
+            int predictor = 0;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            switch (filter)
+            {
+                case 1: predictor = a; break;
+                case 2: predictor = b; break;
+                case 3: predictor = (a + b) >> 1; break;
+                case 4:
                 {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+                    int pa = abs(b - c);
+                    int pb = abs(a - c);
+                    int pc = abs(a + b - 2*c);
 
-                    k += 3;
+                    predictor = ((pa <= pb) && (pa <= pc))? a : ((pb <= pc)? b : c);
                 } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                default: break;
+            }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+            out[i] = (unsigned char)(row[i] - predictor);
+        }
+    }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+    // Filtered values cost: sum of absolute values (signed bytes)
+    unsigned int cost = 0;
+    i = 0;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+#if defined(RL_SIMD_SSE2)
+    __m128i sum = _mm_setzero_si128();
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+    for (; (i + 16) <= stride; i += 16)
+    {
+        __m128i value = _mm_loadu_si128((const __m128i *)(out + i));
 
-                    k += 4;
-                } break;
-                default: break;
-            }
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_min_epu8(value, _mm_sub_epi8(_mm_setzero_si128(), value)), _mm_setzero_si128()));
+    }
+
+    cost = (unsigned int)(_mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8)));
+#elif defined(RL_SIMD_NEON)
+    uint32x4_t sum = vdupq_n_u32(0);
+
+    for (; (i + 16) <= stride; i += 16)
+    {
+        uint8x16_t value = vld1q_u8(out + i);
+
+        sum = vpadalq_u16(sum, vpaddlq_u8(vminq_u8(value, vsubq_u8(vdupq_n_u8(0), value))));
+    }
+
+    cost = vgetq_lane_u32(sum, 0) + vgetq_lane_u32(sum, 1) + vgetq_lane_u32(sum, 2) + vgetq_lane_u32(sum, 3);
+#endif
+    for (; i < stride; i++) cost += (out[i] < 128)? out[i] : (256 - out[i]);
+
+    return cost;
+}
+
+// Compute adler32 checksum of data, continued from adler value (initial value: 1)
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int size)
+{
+    unsigned int s1 = adler & 0xffff;
+    unsigned int s2 = adler >> 16;
+
+    while (size > 0)
+    {
+        // NOTE: 5552 is the largest count of bytes summed before s2 could overflow 32-bit
+        int count = (size < 5552)? size : 5552;
+
+        for (int i = 0; i < count; i++)
+        {
+            s1 += data[i];
+            s2 += s1;
         }
+
+        s1 %= 65521;
+        s2 %= 65521;
+        data += count;
+        size -= count;
     }
 
-    return pixels;
+    return (s2 << 16) | s1;
+}
+
+// Combine adler32 checksums of two consecutive data blocks (second block size required)
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int size2)
+{
+    unsigned int remainder = (unsigned int)(size2%65521);
+    unsigned int s1 = adler1 & 0xffff;
+    unsigned int s2 = (unsigned int)(((unsigned long long)remainder*s1)%65521);
+
+    s1 += (adler2 & 0xffff) + 65521 - 1;
+    s2 += (adler1 >> 16) + (adler2 >> 16) + 65521 - remainder;
+
+    if (s1 >= 65521) s1 -= 65521;
+    if (s1 >= 65521) s1 -= 65521;
+    if (s2 >= (65521 << 1)) s2 -= (65521 << 1);
+    if (s2 >= 65521) s2 -= 65521;
+
+    return (s2 << 16) | s1;
 }
+#endif
 
 #endif      // SUPPORT_MODULE_RTEXTURES
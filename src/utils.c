@@ -49,12 +49,114 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(_WIN32)
+    #include <process.h>                // Required for: _beginthreadex()
+
+// NOTE: We declare required kernel32 functions to avoid including windows.h
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+__declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+__declspec(dllimport) int __stdcall SwitchToThread(void);
+__declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+__declspec(dllimport) void __stdcall InitializeSRWLock(void *srwLock);
+__declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void *srwLock);
+__declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void *srwLock);
+__declspec(dllimport) void __stdcall InitializeConditionVariable(void *conditionVariable);
+__declspec(dllimport) int __stdcall SleepConditionVariableSRW(void *conditionVariable, void *srwLock, unsigned long dwMilliseconds, unsigned long flags);
+__declspec(dllimport) void __stdcall WakeConditionVariable(void *conditionVariable);
+__declspec(dllimport) void __stdcall WakeAllConditionVariable(void *conditionVariable);
+__declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long desiredAccess, unsigned long shareMode, void *securityAttributes, unsigned long creationDisposition, unsigned long flagsAndAttributes, void *templateFile);
+__declspec(dllimport) int __stdcall GetFileSizeEx(void *hFile, long long *fileSize);
+__declspec(dllimport) void *__stdcall CreateFileMappingA(void *hFile, void *attributes, unsigned long protect, unsigned long maximumSizeHigh, unsigned long maximumSizeLow, const char *name);
+__declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long desiredAccess, unsigned long fileOffsetHigh, unsigned long fileOffsetLow, size_t numberOfBytesToMap);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void *baseAddress);
+#else
+    #include <sched.h>                  // Required for: sched_yield()
+    #include <unistd.h>                 // Required for: sysconf(), close()
+    #if !defined(PLATFORM_WEB) && !defined(PLATFORM_ANDROID)
+        #include <fcntl.h>              // Required for: open()
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #define RL_FILE_MAPPING_POSIX
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_TRACELOG_ASYNC_RECORDS
+    #define MAX_TRACELOG_ASYNC_RECORDS  256         // Max trace-log messages queued for async output (power of two)
+#endif
+#ifndef TEMP_MEMORY_BLOCK_SIZE
+    #define TEMP_MEMORY_BLOCK_SIZE   262144         // Temporary memory arena block size (bytes)
+#endif
+#ifndef MAX_TEMP_MEMORY_SCOPES
+    #define MAX_TEMP_MEMORY_SCOPES       16         // Maximum nested temporary memory scopes per thread
+#endif
+#ifndef TEMP_MEMORY_SHRINK_FRAMES
+    #define TEMP_MEMORY_SHRINK_FRAMES   120         // Frames fitting in default block size before frame arena grown block is released
+#endif
+
+#define TEMP_MEMORY_ALIGNMENT            16         // Temporary memory allocations alignment (and header size)
+#define TEMP_MEMORY_NO_TOP       0xffffffffu        // Temporary memory block without allocations to release
+#define TEMP_MEMORY_FALLBACK     0xfffffffeu        // Temporary memory allocation header mark, allocated out of arena (RL_MALLOC())
+#define TEMP_MEMORY_BLOCK_HEADER ((sizeof(TempMemoryBlock) + TEMP_MEMORY_ALIGNMENT - 1) & ~(TEMP_MEMORY_ALIGNMENT - 1))
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Trace log record, formatted message queued for async output
+typedef struct TraceLogRecord {
+    unsigned int sequence;          // Record sequence (atomic), equals write position when free, position + 1 when written
+    int logType;                    // Message log type
+    char text[MAX_TRACELOG_MSG_LENGTH]; // Message text (formatted)
+} TraceLogRecord;
+
+// Trace log async output, bounded multiple-producers single-consumer lock-free ring of records
+// NOTE: Producers never block, messages are dropped if ring is full, output thread only
+// sleeps when ring is empty and it is woken by producers only if sleeping
+typedef struct TraceLogAsync {
+    TraceLogRecord records[MAX_TRACELOG_ASYNC_RECORDS]; // Records ring
+    unsigned int head;              // Next record write position (atomic)
+    unsigned int tail;              // Next record read position (output thread)
+    int dropped;                    // Messages dropped, ring full (atomic)
+    int writers;                    // Producers writing records (atomic)
+    int running;                    // Async output enabled (atomic)
+    int sleeping;                   // Output thread waiting for records (atomic)
+    rThread thread;                 // Output thread
+    rMutex mutex;                   // Output thread sleep mutex
+    rCondition condition;           // Output thread wake up condition
+} TraceLogAsync;
+
+// Temporary memory block, allocations data follows the block header
+// NOTE: Every allocation is preceded by TEMP_MEMORY_ALIGNMENT bytes storing previous allocation
+// offset, so the last allocation can be released (stack-like), others are released on reset
+typedef struct TempMemoryBlock {
+    struct TempMemoryBlock *next;   // Next block in chain (following blocks are unused)
+    unsigned int size;              // Block data size
+    unsigned int offset;            // Block data used
+    unsigned int top;               // Last allocation header offset (TEMP_MEMORY_NO_TOP if none)
+} TempMemoryBlock;
+
+// Temporary memory scope mark, state restored at scope end
+typedef struct TempMemoryMark {
+    TempMemoryBlock *block;         // Current block at scope begin
+    unsigned int offset;            // Current block offset at scope begin
+    unsigned int top;               // Current block last allocation at scope begin
+} TempMemoryMark;
+
+// Temporary memory arena, one per thread
+typedef struct TempMemory {
+    TempMemoryBlock *first;         // First block in chain
+    TempMemoryBlock *current;       // Current block (NULL: no allocations)
+    TempMemoryMark scopes[MAX_TEMP_MEMORY_SCOPES];  // Scopes marks
+    int scopeDepth;                 // Scopes nesting depth
+    bool frame;                     // Arena reset every frame (main thread, EndDrawing())
+    unsigned int framePeak;         // Frame first block peak usage (bytes), 0xffffffff if several blocks required
+    int shrinkFrames;               // Consecutive frames fitting in default block size, first block grown over it
+} TempMemory;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +169,13 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+static RL_THREAD_LOCAL TempMemory tempMemory = { 0 };   // Temporary memory arena (current thread)
+
+#if defined(SUPPORT_TRACELOG)
+static TraceLogAsync traceLogAsync = { 0 };                 // Trace log async output
+static RL_THREAD_LOCAL bool traceLogOutputThread = false;   // Current thread is trace log async output thread
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -95,6 +204,29 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_TRACELOG)
+static void OutputTraceLog(int logType, const char *text);      // Output formatted trace log message (callback or standard output)
+static void CallTraceLogCallback(int logType, const char *text, ...); // Call trace log callback with message arguments
+static bool PushTraceLogRecord(int logType, const char *text, va_list args); // Push formatted message to async ring, false if full
+static bool PopTraceLogRecord(void);                            // Pop and output next async ring message, false if empty
+static void TraceLogAsyncThread(void *arg);                     // Trace log async output thread loop
+#endif
+
+static void *GetTempMemoryBlockData(TempMemoryBlock *block);    // Get temporary memory block data pointer
+static TempMemoryBlock *FindTempMemoryBlock(const void *ptr);   // Find temporary memory block containing pointer (current thread)
+
+// Thread start data, required to adapt rThreadFunc signature to platform thread entry point
+typedef struct rThreadStart {
+    rThreadFunc func;
+    void *arg;
+} rThreadStart;
+
+#if defined(_WIN32)
+static unsigned int __stdcall ThreadEntry(void *arg);       // Platform thread entry point
+#else
+static void *ThreadEntry(void *arg);                        // Platform thread entry point
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -102,6 +234,58 @@ static int android_close(void *cookie);
 // Set the current threshold (minimum) log level
 void SetTraceLogLevel(int logType) { logTypeLevel = logType; }
 
+// Set trace log messages output on a background thread
+// NOTE: Messages are formatted on calling thread and queued, TraceLog() never blocks on output,
+// if queue is full messages are dropped (and reported), disabling it outputs all queued messages
+// WARNING: Trace log callback is called from the output thread while enabled
+void SetTraceLogAsync(bool enabled)
+{
+#if defined(SUPPORT_TRACELOG)
+    if (traceLogOutputThread) return;
+
+    if (enabled && !RL_ATOMIC_LOAD(&traceLogAsync.running))
+    {
+        // Records are free for next ring lap, ring positions continue from previous use
+        for (unsigned int i = 0; i < MAX_TRACELOG_ASYNC_RECORDS; i++)
+        {
+            unsigned int position = traceLogAsync.head + i;
+            traceLogAsync.records[position & (MAX_TRACELOG_ASYNC_RECORDS - 1)].sequence = position;
+        }
+        traceLogAsync.tail = traceLogAsync.head;
+
+        rMutexInit(&traceLogAsync.mutex);
+        rConditionInit(&traceLogAsync.condition);
+        RL_ATOMIC_CAS(&traceLogAsync.running, 0, 1);
+
+        if (!rThreadCreate(&traceLogAsync.thread, TraceLogAsyncThread, NULL))
+        {
+            RL_ATOMIC_CAS(&traceLogAsync.running, 1, 0);
+            rConditionDestroy(&traceLogAsync.condition);
+            rMutexDestroy(&traceLogAsync.mutex);
+
+            TRACELOG(LOG_WARNING, "TRACELOG: Failed to create async output thread");
+        }
+    }
+    else if (!enabled && RL_ATOMIC_LOAD(&traceLogAsync.running))
+    {
+        rMutexLock(&traceLogAsync.mutex);
+        RL_ATOMIC_CAS(&traceLogAsync.running, 1, 0);
+        rConditionSignal(&traceLogAsync.condition);
+        rMutexUnlock(&traceLogAsync.mutex);
+
+        // Wait for producers that could still be pushing records, then for output thread
+        while (RL_ATOMIC_LOAD(&traceLogAsync.writers) > 0) rThreadYield();
+        rThreadJoin(traceLogAsync.thread);
+
+        // Output records pushed after output thread finished
+        while (PopTraceLogRecord());
+
+        rConditionDestroy(&traceLogAsync.condition);
+        rMutexDestroy(&traceLogAsync.mutex);
+    }
+#endif
+}
+
 // Show trace log messages (LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_DEBUG)
 void TraceLog(int logType, const char *text, ...)
 {
@@ -112,6 +296,25 @@ void TraceLog(int logType, const char *text, ...)
     va_list args;
     va_start(args, text);
 
+    // Async output: message is formatted and queued, fatal messages are output after
+    // queued ones and directly, output thread messages (from callback) are output directly
+    if ((logType != LOG_FATAL) && !traceLogOutputThread)
+    {
+        RL_ATOMIC_ADD(&traceLogAsync.writers, 1);
+
+        if (RL_ATOMIC_LOAD(&traceLogAsync.running))
+        {
+            if (!PushTraceLogRecord(logType, text, args)) RL_ATOMIC_ADD(&traceLogAsync.dropped, 1);
+            RL_ATOMIC_ADD(&traceLogAsync.writers, -1);
+
+            va_end(args);
+            return;
+        }
+
+        RL_ATOMIC_ADD(&traceLogAsync.writers, -1);
+    }
+    else if ((logType == LOG_FATAL) && !traceLogOutputThread) SetTraceLogAsync(false);
+
     if (traceLog)
     {
         traceLog(logType, text, args);
@@ -179,6 +382,208 @@ void MemFree(void *ptr)
     RL_FREE(ptr);
 }
 
+// Temporary memory allocator
+// NOTE: Memory is bump-allocated from current thread arena, released at EndDrawing() (main thread)
+// or at EndTempMemory() (scope), out of a frame or scope it falls back to RL_MALLOC(),
+// fallback allocations are marked in their header and must be released with MemFreeTemp()
+void *MemAllocTemp(unsigned int size)
+{
+    TempMemory *temp = &tempMemory;
+
+    if (!temp->frame && (temp->scopeDepth == 0))
+    {
+        unsigned char *header = (unsigned char *)RL_MALLOC(TEMP_MEMORY_ALIGNMENT + size);
+        if (header == NULL) return NULL;
+
+        *(unsigned int *)header = TEMP_MEMORY_FALLBACK;
+
+        return header + TEMP_MEMORY_ALIGNMENT;
+    }
+
+    unsigned int required = TEMP_MEMORY_ALIGNMENT + ((size + TEMP_MEMORY_ALIGNMENT - 1) & ~(TEMP_MEMORY_ALIGNMENT - 1));
+    TempMemoryBlock *block = temp->current;
+
+    if ((block == NULL) || ((block->size - block->offset) < required))
+    {
+        // Move to next unused block in chain or insert a new block after current one
+        TempMemoryBlock *next = (block != NULL)? block->next : temp->first;
+
+        if ((next == NULL) || (next->size < required))
+        {
+            unsigned int blockSize = (required > TEMP_MEMORY_BLOCK_SIZE)? required : TEMP_MEMORY_BLOCK_SIZE;
+            TempMemoryBlock *newBlock = (TempMemoryBlock *)RL_MALLOC(TEMP_MEMORY_BLOCK_HEADER + blockSize);
+            if (newBlock == NULL) return NULL;
+
+            newBlock->size = blockSize;
+            newBlock->next = next;
+
+            if (block != NULL) block->next = newBlock;
+            else temp->first = newBlock;
+
+            next = newBlock;
+        }
+
+        next->offset = 0;
+        next->top = TEMP_MEMORY_NO_TOP;
+        temp->current = next;
+        block = next;
+    }
+
+    unsigned char *header = (unsigned char *)GetTempMemoryBlockData(block) + block->offset;
+    *(unsigned int *)header = block->top;
+
+    block->top = block->offset;
+    block->offset += required;
+
+    if (block != temp->first) temp->framePeak = 0xffffffffu;
+    else if (block->offset > temp->framePeak) temp->framePeak = block->offset;
+
+    return header + TEMP_MEMORY_ALIGNMENT;
+}
+
+// Temporary memory free
+// NOTE: Arena memory is owned by the frame or scope it was allocated in, only the last allocation
+// of current thread arena is released immediately, others are released at frame or scope end;
+// memory of another thread arena is never released, fallback memory (out of arena) is freed
+void MemFreeTemp(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    TempMemoryBlock *block = FindTempMemoryBlock(ptr);
+
+    if (block == NULL)
+    {
+        // Arena allocations headers store an offset in block, never the fallback mark
+        unsigned char *header = (unsigned char *)ptr - TEMP_MEMORY_ALIGNMENT;
+        if (*(unsigned int *)header == TEMP_MEMORY_FALLBACK) RL_FREE(header);
+    }
+    else if ((block == tempMemory.current) && (block->top != TEMP_MEMORY_NO_TOP))
+    {
+        unsigned char *header = (unsigned char *)GetTempMemoryBlockData(block) + block->top;
+
+        if ((header + TEMP_MEMORY_ALIGNMENT) == (unsigned char *)ptr)
+        {
+            block->offset = block->top;
+            block->top = *(unsigned int *)header;
+        }
+    }
+}
+
+// Begin temporary memory scope (current thread)
+// NOTE: Temporary allocations done within the scope are released at EndTempMemory(),
+// jobs run in their own scope, so worker threads always have temporary memory available
+void BeginTempMemory(void)
+{
+    TempMemory *temp = &tempMemory;
+
+    if (temp->scopeDepth < MAX_TEMP_MEMORY_SCOPES)
+    {
+        TempMemoryBlock *block = temp->current;
+        temp->scopes[temp->scopeDepth] = (TempMemoryMark){ block, (block != NULL)? block->offset : 0, (block != NULL)? block->top : TEMP_MEMORY_NO_TOP };
+    }
+    else if (temp->scopeDepth == MAX_TEMP_MEMORY_SCOPES) TRACELOG(LOG_WARNING, "MEMORY: Temporary memory scopes limit reached, nested scopes are merged");
+
+    temp->scopeDepth++;
+}
+
+// End temporary memory scope, releasing temporary allocations done within it
+void EndTempMemory(void)
+{
+    TempMemory *temp = &tempMemory;
+
+    if (temp->scopeDepth == 0)
+    {
+        TRACELOG(LOG_WARNING, "MEMORY: EndTempMemory() called without BeginTempMemory()");
+        return;
+    }
+
+    temp->scopeDepth--;
+
+    if (temp->scopeDepth < MAX_TEMP_MEMORY_SCOPES)
+    {
+        TempMemoryMark mark = temp->scopes[temp->scopeDepth];
+
+        temp->current = mark.block;
+
+        if (mark.block != NULL)
+        {
+            mark.block->offset = mark.offset;
+            mark.block->top = mark.top;
+        }
+    }
+}
+
+// Set current thread temporary memory as frame memory, released by ResetTempMemoryFrame()
+void InitTempMemoryFrame(void)
+{
+    tempMemory.frame = true;
+}
+
+// Release frame temporary memory allocations (current thread)
+// NOTE: If several blocks were required, they are merged into a single one for next frames,
+// merged block is released after TEMP_MEMORY_SHRINK_FRAMES frames fitting in default block size
+void ResetTempMemoryFrame(void)
+{
+    TempMemory *temp = &tempMemory;
+
+    if (!temp->frame) return;
+    if (temp->scopeDepth > 0)
+    {
+        TRACELOG(LOG_WARNING, "MEMORY: Temporary memory scope not ended on frame end");
+        return;
+    }
+
+    if ((temp->first != NULL) && (temp->first->next != NULL))
+    {
+        unsigned int totalSize = 0;
+
+        for (TempMemoryBlock *block = temp->first, *next = NULL; block != NULL; block = next)
+        {
+            next = block->next;
+            totalSize += block->size;
+            RL_FREE(block);
+        }
+
+        temp->first = (TempMemoryBlock *)RL_MALLOC(TEMP_MEMORY_BLOCK_HEADER + totalSize);
+
+        if (temp->first != NULL)
+        {
+            temp->first->size = totalSize;
+            temp->first->next = NULL;
+        }
+
+        temp->shrinkFrames = 0;
+    }
+    else if ((temp->first != NULL) && (temp->first->size > TEMP_MEMORY_BLOCK_SIZE))
+    {
+        // Release grown block once usage peak is over, default size block is allocated on demand
+        if (temp->framePeak <= TEMP_MEMORY_BLOCK_SIZE) temp->shrinkFrames++;
+        else temp->shrinkFrames = 0;
+
+        if (temp->shrinkFrames >= TEMP_MEMORY_SHRINK_FRAMES)
+        {
+            RL_FREE(temp->first);
+            temp->first = NULL;
+            temp->shrinkFrames = 0;
+        }
+    }
+
+    temp->current = NULL;
+    temp->framePeak = 0;
+}
+
+// Free current thread temporary memory blocks
+void CloseTempMemory(void)
+{
+    for (TempMemoryBlock *block = tempMemory.first, *next = NULL; block != NULL; block = next)
+    {
+        next = block->next;
+        RL_FREE(block);
+    }
+
+    tempMemory = (TempMemory){ 0 };
+}
+
 // Load data from file into a buffer
 unsigned char *LoadFileData(const char *fileName, int *dataSize)
 {
@@ -439,6 +844,25 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Get temporary memory block data pointer (aligned)
+static void *GetTempMemoryBlockData(TempMemoryBlock *block)
+{
+    return (unsigned char *)block + TEMP_MEMORY_BLOCK_HEADER;
+}
+
+// Find temporary memory block containing pointer (current thread)
+static TempMemoryBlock *FindTempMemoryBlock(const void *ptr)
+{
+    for (TempMemoryBlock *block = tempMemory.first; block != NULL; block = block->next)
+    {
+        unsigned char *data = (unsigned char *)GetTempMemoryBlockData(block);
+
+        if (((unsigned char *)ptr >= data) && ((unsigned char *)ptr < (data + block->size))) return block;
+    }
+
+    return NULL;
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -482,9 +906,394 @@ FILE *android_fopen(const char *fileName, const char *mode)
 }
 #endif  // PLATFORM_ANDROID
 
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Trace log
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_TRACELOG)
+// Output formatted trace log message (callback or standard output)
+static void OutputTraceLog(int logType, const char *text)
+{
+    if (traceLog)
+    {
+        // Escape format specifiers, callback receives the formatted message with no arguments
+        char format[MAX_TRACELOG_MSG_LENGTH*2] = { 0 };
+        for (int i = 0, j = 0; text[i] != '\0'; i++)
+        {
+            format[j++] = text[i];
+            if (text[i] == '%') format[j++] = '%';
+        }
+
+        CallTraceLogCallback(logType, format);
+        return;
+    }
+
+#if defined(PLATFORM_ANDROID)
+    switch (logType)
+    {
+        case LOG_TRACE: __android_log_print(ANDROID_LOG_VERBOSE, "raylib", "%s", text); break;
+        case LOG_DEBUG: __android_log_print(ANDROID_LOG_DEBUG, "raylib", "%s", text); break;
+        case LOG_INFO: __android_log_print(ANDROID_LOG_INFO, "raylib", "%s", text); break;
+        case LOG_WARNING: __android_log_print(ANDROID_LOG_WARN, "raylib", "%s", text); break;
+        case LOG_ERROR: __android_log_print(ANDROID_LOG_ERROR, "raylib", "%s", text); break;
+        case LOG_FATAL: __android_log_print(ANDROID_LOG_FATAL, "raylib", "%s", text); break;
+        default: break;
+    }
+#else
+    const char *prefix = "";
+
+    switch (logType)
+    {
+        case LOG_TRACE: prefix = "TRACE: "; break;
+        case LOG_DEBUG: prefix = "DEBUG: "; break;
+        case LOG_INFO: prefix = "INFO: "; break;
+        case LOG_WARNING: prefix = "WARNING: "; break;
+        case LOG_ERROR: prefix = "ERROR: "; break;
+        case LOG_FATAL: prefix = "FATAL: "; break;
+        default: break;
+    }
+
+    printf("%s%s\n", prefix, text);
+    fflush(stdout);
+#endif
+}
+
+// Call trace log callback with message arguments
+static void CallTraceLogCallback(int logType, const char *text, ...)
+{
+    va_list args;
+    va_start(args, text);
+    traceLog(logType, text, args);
+    va_end(args);
+}
+
+// Push formatted message to async ring, false if full
+static bool PushTraceLogRecord(int logType, const char *text, va_list args)
+{
+    unsigned int position = RL_ATOMIC_LOAD(&traceLogAsync.head);
+    TraceLogRecord *record = NULL;
+
+    // Claim record at head position, free records sequence matches their position
+    while (true)
+    {
+        record = &traceLogAsync.records[position & (MAX_TRACELOG_ASYNC_RECORDS - 1)];
+        int diff = (int)(RL_ATOMIC_LOAD(&record->sequence) - position);
+
+        if (diff == 0)
+        {
+            if (RL_ATOMIC_CAS(&traceLogAsync.head, position, position + 1)) break;
+        }
+        else if (diff < 0) return false;    // Record not read yet, ring is full
+
+        position = RL_ATOMIC_LOAD(&traceLogAsync.head);
+    }
+
+    record->logType = logType;
+    vsnprintf(record->text, MAX_TRACELOG_MSG_LENGTH, text, args);
+
+    // Publish record, then wake up output thread if sleeping
+    RL_ATOMIC_ADD(&record->sequence, 1);
+
+    if (RL_ATOMIC_LOAD(&traceLogAsync.sleeping))
+    {
+        rMutexLock(&traceLogAsync.mutex);
+        rConditionSignal(&traceLogAsync.condition);
+        rMutexUnlock(&traceLogAsync.mutex);
+    }
+
+    return true;
+}
+
+// Pop and output next async ring message, false if empty
+// NOTE: Only one consumer at a time, output thread or SetTraceLogAsync() once stopped
+static bool PopTraceLogRecord(void)
+{
+    TraceLogRecord *record = &traceLogAsync.records[traceLogAsync.tail & (MAX_TRACELOG_ASYNC_RECORDS - 1)];
+
+    if (RL_ATOMIC_LOAD(&record->sequence) != (traceLogAsync.tail + 1)) return false;
+
+    OutputTraceLog(record->logType, record->text);
+
+    // Release record for next ring lap
+    RL_ATOMIC_ADD(&record->sequence, MAX_TRACELOG_ASYNC_RECORDS - 1);
+    traceLogAsync.tail++;
+
+    return true;
+}
+
+// Trace log async output thread loop
+static void TraceLogAsyncThread(void *arg)
+{
+    (void)arg;      // Thread argument not used, async output state is global
+    int dropped = 0;
+
+    traceLogOutputThread = true;
+
+    while (true)
+    {
+        while (PopTraceLogRecord());
+
+        int totalDropped = RL_ATOMIC_LOAD(&traceLogAsync.dropped);
+        if (totalDropped != dropped)
+        {
+            TRACELOG(LOG_WARNING, "TRACELOG: %i messages dropped, async output queue full", totalDropped - dropped);
+            dropped = totalDropped;
+        }
+
+        // Sleep until new records are pushed or async output is disabled
+        rMutexLock(&traceLogAsync.mutex);
+        RL_ATOMIC_CAS(&traceLogAsync.sleeping, 0, 1);
+
+        TraceLogRecord *record = &traceLogAsync.records[traceLogAsync.tail & (MAX_TRACELOG_ASYNC_RECORDS - 1)];
+        bool empty = (RL_ATOMIC_LOAD(&record->sequence) != (traceLogAsync.tail + 1));
+        bool running = RL_ATOMIC_LOAD(&traceLogAsync.running);
+
+        if (empty && running) rConditionWait(&traceLogAsync.condition, &traceLogAsync.mutex);
+
+        RL_ATOMIC_CAS(&traceLogAsync.sleeping, 1, 0);
+        rMutexUnlock(&traceLogAsync.mutex);
+
+        if (empty && !running) break;
+    }
+
+    traceLogOutputThread = false;
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Threading
+//----------------------------------------------------------------------------------
+
+// Create and start a thread, returns false on failure
+bool rThreadCreate(rThread *thread, rThreadFunc func, void *arg)
+{
+    bool result = false;
+    rThreadStart *start = (rThreadStart *)RL_MALLOC(sizeof(rThreadStart));
+    start->func = func;
+    start->arg = arg;
+
+#if defined(_WIN32)
+    *thread = (rThread)_beginthreadex(NULL, 0, ThreadEntry, start, 0, NULL);
+    result = (*thread != NULL);
+#else
+    result = (pthread_create(thread, NULL, ThreadEntry, start) == 0);
+#endif
+
+    if (!result) RL_FREE(start);
+
+    return result;
+}
+
+// Wait for thread to finish and release it
+void rThreadJoin(rThread thread)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(thread, 0xFFFFFFFF);    // INFINITE
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+// Yield current thread time slice
+void rThreadYield(void)
+{
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+// Get number of logical processors available
+int rGetProcessorCount(void)
+{
+    int count = 1;
+
+#if defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xFFFF);   // ALL_PROCESSOR_GROUPS
+#elif defined(_SC_NPROCESSORS_ONLN)
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return (count > 0)? count : 1;
+}
+
+// Initialize mutex
+void rMutexInit(rMutex *mutex)
+{
+#if defined(_WIN32)
+    InitializeSRWLock(&mutex->ptr);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+// Destroy mutex
+void rMutexDestroy(rMutex *mutex)
+{
+#if defined(_WIN32)
+    (void)mutex;    // NOTE: SRW locks do not need to be destroyed
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+// Lock mutex
+void rMutexLock(rMutex *mutex)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&mutex->ptr);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+// Unlock mutex
+void rMutexUnlock(rMutex *mutex)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&mutex->ptr);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+// Initialize condition variable
+void rConditionInit(rCondition *cond)
+{
+#if defined(_WIN32)
+    InitializeConditionVariable(&cond->ptr);
+#else
+    pthread_cond_init(cond, NULL);
+#endif
+}
+
+// Destroy condition variable
+void rConditionDestroy(rCondition *cond)
+{
+#if defined(_WIN32)
+    (void)cond;     // NOTE: Condition variables do not need to be destroyed
+#else
+    pthread_cond_destroy(cond);
+#endif
+}
+
+// Wait on condition variable (mutex must be locked)
+void rConditionWait(rCondition *cond, rMutex *mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW(&cond->ptr, &mutex->ptr, 0xFFFFFFFF, 0);
+#else
+    pthread_cond_wait(cond, mutex);
+#endif
+}
+
+// Wake one thread waiting on condition variable
+void rConditionSignal(rCondition *cond)
+{
+#if defined(_WIN32)
+    WakeConditionVariable(&cond->ptr);
+#else
+    pthread_cond_signal(cond);
+#endif
+}
+
+// Wake all threads waiting on condition variable
+void rConditionBroadcast(rCondition *cond)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(&cond->ptr);
+#else
+    pthread_cond_broadcast(cond);
+#endif
+}
+
+// Map file into memory (read-only), returns NULL if file mapping is not available
+// NOTE: Not available with custom file data loader or platforms without file mapping support (Web, Android),
+// use LoadFileData() in that case
+unsigned char *rMapFile(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    if ((fileName == NULL) || (loadFileData != NULL)) return NULL;
+
+#if defined(SUPPORT_STANDARD_FILEIO) && defined(_WIN32)
+    void *file = CreateFileA(fileName, 0x80000000, 0x1, NULL, 3, 0x80, NULL);    // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+    if (file == (void *)-1) return NULL;                                         // INVALID_HANDLE_VALUE
+
+    long long size = 0;
+
+    if (GetFileSizeEx(file, &size) && (size > 0) && (size <= 2147483647))
+    {
+        void *mapping = CreateFileMappingA(file, NULL, 0x2, 0, 0, NULL);         // PAGE_READONLY
+
+        if (mapping != NULL)
+        {
+            data = (unsigned char *)MapViewOfFile(mapping, 0x4, 0, 0, 0);        // FILE_MAP_READ
+            CloseHandle(mapping);       // NOTE: Mapped view keeps the mapping object alive
+        }
+    }
+
+    CloseHandle(file);
+#elif defined(SUPPORT_STANDARD_FILEIO) && defined(RL_FILE_MAPPING_POSIX)
+    int file = open(fileName, O_RDONLY);
+    if (file < 0) return NULL;
+
+    struct stat info = { 0 };
+    long long size = 0;
+
+    if ((fstat(file, &info) == 0) && (info.st_size > 0) && (info.st_size <= 2147483647))
+    {
+        size = (long long)info.st_size;
+        void *mapping = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (mapping != MAP_FAILED) data = (unsigned char *)mapping;
+    }
+
+    close(file);
+#else
+    long long size = 0;
+#endif
+
+    if (data != NULL)
+    {
+        *dataSize = (int)size;
+        TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+    }
+
+    return data;
+}
+
+// Unmap file mapped by rMapFile()
+void rUnmapFile(unsigned char *data, int dataSize)
+{
+    if (data == NULL) return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(data);
+#elif defined(RL_FILE_MAPPING_POSIX)
+    munmap(data, (size_t)dataSize);
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Platform thread entry point
+#if defined(_WIN32)
+static unsigned int __stdcall ThreadEntry(void *arg)
+#else
+static void *ThreadEntry(void *arg)
+#endif
+{
+    rThreadStart start = *(rThreadStart *)arg;
+    RL_FREE(arg);
+
+    start.func(start.arg);
+
+    return 0;
+}
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *data, int dataSize)
 {
@@ -32,8 +32,13 @@
     #include <android/asset_manager.h>      // Required for: AAssetManager
 #endif
 
+// NOTE: Messages below TRACELOG_MIN_LEVEL are removed at compile time
+#ifndef TRACELOG_MIN_LEVEL
+    #define TRACELOG_MIN_LEVEL 0
+#endif
+
 #if defined(SUPPORT_TRACELOG)
-    #define TRACELOG(level, ...) TraceLog(level, __VA_ARGS__)
+    #define TRACELOG(level, ...) (((int)(level) >= (int)(TRACELOG_MIN_LEVEL))? TraceLog(level, __VA_ARGS__) : (void)0)
 
     #if defined(SUPPORT_TRACELOG_DEBUG)
         #define TRACELOGD(...) TraceLog(LOG_DEBUG, __VA_ARGS__)
@@ -52,10 +57,54 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// Thread-local storage specifier
+#if defined(_MSC_VER)
+    #define RL_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__) || defined(__TINYC__)
+    #define RL_THREAD_LOCAL __thread
+#else
+    #define RL_THREAD_LOCAL _Thread_local
+#endif
+
+// Atomic operations on int values (sequentially consistent)
+#if defined(_MSC_VER)
+    long _InterlockedExchangeAdd(long volatile *addend, long value);
+    long _InterlockedCompareExchange(long volatile *dest, long exchange, long comparand);
+    #pragma intrinsic(_InterlockedExchangeAdd, _InterlockedCompareExchange)
+
+    #define RL_ATOMIC_ADD(ptr, value) (_InterlockedExchangeAdd((long volatile *)(ptr), (long)(value)) + (value))  // Returns new value
+    #define RL_ATOMIC_LOAD(ptr) _InterlockedCompareExchange((long volatile *)(ptr), 0, 0)
+    #define RL_ATOMIC_CAS(ptr, expected, desired) (_InterlockedCompareExchange((long volatile *)(ptr), (long)(desired), (long)(expected)) == (long)(expected))
+#else
+    #define RL_ATOMIC_ADD(ptr, value) __atomic_add_fetch((ptr), (value), __ATOMIC_SEQ_CST)      // Returns new value
+    #define RL_ATOMIC_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+    #define RL_ATOMIC_CAS(ptr, expected, desired) __extension__ ({ __typeof__(*(ptr)) _exp = (expected); \
+        __atomic_compare_exchange_n((ptr), &_exp, (desired), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST); })
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Threading primitives, platform handles
+// NOTE: On Windows, SRWLOCK and CONDITION_VARIABLE are pointer-sized, windows.h is not included
+// NOTE: RL_MUTEX_INITIALIZER initializes static mutexes, no rMutexInit() required (never destroyed)
+#if defined(_WIN32)
+    typedef void *rThread;
+    typedef struct rMutex { void *ptr; } rMutex;
+    typedef struct rCondition { void *ptr; } rCondition;
+
+    #define RL_MUTEX_INITIALIZER { 0 }      // SRWLOCK_INIT
+#else
+    #include <pthread.h>
+
+    typedef pthread_t rThread;
+    typedef pthread_mutex_t rMutex;
+    typedef pthread_cond_t rCondition;
+
+    #define RL_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#endif
+
+typedef void (*rThreadFunc)(void *arg);     // Thread entry point
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +123,32 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+// Temporary memory functions
+void InitTempMemoryFrame(void);                                        // Set current thread temporary memory as frame memory
+void ResetTempMemoryFrame(void);                                       // Release frame temporary memory allocations (EndDrawing())
+void CloseTempMemory(void);                                            // Free current thread temporary memory blocks
+
+// Threading functions
+bool rThreadCreate(rThread *thread, rThreadFunc func, void *arg);      // Create and start a thread, returns false on failure
+void rThreadJoin(rThread thread);                                      // Wait for thread to finish and release it
+void rThreadYield(void);                                               // Yield current thread time slice
+int rGetProcessorCount(void);                                          // Get number of logical processors available
+
+void rMutexInit(rMutex *mutex);                                        // Initialize mutex
+void rMutexDestroy(rMutex *mutex);                                     // Destroy mutex
+void rMutexLock(rMutex *mutex);                                        // Lock mutex
+void rMutexUnlock(rMutex *mutex);                                      // Unlock mutex
+
+void rConditionInit(rCondition *cond);                                 // Initialize condition variable
+void rConditionDestroy(rCondition *cond);                              // Destroy condition variable
+void rConditionWait(rCondition *cond, rMutex *mutex);                  // Wait on condition variable (mutex must be locked)
+void rConditionSignal(rCondition *cond);                               // Wake one thread waiting on condition variable
+void rConditionBroadcast(rCondition *cond);                            // Wake all threads waiting on condition variable
+
+// File mapping functions
+unsigned char *rMapFile(const char *fileName, int *dataSize);          // Map file into memory (read-only), returns NULL if not available
+void rUnmapFile(unsigned char *data, int dataSize);                    // Unmap file mapped by rMapFile()
+
 #if defined(__cplusplus)
 }
 #endif